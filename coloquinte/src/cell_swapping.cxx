@@ -10,8 +10,8 @@ namespace dp{
 namespace{
 
 // Tries to swap two cells; 
-inline bool try_swap(netlist const & circuit, detailed_placement & pl, index_t c1, index_t c2, bool try_flip,
-std::function<std::int64_t(netlist const &, detailed_placement const &, std::vector<index_t> const &)> get_nets_cost){
+inline bool try_swap(netlist const & circuit, detailed_placement & pl, banded_placement const & view, index_t c1, index_t c2, bool try_flip,
+std::function<std::int64_t(netlist const &, banded_placement const &, std::vector<index_t> const &)> get_nets_cost){
     assert(pl.cell_height(c1) == 1 and pl.cell_height(c2) == 1);
     assert( (circuit.get_cell(c1).attributes & XMovable) != 0 and (circuit.get_cell(c1).attributes & YMovable) != 0);
     assert( (circuit.get_cell(c2).attributes & XMovable) != 0 and (circuit.get_cell(c2).attributes & YMovable) != 0);
@@ -40,7 +40,7 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
         involved_nets.resize(std::distance(involved_nets.begin(), std::unique(involved_nets.begin(), involved_nets.end())));
 
         // Test the cost for the old position and the cost swapping the cells
-        std::int64_t old_cost = get_nets_cost(circuit, pl, involved_nets);
+        std::int64_t old_cost = get_nets_cost(circuit, view, involved_nets);
 
         // Save the old values
         point<int_t> p1 = pl.plt_.positions_[c1];
@@ -63,7 +63,7 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
             for(index_t i=0; i<4; ++i){
                 pl.plt_.orientations_[c1].x_ = i % 2;
                 pl.plt_.orientations_[c2].x_ = i / 2;
-                std::int64_t new_cost  = get_nets_cost(circuit, pl, involved_nets);
+                std::int64_t new_cost  = get_nets_cost(circuit, view, involved_nets);
                 if(new_cost < old_cost){
                     old_cost = new_cost;
                     bst_ind = i;
@@ -86,7 +86,7 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
                 return false;
             }
         }
-        else if(get_nets_cost(circuit, pl, involved_nets) < old_cost){
+        else if(get_nets_cost(circuit, view, involved_nets) < old_cost){
             pl.swap_standard_cell_topologies(c1, c2);
             return true;
         }
@@ -113,10 +113,12 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
 }
 
 inline void generic_swaps_global(netlist const & circuit, detailed_placement & pl, index_t row_extent, index_t cell_extent, bool try_flip,
-std::function<std::int64_t(netlist const &, detailed_placement const &, std::vector<index_t> const &)> get_nets_cost){
-    for(index_t main_row = 0; main_row < pl.row_cnt(); ++main_row){
+std::function<std::int64_t(netlist const &, banded_placement const &, std::vector<index_t> const &)> get_nets_cost){
+    // In the banded mode, both cells of a swap are in the same band
+    for_each_row_band(pl, [&](index_t row_begin, index_t row_end, banded_placement const & view){
+    for(index_t main_row = row_begin; main_row < row_end; ++main_row){
 
-        for(index_t other_row = main_row+1; other_row <= std::min(pl.row_cnt()-1, main_row+row_extent) ; ++other_row){
+        for(index_t other_row = main_row+1; other_row <= std::min(row_end-1, main_row+row_extent) ; ++other_row){
 
             index_t first_oc = pl.get_first_standard_cell_on_row(other_row); // The first candidate cell to be examined
             for(index_t c = pl.get_first_standard_cell_on_row(main_row); c != null_ind; c = pl.get_next_standard_cell_on_row(c, main_row)){
@@ -136,7 +138,7 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
                     if(pl.plt_.positions_[oc].x_ >= pos_hgh) ++nb_after;
                     if(pl.plt_.positions_[oc].x_ + circuit.get_cell(oc).size.x_ <= pos_low) ++ nb_before;
 
-                    if(try_swap(circuit, pl, c, oc, try_flip, get_nets_cost)){
+                    if(try_swap(circuit, pl, view, c, oc, try_flip, get_nets_cost)){
                         std::swap(c, oc);
                         if(c == first_oc) first_oc = oc;
                     }
@@ -148,6 +150,7 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
             }
         }
     }
+    });
     pl.selfcheck();
 }
 
@@ -155,11 +158,11 @@ std::function<std::int64_t(netlist const &, detailed_placement const &, std::vec
 
 void swaps_global_HPWL(netlist const & circuit, detailed_placement & pl, index_t row_extent, index_t cell_extent, bool try_flip){
     generic_swaps_global(circuit, pl, row_extent, cell_extent, try_flip,
-        [](netlist const & circuit, detailed_placement const & pl, std::vector<index_t> const & involved_nets) -> std::int64_t{
+        [](netlist const & circuit, banded_placement const & view, std::vector<index_t> const & involved_nets) -> std::int64_t{
         std::int64_t sum = 0;
         for(index_t n : involved_nets){
             if(circuit.get_net(n).pin_cnt <= 1) continue;
-            sum += get_HPWL_length(circuit, pl.plt_, n);
+            sum += get_HPWL_length(circuit, view, n);
         }
         return sum;
     });
@@ -167,11 +170,11 @@ void swaps_global_HPWL(netlist const & circuit, detailed_placement & pl, index_t
 
 void swaps_global_RSMT(netlist const & circuit, detailed_placement & pl, index_t row_extent, index_t cell_extent, bool try_flip){
     generic_swaps_global(circuit, pl, row_extent, cell_extent, try_flip,
-        [](netlist const & circuit, detailed_placement const & pl, std::vector<index_t> const & involved_nets) -> std::int64_t{
+        [](netlist const & circuit, banded_placement const & view, std::vector<index_t> const & involved_nets) -> std::int64_t{
         std::int64_t sum = 0;
         for(index_t n : involved_nets){
             if(circuit.get_net(n).pin_cnt <= 1) continue;
-            sum += get_RSMT_length(circuit, pl.plt_, n);
+            sum += get_RSMT_length(circuit, view, n);
         }
         return sum;
     });
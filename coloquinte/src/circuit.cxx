@@ -4,7 +4,10 @@
 
 namespace coloquinte{
 
-std::int64_t get_HPWL_length(netlist const & circuit, placement_t const & pl, index_t net_ind){
+namespace{
+
+template<typename PL>
+std::int64_t net_HPWL_length(netlist const & circuit, PL const & pl, index_t net_ind){
     if(circuit.get_net(net_ind).pin_cnt <= 1) return 0;
 
     auto pins = get_pins_1D(circuit, pl, net_ind);
@@ -12,7 +15,8 @@ std::int64_t get_HPWL_length(netlist const & circuit, placement_t const & pl, in
     return ((minmaxX.second->pos - minmaxX.first->pos) + (minmaxY.second->pos - minmaxY.first->pos));
 }
 
-std::int64_t get_RSMT_length(netlist const & circuit, placement_t const & pl, index_t net_ind){
+template<typename PL>
+std::int64_t net_RSMT_length(netlist const & circuit, PL const & pl, index_t net_ind){
     if(circuit.get_net(net_ind).pin_cnt <= 1) return 0;
     auto pins = get_pins_2D(circuit, pl, net_ind);
     std::vector<point<int_t> > points;
@@ -22,6 +26,13 @@ std::int64_t get_RSMT_length(netlist const & circuit, placement_t const & pl, in
     return RSMT_length(points, 8);
 }
 
+} // End anonymous namespace
+
+std::int64_t get_HPWL_length(netlist const & circuit, placement_t const & pl, index_t net_ind){ return net_HPWL_length(circuit, pl, net_ind); }
+std::int64_t get_HPWL_length(netlist const & circuit, banded_placement const & pl, index_t net_ind){ return net_HPWL_length(circuit, pl, net_ind); }
+std::int64_t get_RSMT_length(netlist const & circuit, placement_t const & pl, index_t net_ind){ return net_RSMT_length(circuit, pl, net_ind); }
+std::int64_t get_RSMT_length(netlist const & circuit, banded_placement const & pl, index_t net_ind){ return net_RSMT_length(circuit, pl, net_ind); }
+
 namespace gp{
 
 void add_force(pin_1D const p1, pin_1D const p2, linear_system & L, float_t force){
@@ -246,6 +257,7 @@ point<linear_system> get_RSMT_linear_system(netlist const & circuit, placement_t
 
 std::int64_t get_HPWL_wirelength(netlist const & circuit, placement_t const & pl){
     std::int64_t sum = 0;
+    #pragma omp parallel for reduction(+:sum) schedule(dynamic, 1024)
     for(index_t i=0; i<circuit.net_cnt(); ++i){
         sum += get_HPWL_length(circuit, pl, i);
     }
@@ -268,6 +280,7 @@ std::int64_t get_MST_wirelength(netlist const & circuit, placement_t const & pl)
 
 std::int64_t get_RSMT_wirelength(netlist const & circuit, placement_t const & pl){
     std::int64_t sum = 0;
+    #pragma omp parallel for reduction(+:sum) schedule(dynamic, 1024)
     for(index_t i=0; i<circuit.net_cnt(); ++i){
         sum += get_RSMT_length(circuit, pl, i);
     }
@@ -275,6 +288,11 @@ std::int64_t get_RSMT_wirelength(netlist const & circuit, placement_t const & pl
 }
 
 void solve_linear_system(netlist const & circuit, placement_t & pl, point<linear_system> & L, index_t nbr_iter){
+    point<assembled_system> S;
+    solve_linear_system(circuit, pl, L, S, nbr_iter);
+}
+
+void solve_linear_system(netlist const & circuit, placement_t & pl, point<linear_system> & L, point<assembled_system> & S, index_t nbr_iter){
     std::vector<float_t> x_sol, y_sol;
     std::vector<float_t> x_guess(pl.cell_cnt()), y_guess(pl.cell_cnt());
     
@@ -285,12 +303,15 @@ void solve_linear_system(netlist const & circuit, placement_t & pl, point<linear
         x_guess[i] = static_cast<float_t>(pl.positions_[i].x_);
         y_guess[i] = static_cast<float_t>(pl.positions_[i].y_);
     }
+    // The assembly is parallel by itself
+    S.x_.assemble(L.x_);
+    S.y_.assemble(L.y_);
     #pragma omp parallel sections num_threads(2)
     {
     #pragma omp section
-    x_sol = L.x_.solve_CG(x_guess, nbr_iter);
+    x_sol = S.x_.solve_CG(x_guess, nbr_iter);
     #pragma omp section
-    y_sol = L.y_.solve_CG(y_guess, nbr_iter);
+    y_sol = S.y_.solve_CG(y_guess, nbr_iter);
     }
     for(index_t i=0; i<pl.cell_cnt(); ++i){
         if( (circuit.get_cell(i).attributes & XMovable) != 0){
@@ -0,0 +1,230 @@
+#include "coloquinte/clustering.hxx"
+
+#include <algorithm>
+#include <limits>
+#include <cassert>
+
+namespace coloquinte{
+namespace gp{
+
+namespace{
+
+index_t const no_cluster = std::numeric_limits<index_t>::max();
+
+bool is_mergeable(netlist const & circuit, index_t c){
+    mask_t attr = circuit.get_cell(c).attributes;
+    return (attr & XMovable) != 0 and (attr & YMovable) != 0 and (attr & SoftMacro) == 0;
+}
+
+} // End anonymous namespace
+
+netlist_clustering::netlist_clustering(netlist const & fine, float_t reduction_ratio, index_t max_net_pins){
+    index_t const N = fine.cell_cnt();
+    cell_clusters_.assign(N, no_cluster);
+
+    std::vector<index_t> movable;
+    capacity_t movable_area = 0;
+    for(index_t c=0; c<N; ++c){
+        if(is_mergeable(fine, c)){
+            movable.push_back(c);
+            movable_area += fine.get_cell(c).area;
+        }
+    }
+    if(movable.empty()){
+        for(index_t c=0; c<N; ++c){
+            cell_clusters_[c] = c;
+            cluster_sizes_.push_back(1);
+        }
+        return;
+    }
+
+    // Avoid huge clusters, which are difficult to spread
+    capacity_t const max_area = std::max<capacity_t>(1, static_cast<capacity_t>(2.0f * reduction_ratio * movable_area / movable.size()));
+    index_t const target_cnt = std::max<index_t>(1, static_cast<index_t>(movable.size() / reduction_ratio));
+
+    // Smallest cells first: they are the ones that benefit most from being merged
+    std::stable_sort(movable.begin(), movable.end(), [&](index_t a, index_t b){ return fine.get_cell(a).area < fine.get_cell(b).area; });
+
+    std::vector<index_t>    cluster_leaders;
+    std::vector<capacity_t> cluster_areas;
+    std::vector<float_t>    scores(N, 0.0f);
+    std::vector<index_t>    touched;
+    index_t                 remaining = movable.size(); // Number of clusters if the unvisited cells stay alone
+
+    // The score of a cluster is accumulated on its first cell
+    auto representative = [&](index_t c) -> index_t{
+        return cell_clusters_[c] == no_cluster ? c : cluster_leaders[cell_clusters_[c]];
+    };
+    auto area_of = [&](index_t r) -> capacity_t{
+        return cell_clusters_[r] == no_cluster ? fine.get_cell(r).area : cluster_areas[cell_clusters_[r]];
+    };
+
+    for(index_t v : movable){
+        if(cell_clusters_[v] != no_cluster) continue;
+        capacity_t const v_area = fine.get_cell(v).area;
+
+        index_t best = no_cluster;
+        if(remaining > target_cnt){
+            for(auto p : fine.get_cell(v)){
+                auto n = fine.get_net(p.net_ind);
+                if(n.pin_cnt < 2 or n.pin_cnt > max_net_pins) continue;
+                float_t w = static_cast<float_t>(n.weight) / (n.pin_cnt - 1);
+                for(auto q : n){
+                    if(q.cell_ind == v or not is_mergeable(fine, q.cell_ind)) continue;
+                    index_t r = representative(q.cell_ind);
+                    if(scores[r] == 0.0f) touched.push_back(r);
+                    scores[r] += w;
+                }
+            }
+
+            float_t best_score = 0.0f;
+            for(index_t r : touched){
+                capacity_t merged_area = v_area + area_of(r);
+                if(merged_area <= max_area){
+                    float_t score = scores[r] / static_cast<float_t>(std::max<capacity_t>(merged_area, 1));
+                    if(score > best_score){
+                        best_score = score;
+                        best = r;
+                    }
+                }
+                scores[r] = 0.0f;
+            }
+            touched.clear();
+        }
+
+        if(best == no_cluster){
+            cell_clusters_[v] = cluster_leaders.size();
+            cluster_leaders.push_back(v);
+            cluster_areas.push_back(v_area);
+            cluster_sizes_.push_back(1);
+            continue;
+        }
+        if(cell_clusters_[best] == no_cluster){
+            cell_clusters_[best] = cluster_leaders.size();
+            cluster_leaders.push_back(best);
+            cluster_areas.push_back(fine.get_cell(best).area);
+            cluster_sizes_.push_back(1);
+        }
+        index_t k = cell_clusters_[best];
+        cell_clusters_[v] = k;
+        cluster_areas[k] += v_area;
+        ++cluster_sizes_[k];
+        --remaining;
+    }
+
+    // The fixed cells are kept as is
+    for(index_t c=0; c<N; ++c){
+        if(cell_clusters_[c] == no_cluster){
+            cell_clusters_[c] = cluster_sizes_.size();
+            cluster_sizes_.push_back(1);
+        }
+    }
+}
+
+netlist netlist_clustering::get_coarse_netlist(netlist const & fine) const{
+    assert(fine.cell_cnt() == fine_cnt());
+
+    std::vector<capacity_t>   areas(coarse_cnt(), 0);
+    std::vector<int_t>        heights(coarse_cnt(), 1);
+    std::vector<index_t>      members(coarse_cnt());
+    for(index_t c=0; c<fine_cnt(); ++c){
+        index_t k = cell_clusters_[c];
+        auto cell = fine.get_cell(c);
+        areas[k] += cell.area;
+        heights[k] = std::max(heights[k], cell.size.y_);
+        members[k] = c;
+    }
+
+    // Clusters are as high as their tallest cell, so they stay row-like
+    std::vector<temporary_cell> cells;
+    for(index_t k=0; k<coarse_cnt(); ++k){
+        auto cell = fine.get_cell(members[k]);
+        if(cluster_sizes_[k] == 1){
+            cells.push_back(temporary_cell(cell.size, cell.attributes, k));
+        }
+        else{
+            int_t width = static_cast<int_t>(std::max<capacity_t>(1, (areas[k] + heights[k] - 1) / heights[k]));
+            cells.push_back(temporary_cell(point<int_t>(width, heights[k]), XMovable | YMovable, k));
+        }
+    }
+
+    // Nets entirely inside a cluster disappear; pins on the same cluster are merged
+    std::vector<temporary_net> nets;
+    std::vector<temporary_pin> pins;
+    std::vector<temporary_pin> net_pins;
+    for(index_t n=0; n<fine.net_cnt(); ++n){
+        net_pins.clear();
+        for(auto p : fine.get_net(n)){
+            index_t k = cell_clusters_[p.cell_ind];
+            point<int_t> offset = cluster_sizes_[k] == 1 ? p.offset : point<int_t>(cells[k].size.x_/2, cells[k].size.y_/2);
+            net_pins.push_back(temporary_pin(offset, k, nets.size()));
+        }
+        std::stable_sort(net_pins.begin(), net_pins.end(), [](temporary_pin const a, temporary_pin const b){ return a.cell_ind < b.cell_ind; });
+        net_pins.resize(std::unique(net_pins.begin(), net_pins.end(), [](temporary_pin const a, temporary_pin const b){ return a.cell_ind == b.cell_ind; }) - net_pins.begin());
+        if(net_pins.size() < 2) continue;
+
+        pins.insert(pins.end(), net_pins.begin(), net_pins.end());
+        nets.push_back(temporary_net(nets.size(), fine.get_net(n).weight));
+    }
+
+    return netlist(cells, nets, pins);
+}
+
+placement_t netlist_clustering::get_coarse_placement(netlist const & fine, netlist const & coarse, placement_t const & fine_pl) const{
+    assert(fine_pl.cell_cnt() == fine_cnt());
+    assert(coarse.cell_cnt() == coarse_cnt());
+
+    std::vector<point<std::int64_t> > centers(coarse_cnt(), point<std::int64_t>(0, 0));
+    std::vector<std::int64_t>         weights(coarse_cnt(), 0);
+
+    placement_t ret;
+    ret.positions_.resize(coarse_cnt());
+    ret.orientations_.assign(coarse_cnt(), point<bool>(true, true));
+    for(index_t c=0; c<fine_cnt(); ++c){
+        index_t k = cell_clusters_[c];
+        if(cluster_sizes_[k] == 1){
+            ret.positions_[k] = fine_pl.positions_[c];
+            ret.orientations_[k] = fine_pl.orientations_[c];
+            continue;
+        }
+        auto cell = fine.get_cell(c);
+        std::int64_t w = std::max<capacity_t>(cell.area, 1);
+        centers[k].x_ += w * (2 * static_cast<std::int64_t>(fine_pl.positions_[c].x_) + cell.size.x_);
+        centers[k].y_ += w * (2 * static_cast<std::int64_t>(fine_pl.positions_[c].y_) + cell.size.y_);
+        weights[k] += w;
+    }
+    for(index_t k=0; k<coarse_cnt(); ++k){
+        if(cluster_sizes_[k] == 1) continue;
+        point<int_t> size = coarse.get_cell(k).size;
+        ret.positions_[k] = point<int_t>(
+            static_cast<int_t>((centers[k].x_ / weights[k] - size.x_) / 2),
+            static_cast<int_t>((centers[k].y_ / weights[k] - size.y_) / 2)
+        );
+    }
+    return ret;
+}
+
+void netlist_clustering::interpolate(netlist const & fine, netlist const & coarse, placement_t const & coarse_pl, placement_t & fine_pl) const{
+    assert(coarse_pl.cell_cnt() == coarse_cnt());
+    assert(fine_pl.cell_cnt() == fine_cnt());
+
+    #pragma omp parallel for
+    for(index_t c=0; c<fine_cnt(); ++c){
+        index_t k = cell_clusters_[c];
+        if(cluster_sizes_[k] == 1){
+            fine_pl.positions_[c] = coarse_pl.positions_[k];
+            fine_pl.orientations_[c] = coarse_pl.orientations_[k];
+        }
+        else{
+            point<int_t> coarse_size = coarse.get_cell(k).size, fine_size = fine.get_cell(c).size;
+            fine_pl.positions_[c] = point<int_t>(
+                coarse_pl.positions_[k].x_ + (coarse_size.x_ - fine_size.x_) / 2,
+                coarse_pl.positions_[k].y_ + (coarse_size.y_ - fine_size.y_) / 2
+            );
+        }
+    }
+}
+
+} // namespace gp
+} // namespace coloquinte
+
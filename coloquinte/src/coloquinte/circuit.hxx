@@ -32,6 +32,8 @@ point<linear_system> get_linear_pulling_forces (netlist const & circuit, placeme
 
 // Solve the final linear system
 void solve_linear_system(netlist const & circuit, placement_t & pl, point<linear_system> & L, index_t nbr_iter);
+// Same, but keeps the compressed systems (and their sparsity pattern) in S for the next call
+void solve_linear_system(netlist const & circuit, placement_t & pl, point<linear_system> & L, point<assembled_system> & S, index_t nbr_iter);
 
 // Cost-related stuff, whether wirelength or disruption
 std::int64_t get_HPWL_wirelength (netlist const & circuit, placement_t const & pl);
@@ -33,9 +33,28 @@ inline int_t dist(pin_2D const a, pin_2D const b){
     return std::abs(diff.x_) + std::abs(diff.y_);
 }
 
-inline std::vector<pin_2D>         get_pins_2D(netlist const & circuit, placement_t const & pl, index_t net_ind){
+// A placement seen through a band of rows, for the banded parallel detailed placement:
+// the cells of the band are read from the live placement, the others from a frozen copy
+struct banded_placement{
+    placement_t const & live_;
+    placement_t const & frozen_;
+    std::vector<index_t> const & cell_bands_;
+    index_t band_;
+
+    banded_placement(placement_t const & live, placement_t const & frozen, std::vector<index_t> const & cell_bands, index_t band)
+        : live_(live), frozen_(frozen), cell_bands_(cell_bands), band_(band){}
+    bool is_banded() const{ return not cell_bands_.empty(); }
+    bool is_live(index_t c) const{ return cell_bands_.empty() or cell_bands_[c] == band_; }
+};
+
+inline placement_t const & cell_placement(placement_t const & pl, index_t){ return pl; }
+inline placement_t const & cell_placement(banded_placement const & pl, index_t c){ return pl.is_live(c) ? pl.live_ : pl.frozen_; }
+
+template<typename PL>
+inline std::vector<pin_2D>         get_pins_2D(netlist const & circuit, PL const & bpl, index_t net_ind){
     std::vector<pin_2D> ret;
     for(auto p : circuit.get_net(net_ind)){
+        placement_t const & pl = cell_placement(bpl, p.cell_ind);
         assert(std::isfinite(pl.positions_[p.cell_ind].x_) and std::isfinite(pl.positions_[p.cell_ind].y_));
         assert(std::isfinite(pl.orientations_[p.cell_ind].x_) and std::isfinite(pl.orientations_[p.cell_ind].y_));
 
@@ -53,9 +72,11 @@ inline std::vector<pin_2D>         get_pins_2D(netlist const & circuit, placemen
     return ret;
 }
 
-inline point<std::vector<pin_1D> > get_pins_1D(netlist const & circuit, placement_t const & pl, index_t net_ind){
+template<typename PL>
+inline point<std::vector<pin_1D> > get_pins_1D(netlist const & circuit, PL const & bpl, index_t net_ind){
     point<std::vector<pin_1D> > ret;
     for(auto p : circuit.get_net(net_ind)){
+        placement_t const & pl = cell_placement(bpl, p.cell_ind);
         assert(std::isfinite(pl.positions_[p.cell_ind].x_) and std::isfinite(pl.positions_[p.cell_ind].y_));
         assert(std::isfinite(pl.orientations_[p.cell_ind].x_) and std::isfinite(pl.orientations_[p.cell_ind].y_));
 
@@ -80,6 +101,8 @@ std::int64_t MST_length(std::vector<point<int_t> > const & pins);
 std::int64_t RSMT_length(std::vector<point<int_t> > const & pins, index_t exactitude_limit);
 std::int64_t get_HPWL_length(netlist const & circuit, placement_t const & pl, index_t net_ind);
 std::int64_t get_RSMT_length(netlist const & circuit, placement_t const & pl, index_t net_ind);
+std::int64_t get_HPWL_length(netlist const & circuit, banded_placement const & pl, index_t net_ind);
+std::int64_t get_RSMT_length(netlist const & circuit, banded_placement const & pl, index_t net_ind);
 
 std::vector<std::pair<index_t, index_t> > get_MST_topology(std::vector<point<int_t> > const & pins);
 std::vector<std::pair<index_t, index_t> > get_RSMT_horizontal_topology(std::vector<point<int_t> > const & pins, index_t exactitude_limits);
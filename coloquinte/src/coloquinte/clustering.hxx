@@ -0,0 +1,44 @@
+#ifndef COLOQUINTE_GP_CLUSTERING
+#define COLOQUINTE_GP_CLUSTERING
+
+#include "common.hxx"
+#include "netlist.hxx"
+
+#include <vector>
+
+namespace coloquinte{
+namespace gp{
+
+/*
+ * One coarsening step of a multilevel placement
+ *
+ * The movable cells are grouped by first-choice clustering: each cell, visited from the smallest,
+ * joins the neighbouring cluster with the heaviest connection (sum of weight/(pin_cnt-1) over the
+ * shared nets, normalized by the resulting area). Fixed cells and cells that cannot move in both
+ * directions are never merged and keep their own entry in the coarse netlist.
+ * A cluster has the total area of its cells and the height of the tallest one, with all pins on its center.
+ */
+struct netlist_clustering{
+    std::vector<index_t> cell_clusters_; // Coarse cell of each fine cell
+    std::vector<index_t> cluster_sizes_; // Number of fine cells in each coarse cell
+
+    // Cluster the movable cells until their number is divided by reduction_ratio
+    netlist_clustering(netlist const & fine, float_t reduction_ratio = 2.0f, index_t max_net_pins = 16);
+
+    index_t fine_cnt() const{ return cell_clusters_.size(); }
+    index_t coarse_cnt() const{ return cluster_sizes_.size(); }
+
+    netlist get_coarse_netlist(netlist const & fine) const;
+
+    // Clusters at the area-weighted centroid of their cells
+    placement_t get_coarse_placement(netlist const & fine, netlist const & coarse, placement_t const & fine_pl) const;
+
+    // Cells at the center of their cluster; the orientations of the merged cells are kept
+    void interpolate(netlist const & fine, netlist const & coarse, placement_t const & coarse_pl, placement_t & fine_pl) const;
+};
+
+} // namespace gp
+} // namespace coloquinte
+
+#endif
+
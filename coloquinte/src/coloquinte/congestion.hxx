@@ -0,0 +1,72 @@
+#ifndef COLOQUINTE_GP_CONGESTION
+#define COLOQUINTE_GP_CONGESTION
+
+#include "common.hxx"
+#include "netlist.hxx"
+#include "rough_legalizers.hxx"
+
+#include <vector>
+
+namespace coloquinte{
+namespace gp{
+
+/*
+ * RUDY (Rectangular Uniform wire DensitY) congestion estimation
+ *
+ * Each net is assumed to spread its half-perimeter wirelength uniformly over its bounding box,
+ * i.e. a demand of weight * (w+h)/(w*h) per unit of area, which is summed on a regular grid of bins.
+ * As for the wirelength tracker, each update only moves the contribution of the nets whose bounding
+ * box changed; when too many cells moved, the grid is rebuilt from scratch in parallel.
+ * The demand is a wirelength: with one track per unit of length on each routing layer, the capacity
+ * of a bin is its area times the number of layers.
+ */
+class congestion_map{
+    // Flat pin storage, sorted by net
+    std::vector<index_t>       net_limits_;
+    std::vector<index_t>       pin_cells_;
+    std::vector<point<int_t> > pin_offsets_, pin_flipped_offsets_;
+    std::vector<float_t>       net_weights_;
+
+    // From cells to nets
+    std::vector<index_t>       cell_limits_;
+    std::vector<index_t>       cell_nets_;
+
+    // The last placement seen and the corresponding bounding boxes
+    std::vector<point<int_t> > positions_;
+    std::vector<point<bool> >  orientations_;
+    std::vector<box<int_t> >   net_boxes_;
+    bool                       initialized_;
+
+    box<int_t>                 surface_;
+    int_t                      bin_size_;
+    index_t                    x_cnt_, y_cnt_;
+    std::vector<double>        demands_;
+
+    box<int_t> compute_box(index_t n) const;
+    void add_net(std::vector<double> & demands, box<int_t> const b, double weight) const;
+    void full_update(placement_t const & pl);
+
+    public:
+    congestion_map(netlist const & circuit, box<int_t> surface, int_t bin_size);
+
+    // Take the new placement into account, moving only the nets that changed
+    void update(placement_t const & pl);
+
+    index_t x_cnt() const{ return x_cnt_; }
+    index_t y_cnt() const{ return y_cnt_; }
+    box<int_t> get_bin(index_t x, index_t y) const;
+    double get_demand(index_t x, index_t y) const{ return demands_[y*x_cnt_ + x]; }
+
+    // Ratio of the demand to the capacity; capacity is the number of tracks per unit of length
+    float_t get_congestion(index_t x, index_t y, float_t capacity) const;
+    float_t get_max_congestion(float_t capacity) const;
+
+    // Lower the allowed density of the bins above the threshold, proportionally to their congestion
+    density_restrictions get_density_limits(float_t capacity, float_t threshold, float_t min_density) const;
+};
+
+} // namespace gp
+} // namespace coloquinte
+
+#endif
+
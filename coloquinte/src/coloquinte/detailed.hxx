@@ -4,6 +4,7 @@
 
 #include "common.hxx"
 #include "netlist.hxx"
+#include "circuit_helper.hxx"
 
 #include <vector>
 #include <limits>
@@ -13,6 +14,13 @@ namespace dp{
 
 const index_t null_ind = std::numeric_limits<index_t>::max();
 
+// Bands of rows for the parallel detailed placement
+struct row_bands{
+    std::vector<index_t> limits_;     // Band b covers the rows [limits_[b], limits_[b+1])
+    std::vector<index_t> cell_bands_; // Band of the first row of each cell
+    index_t band_cnt() const{ return limits_.size()-1; }
+};
+
 struct detailed_placement{
     // All position and orientation stuff
     placement_t plt_;
@@ -32,6 +40,13 @@ struct detailed_placement{
 
     std::vector<index_t> row_first_cells_, row_last_cells_; // For each row, which cells are the on the boundaries
 
+    // Banded parallel mode: when non-zero, the row optimizations work concurrently on bands of band_rows_ rows
+    index_t band_rows_;
+    index_t band_pass_; // Number of banded passes so far, used to alternate the offsets of the bands
+
+    // Incremental mode: when not empty, the row optimizations only work on the rows flagged here
+    std::vector<char> active_rows_;
+
     // Tests the coherency between positions, widths and topological representation
     void selfcheck() const;
 
@@ -65,8 +80,49 @@ struct detailed_placement{
 
     void reorder_standard_cells(std::vector<index_t> const old_order, std::vector<index_t> const new_order);
     void reorder_cells(std::vector<index_t> const old_order, std::vector<index_t> const new_order, index_t row);
+
+    // Cut the rows in bands, with an offset of half a band every other call
+    row_bands get_row_bands();
 };
 
+/*
+ * Calls f(row_begin, row_end, view) to optimize the whole placement
+ *
+ * In the banded mode, the even bands are optimized concurrently, then the odd ones. A worker only moves
+ * the cells of its band (a cell spanning several rows belongs to the band of its first row) and sees the
+ * others at their position at the beginning of the phase, so the result does not depend on the number of threads.
+ * When some rows are flagged as active, only the runs of consecutive active rows are visited, sequentially.
+ */
+template<typename F>
+void for_each_row_band(detailed_placement & pl, F f){
+    if(not pl.active_rows_.empty()){
+        assert(pl.active_rows_.size() == pl.row_cnt());
+        std::vector<index_t> no_bands;
+        for(index_t r=0; r<pl.row_cnt(); ){
+            if(not pl.active_rows_[r]){ ++r; continue; }
+            index_t e = r;
+            while(e < pl.row_cnt() and pl.active_rows_[e]) ++e;
+            f(r, e, banded_placement(pl.plt_, pl.plt_, no_bands, 0));
+            r = e;
+        }
+        return;
+    }
+    if(pl.band_rows_ == 0 or 2*pl.band_rows_ > pl.row_cnt()){
+        std::vector<index_t> no_bands;
+        f(0, pl.row_cnt(), banded_placement(pl.plt_, pl.plt_, no_bands, 0));
+        return;
+    }
+
+    row_bands bands = pl.get_row_bands();
+    for(index_t phase=0; phase<2; ++phase){
+        placement_t frozen = pl.plt_;
+        #pragma omp parallel for schedule(dynamic)
+        for(index_t b=phase; b<bands.band_cnt(); b+=2){
+            f(bands.limits_[b], bands.limits_[b+1], banded_placement(pl.plt_, frozen, bands.cell_bands_, b));
+        }
+    }
+}
+
 void swaps_global_HPWL(netlist const & circuit, detailed_placement & pl, index_t row_extent, index_t cell_extent, bool try_flip = false);
 void swaps_global_RSMT(netlist const & circuit, detailed_placement & pl, index_t row_extent, index_t cell_extent, bool try_flip = false);
 
@@ -5,7 +5,8 @@
 namespace coloquinte{
 namespace dp{
 
-detailed_placement legalize(netlist const & circuit, placement_t const & pl, box<int_t> surface, int_t row_height);
+// When given, only the cells flagged in legalized are moved; the others are obstacles (incremental legalization)
+detailed_placement legalize(netlist const & circuit, placement_t const & pl, box<int_t> surface, int_t row_height, std::vector<char> const & legalized = std::vector<char>());
 void get_result(netlist const & circuit, detailed_placement const & dpl, placement_t & pl);
 
 } // namespace dp
@@ -5,6 +5,7 @@
 #include "common.hxx"
 
 #include <vector>
+#include <cstdint>
 
 namespace coloquinte{
 namespace gp{
@@ -24,7 +25,11 @@ struct matrix_triplet{
     bool operator<(matrix_triplet const o){ return r_ < o.r_ || (r_ == o.r_ && c_ < o.c_); }
 };
 
+class assembled_system;
+
 class linear_system{
+    friend class assembled_system;
+
     std::vector<matrix_triplet> matrix_;
     std::vector<float_t> target_;
     index_t internal_size_;
@@ -80,6 +85,58 @@ class linear_system{
     std::vector<float_t> solve_CG(std::vector<float_t> guess, index_t nbr_iter);
 };
 
+// The classical compressed sparse row storage
+struct csr_matrix{
+    std::vector<std::uint32_t> row_limits, col_indexes;
+    std::vector<float> values, diag;
+
+    std::vector<float> mul(std::vector<float> const & x) const;
+    std::vector<float> solve_CG(std::vector<float> const & goal, std::vector<float> guess, std::uint32_t min_iter, std::uint32_t max_iter, float tol) const;
+    csr_matrix(){}
+    csr_matrix(std::vector<std::uint32_t> const & row_l, std::vector<std::uint32_t> const & col_i, std::vector<float> const & vals, std::vector<float> const D);
+};
+
+/*
+ * A compressed linear system which keeps its sparsity pattern between successive assemblies
+ *
+ * The triplets of a linear_system are scattered to the compressed storage through a gather map (for each
+ * non-zero, the list of the triplets summed into it). When a new system has the same triplet structure
+ * as the previous one, only the values and the right-hand side are refreshed, in parallel and without any
+ * allocation or sorting. If the triplets all fall into the current pattern, only the gather map is rebuilt;
+ * otherwise the pattern is computed again.
+ */
+class assembled_system{
+    csr_matrix matrix_;
+    std::vector<float_t> target_;
+    index_t internal_size_;
+
+    std::vector<std::uint64_t> keys_;          // Row and column of each triplet of the last assembly
+    std::vector<std::uint32_t> slots_;         // Value slot of each triplet: off-diagonal values, then the diagonal
+    std::vector<std::uint32_t> gather_limits_; // For each value slot, its range in gather_
+    std::vector<std::uint32_t> gather_;        // Triplet indices, grouped by value slot
+
+    index_t pattern_builds_, pattern_reuses_;
+
+    bool map_to_pattern(std::vector<matrix_triplet> const & triplets);
+    void build_pattern(std::vector<matrix_triplet> const & triplets, index_t n);
+    void build_gather(index_t triplet_cnt);
+    void refresh_values(std::vector<matrix_triplet> const & triplets);
+
+    public:
+    assembled_system() : internal_size_(0), pattern_builds_(0), pattern_reuses_(0){}
+
+    // Returns true if the sparsity pattern of the previous assembly was kept
+    bool assemble(linear_system const & L);
+    std::vector<float_t> solve_CG(std::vector<float_t> guess, index_t nbr_iter) const;
+
+    index_t size() const{ return target_.size(); }
+    index_t internal_size() const{ return internal_size_; }
+    index_t nonzero_cnt() const{ return matrix_.values.size() + matrix_.diag.size(); }
+    index_t pattern_builds() const{ return pattern_builds_; }
+    index_t pattern_reuses() const{ return pattern_reuses_; }
+    void clear();
+};
+
 } // namespace gp
 } // namespace coloquinte
 
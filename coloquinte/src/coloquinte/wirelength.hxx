@@ -0,0 +1,64 @@
+#ifndef COLOQUINTE_GP_WIRELENGTH
+#define COLOQUINTE_GP_WIRELENGTH
+
+#include "common.hxx"
+#include "netlist.hxx"
+
+#include <vector>
+#include <cstdint>
+
+namespace coloquinte{
+namespace gp{
+
+/*
+ * Wirelength of a placement, kept up to date between successive calls
+ *
+ * The pins are copied once in a flat array sorted by net, with the offsets for both orientations.
+ * Each update compares the placement with the last one seen and only recomputes the nets touching
+ * a moved cell; when too many cells moved, every net is recomputed in parallel instead.
+ * The Steiner lengths go through the lookup tables, so they are only computed when asked for.
+ * The results are exactly those of get_HPWL_wirelength() and get_RSMT_wirelength().
+ */
+class wirelength_tracker{
+    // Flat pin storage, sorted by net
+    std::vector<index_t>       net_limits_;
+    std::vector<index_t>       pin_cells_;
+    std::vector<point<int_t> > pin_offsets_, pin_flipped_offsets_; // Pin positions relative to the cell, for both orientations
+
+    // From cells to nets
+    std::vector<index_t>       cell_limits_;
+    std::vector<index_t>       cell_nets_;
+
+    // The last placement seen
+    std::vector<point<int_t> > positions_;
+    std::vector<point<bool> >  orientations_;
+
+    std::vector<std::int64_t>  net_HPWL_, net_RSMT_;
+    std::vector<index_t>       dirty_RSMT_;  // Nets whose Steiner length is outdated
+    std::vector<char>          is_dirty_RSMT_;
+    std::int64_t               HPWL_, RSMT_;
+    bool                       initialized_;
+
+    std::int64_t compute_HPWL(index_t n) const;
+    std::int64_t compute_RSMT(index_t n) const;
+    void full_update(placement_t const & pl);
+    void update_RSMT();
+
+    public:
+    wirelength_tracker(netlist const & circuit);
+
+    // Take the new placement into account, recomputing only what changed
+    void update(placement_t const & pl);
+
+    std::int64_t get_HPWL(placement_t const & pl){ update(pl); return HPWL_; }
+    std::int64_t get_RSMT(placement_t const & pl){ update(pl); update_RSMT(); return RSMT_; }
+
+    std::int64_t get_net_HPWL(index_t n) const{ return net_HPWL_[n]; }
+    index_t net_cnt() const{ return net_HPWL_.size(); }
+};
+
+} // namespace gp
+} // namespace coloquinte
+
+#endif
+
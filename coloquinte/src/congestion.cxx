@@ -0,0 +1,203 @@
+#include "coloquinte/congestion.hxx"
+
+#include <algorithm>
+#include <limits>
+#include <cassert>
+
+namespace coloquinte{
+namespace gp{
+
+congestion_map::congestion_map(netlist const & circuit, box<int_t> surface, int_t bin_size) : initialized_(false), surface_(surface), bin_size_(std::max<int_t>(bin_size, 1)){
+    net_limits_.push_back(0);
+    for(index_t n=0; n<circuit.net_cnt(); ++n){
+        for(auto p : circuit.get_net(n)){
+            point<int_t> size = circuit.get_cell(p.cell_ind).size;
+            pin_cells_.push_back(p.cell_ind);
+            pin_offsets_.push_back(p.offset);
+            pin_flipped_offsets_.push_back(size - p.offset);
+        }
+        net_limits_.push_back(pin_cells_.size());
+        net_weights_.push_back(static_cast<float_t>(circuit.get_net(n).weight));
+    }
+
+    cell_limits_.push_back(0);
+    for(index_t c=0; c<circuit.cell_cnt(); ++c){
+        index_t begin = cell_nets_.size();
+        for(auto p : circuit.get_cell(c)){
+            cell_nets_.push_back(p.net_ind);
+        }
+        std::sort(cell_nets_.begin() + begin, cell_nets_.end());
+        cell_nets_.resize(std::unique(cell_nets_.begin() + begin, cell_nets_.end()) - cell_nets_.begin());
+        cell_limits_.push_back(cell_nets_.size());
+    }
+
+    net_boxes_.resize(circuit.net_cnt());
+    x_cnt_ = std::max<index_t>(1, (surface_.x_max_ - surface_.x_min_ + bin_size_ - 1) / bin_size_);
+    y_cnt_ = std::max<index_t>(1, (surface_.y_max_ - surface_.y_min_ + bin_size_ - 1) / bin_size_);
+    demands_.assign(x_cnt_ * y_cnt_, 0.0);
+}
+
+box<int_t> congestion_map::get_bin(index_t x, index_t y) const{
+    return box<int_t>(
+        surface_.x_min_ + x * bin_size_, std::min<int_t>(surface_.x_max_, surface_.x_min_ + (x+1) * bin_size_),
+        surface_.y_min_ + y * bin_size_, std::min<int_t>(surface_.y_max_, surface_.y_min_ + (y+1) * bin_size_)
+    );
+}
+
+box<int_t> congestion_map::compute_box(index_t n) const{
+    index_t const b = net_limits_[n], e = net_limits_[n+1];
+    box<int_t> ret(std::numeric_limits<int_t>::max(), std::numeric_limits<int_t>::min(), std::numeric_limits<int_t>::max(), std::numeric_limits<int_t>::min());
+    if(e - b <= 1) return ret;
+    for(index_t p=b; p<e; ++p){
+        index_t const c = pin_cells_[p];
+        int_t const x = positions_[c].x_ + (orientations_[c].x_ ? pin_offsets_[p].x_ : pin_flipped_offsets_[p].x_);
+        int_t const y = positions_[c].y_ + (orientations_[c].y_ ? pin_offsets_[p].y_ : pin_flipped_offsets_[p].y_);
+        ret.x_min_ = std::min(ret.x_min_, x); ret.x_max_ = std::max(ret.x_max_, x);
+        ret.y_min_ = std::min(ret.y_min_, y); ret.y_max_ = std::max(ret.y_max_, y);
+    }
+    return ret;
+}
+
+void congestion_map::add_net(std::vector<double> & demands, box<int_t> const b, double weight) const{
+    if(b.x_min_ > b.x_max_) return; // Nets with less than two pins
+
+    // Straight nets still need one track: the box is at least one unit wide
+    box<int_t> r = b;
+    if(r.x_max_ == r.x_min_) ++r.x_max_;
+    if(r.y_max_ == r.y_min_) ++r.y_max_;
+    double w = r.x_max_ - r.x_min_, h = r.y_max_ - r.y_min_;
+    double density = weight * (w + h) / (w * h);
+
+    int_t const x_b = std::min<int_t>(x_cnt_-1, std::max<int_t>(0, (r.x_min_ - surface_.x_min_) / bin_size_));
+    int_t const x_e = std::min<int_t>(x_cnt_-1, std::max<int_t>(0, (r.x_max_ - 1 - surface_.x_min_) / bin_size_));
+    int_t const y_b = std::min<int_t>(y_cnt_-1, std::max<int_t>(0, (r.y_min_ - surface_.y_min_) / bin_size_));
+    int_t const y_e = std::min<int_t>(y_cnt_-1, std::max<int_t>(0, (r.y_max_ - 1 - surface_.y_min_) / bin_size_));
+    // The border bins extend to infinity, so that pins outside of the surface are accounted for
+    for(int_t y=y_b; y<=y_e; ++y){
+        int_t const y_lo = y == 0        ? r.y_min_ : std::max(r.y_min_, surface_.y_min_ + y * bin_size_);
+        int_t const y_hi = y == static_cast<int_t>(y_cnt_)-1 ? r.y_max_ : std::min(r.y_max_, surface_.y_min_ + (y+1) * bin_size_);
+        for(int_t x=x_b; x<=x_e; ++x){
+            int_t const x_lo = x == 0        ? r.x_min_ : std::max(r.x_min_, surface_.x_min_ + x * bin_size_);
+            int_t const x_hi = x == static_cast<int_t>(x_cnt_)-1 ? r.x_max_ : std::min(r.x_max_, surface_.x_min_ + (x+1) * bin_size_);
+            demands[y*x_cnt_ + x] += density * static_cast<double>(x_hi - x_lo) * static_cast<double>(y_hi - y_lo);
+        }
+    }
+}
+
+void congestion_map::full_update(placement_t const & pl){
+    positions_ = pl.positions_;
+    orientations_ = pl.orientations_;
+
+    #pragma omp parallel for schedule(static, 1024)
+    for(index_t n=0; n<net_boxes_.size(); ++n){
+        net_boxes_[n] = compute_box(n);
+    }
+
+    // The nets are split in a fixed number of blocks, each summed in its own grid,
+    // and the grids are added in block order: the rounding does not depend on the
+    // number of threads nor on their scheduling
+    index_t const block_cnt = std::min<index_t>(16, (net_boxes_.size() + 4095) / 4096);
+    index_t const block_len = block_cnt > 0 ? (net_boxes_.size() + block_cnt - 1) / block_cnt : 0;
+    std::vector<std::vector<double> > partial(block_cnt, std::vector<double>(demands_.size(), 0.0));
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(index_t b=0; b<block_cnt; ++b){
+        index_t const end = std::min<index_t>(net_boxes_.size(), (b+1) * block_len);
+        for(index_t n=b*block_len; n<end; ++n){
+            add_net(partial[b], net_boxes_[n], net_weights_[n]);
+        }
+    }
+
+    #pragma omp parallel for schedule(static)
+    for(index_t i=0; i<demands_.size(); ++i){
+        double d = 0.0;
+        for(index_t b=0; b<block_cnt; ++b){
+            d += partial[b][i];
+        }
+        demands_[i] = d;
+    }
+    initialized_ = true;
+}
+
+void congestion_map::update(placement_t const & pl){
+    assert(pl.cell_cnt() == cell_limits_.size()-1);
+    if(not initialized_){
+        full_update(pl);
+        return;
+    }
+
+    std::vector<index_t> moved;
+    for(index_t c=0; c<pl.cell_cnt(); ++c){
+        if(pl.positions_[c].x_ != positions_[c].x_ or pl.positions_[c].y_ != positions_[c].y_
+        or pl.orientations_[c].x_ != orientations_[c].x_ or pl.orientations_[c].y_ != orientations_[c].y_){
+            moved.push_back(c);
+        }
+    }
+    if(moved.empty()) return;
+
+    // Beyond this point it is cheaper to recompute everything, and it avoids accumulating rounding errors
+    if(moved.size() > pl.cell_cnt() / 8){
+        full_update(pl);
+        return;
+    }
+
+    std::vector<index_t> nets;
+    for(index_t c : moved){
+        positions_[c] = pl.positions_[c];
+        orientations_[c] = pl.orientations_[c];
+        nets.insert(nets.end(), cell_nets_.begin() + cell_limits_[c], cell_nets_.begin() + cell_limits_[c+1]);
+    }
+    std::sort(nets.begin(), nets.end());
+    nets.resize(std::unique(nets.begin(), nets.end()) - nets.begin());
+
+    std::vector<box<int_t> > new_boxes(nets.size());
+    #pragma omp parallel for if(nets.size() > 4096)
+    for(index_t i=0; i<nets.size(); ++i){
+        new_boxes[i] = compute_box(nets[i]);
+    }
+
+    for(index_t i=0; i<nets.size(); ++i){
+        index_t n = nets[i];
+        box<int_t> const o = net_boxes_[n], b = new_boxes[i];
+        if(o.x_min_ == b.x_min_ and o.x_max_ == b.x_max_ and o.y_min_ == b.y_min_ and o.y_max_ == b.y_max_) continue;
+        add_net(demands_, o, -net_weights_[n]);
+        add_net(demands_, b,  net_weights_[n]);
+        net_boxes_[n] = b;
+    }
+}
+
+float_t congestion_map::get_congestion(index_t x, index_t y, float_t capacity) const{
+    box<int_t> b = get_bin(x, y);
+    double area = static_cast<double>(b.x_max_ - b.x_min_) * static_cast<double>(b.y_max_ - b.y_min_);
+    if(area <= 0.0) return 0.0f;
+    return static_cast<float_t>(get_demand(x, y) / (area * capacity));
+}
+
+float_t congestion_map::get_max_congestion(float_t capacity) const{
+    float_t ret = 0.0f;
+    for(index_t y=0; y<y_cnt_; ++y){
+        for(index_t x=0; x<x_cnt_; ++x){
+            ret = std::max(ret, get_congestion(x, y, capacity));
+        }
+    }
+    return ret;
+}
+
+density_restrictions congestion_map::get_density_limits(float_t capacity, float_t threshold, float_t min_density) const{
+    density_restrictions ret;
+    for(index_t y=0; y<y_cnt_; ++y){
+        for(index_t x=0; x<x_cnt_; ++x){
+            float_t congestion = get_congestion(x, y, capacity);
+            if(congestion > threshold){
+                density_limit cur;
+                cur.box_ = get_bin(x, y);
+                cur.density_ = std::max(min_density, threshold / congestion);
+                ret.push_back(cur);
+            }
+        }
+    }
+    return ret;
+}
+
+} // namespace gp
+} // namespace coloquinte
+
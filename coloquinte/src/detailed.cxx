@@ -20,7 +20,9 @@ detailed_placement::detailed_placement(
         plt_(pl),
         cell_rows_(placement_rows),
         min_x_(min_x), max_x_(max_x),
-        y_origin_(y_origin)
+        y_origin_(y_origin),
+        band_rows_(0),
+        band_pass_(0)
     {
 
     assert(row_height > 0);
@@ -246,7 +248,34 @@ void detailed_placement::reorder_standard_cells(std::vector<index_t> const old_o
     else row_last_cells_[r] = new_order.back(); 
 }
 
+row_bands detailed_placement::get_row_bands(){
+    assert(band_rows_ > 0);
+    row_bands ret;
+    index_t offset = (band_pass_ % 2 != 0) ? band_rows_/2 : 0;
+    ++band_pass_;
+
+    ret.limits_.push_back(0);
+    for(index_t r=offset; r<row_cnt(); r+=band_rows_){
+        if(r > 0) ret.limits_.push_back(r);
+    }
+    ret.limits_.push_back(row_cnt());
+
+    std::vector<index_t> row_bands(row_cnt());
+    for(index_t b=0; b<ret.band_cnt(); ++b){
+        for(index_t r=ret.limits_[b]; r<ret.limits_[b+1]; ++r){
+            row_bands[r] = b;
+        }
+    }
+    ret.cell_bands_.resize(cell_cnt());
+    for(index_t c=0; c<cell_cnt(); ++c){
+        // Fixed cells outside of the placement area have no row
+        ret.cell_bands_[c] = cell_height(c) != 0 ? row_bands[cell_rows_[c]] : null_ind;
+    }
+    return ret;
+}
+
 void row_compatible_orientation(netlist const & circuit, detailed_placement & pl, bool first_row_orient){
+    #pragma omp parallel for
     for(index_t c=0; c<circuit.cell_cnt(); ++c){
         if( (circuit.get_cell(c).attributes & YFlippable) != 0 and pl.cell_height(c) == 1){
             pl.plt_.orientations_[c].y_ = (pl.cell_rows_[c] % 2 != 0) ^ first_row_orient;
@@ -353,7 +353,7 @@ std::vector<cell_leg_properties> good_legalize(
 }
 
 
-detailed_placement legalize(netlist const & circuit, placement_t const & pl, box<int_t> surface, int_t row_height){
+detailed_placement legalize(netlist const & circuit, placement_t const & pl, box<int_t> surface, int_t row_height, std::vector<char> const & legalized){
     if(row_height <= 0) throw std::runtime_error("The rows' height should be positive\n");
 
     index_t nbr_rows = (surface.y_max_ - surface.y_min_) / row_height;
@@ -369,7 +369,7 @@ detailed_placement legalize(netlist const & circuit, placement_t const & pl, box
     for(index_t i=0; i<circuit.cell_cnt(); ++i){
         auto cur = circuit.get_cell(i);
         // Assumes fixed if not both XMovable and YMovable
-        if( (cur.attributes & XMovable) != 0 && (cur.attributes & YMovable) != 0){
+        if( (cur.attributes & XMovable) != 0 && (cur.attributes & YMovable) != 0 && (legalized.empty() || legalized[i])){
             // Just truncate the position we target
             point<int_t> target_pos = pl.positions_[i];
             index_t cur_cell_rows = (cur.size.y_ + row_height -1) / row_height;
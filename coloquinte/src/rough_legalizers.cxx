@@ -300,6 +300,8 @@ void region_distribution::x_bipartition(){
     index_t old_y_regions_cnt = y_regions_cnt();
     x_regions_cnt_ *= 2;
 
+    // Each old region is split into its own pair of new regions: no conflict
+    #pragma omp parallel for schedule(dynamic)
     for(index_t x=0; x < old_x_regions_cnt; ++x){
         for(index_t y=0; y < old_y_regions_cnt; ++y){
             index_t i = y * old_x_regions_cnt + x;
@@ -316,6 +318,7 @@ void region_distribution::y_bipartition(){
     index_t old_y_regions_cnt = y_regions_cnt();
     y_regions_cnt_ *= 2;
 
+    #pragma omp parallel for schedule(dynamic)
     for(index_t x=0; x < old_x_regions_cnt; ++x){
         for(index_t y=0; y < old_y_regions_cnt; ++y){
             index_t i = y * old_x_regions_cnt + x;
@@ -489,6 +492,7 @@ void region_distribution::multipartition(index_t x_width, index_t y_width){
     x_regions_cnt_ *= x_width;
     y_regions_cnt_ *= y_width;
 
+    #pragma omp parallel for schedule(dynamic)
     for(index_t x=0; x < old_x_regions_cnt; ++x){
         for(index_t y=0; y < old_y_regions_cnt; ++y){
 
@@ -598,21 +602,29 @@ void region_distribution::redo_multipartitions(index_t x_width, index_t y_width)
         region::redistribute_cells(to_opt);
     };
 
-    auto const optimize_on_y = [&](index_t y){
-        for(index_t x=0; x < x_regions_cnt(); x+=x_width){
-            if(x+x_width < x_regions_cnt()){
-                reoptimize_group(x+x_width/2, y);
+    // The windows are processed in four phases: shifted or aligned on y, then on x.
+    // Inside a phase the windows do not overlap and are optimized concurrently;
+    // since each window only touches its own regions the result does not depend
+    // on the scheduling.
+    auto const optimize_phase = [&](index_t y_shift, index_t x_shift){
+        std::vector<std::pair<index_t, index_t> > groups;
+        for(index_t y=0; y < y_regions_cnt(); y+=y_width){
+            if(y_shift != 0 and y+y_width >= y_regions_cnt()) continue;
+            for(index_t x=0; x < x_regions_cnt(); x+=x_width){
+                if(x_shift != 0 and x+x_width >= x_regions_cnt()) continue;
+                groups.push_back(std::pair<index_t, index_t>(x+x_shift, y+y_shift));
             }
-            reoptimize_group(x, y);
+        }
+        #pragma omp parallel for schedule(dynamic)
+        for(index_t i=0; i<groups.size(); ++i){
+            reoptimize_group(groups[i].first, groups[i].second);
         }
     };
 
-    for(index_t y=0; y < y_regions_cnt(); y+=y_width){
-        if(y+y_width < y_regions_cnt()){
-            optimize_on_y(y+y_width/2);
-        }
-        optimize_on_y(y);
-    }
+    optimize_phase(y_width/2, x_width/2);
+    optimize_phase(y_width/2, 0);
+    optimize_phase(0, x_width/2);
+    optimize_phase(0, 0);
 }
 
 inline void region_distribution::region::distribute_new_cells(std::vector<std::reference_wrapper<region> > regions, std::vector<cell_ref> cells, std::function<float_t (point<float_t>)> coord){
@@ -790,13 +802,19 @@ void region_distribution::redo_diag_partitions(index_t len){
         }
     };
 
-    for(index_t y=y_regions_cnt()-2; y >= 1; --y)
+    // Distinct diagonals are disjoint sets of regions: each one is a task
+    // OpenMP doesn't allow y+1 < y_regions_cnt(), but here both counts are >= 2
+    #pragma omp parallel for schedule(dynamic)
+    for(index_t y=1; y < y_regions_cnt()-1; ++y)
         reoptimize_rdiag(0, y);
-    for(index_t x=0; x+1<x_regions_cnt(); ++x)
+    #pragma omp parallel for schedule(dynamic)
+    for(index_t x=0; x < x_regions_cnt()-1; ++x)
         reoptimize_rdiag(x, 0);
-    for(index_t y=1; y+1<y_regions_cnt(); ++y)
+    #pragma omp parallel for schedule(dynamic)
+    for(index_t y=1; y < y_regions_cnt()-1; ++y)
         reoptimize_ldiag(0, y);
-    for(index_t x=0; x+1<x_regions_cnt(); ++x)
+    #pragma omp parallel for schedule(dynamic)
+    for(index_t x=0; x < x_regions_cnt()-1; ++x)
         reoptimize_ldiag(x, y_regions_cnt()-1);
 }
 
@@ -173,7 +173,7 @@ struct Hnet_group{
 
 };
 
-Hnet_group get_B2B_netgroup(netlist const & circuit, detailed_placement const & pl, std::vector<index_t> const & cells){
+Hnet_group get_B2B_netgroup(netlist const & circuit, banded_placement const & view, std::vector<index_t> const & cells){
 
     std::vector<order_gettr> cells_in_row = get_sorted_ordered_cells(cells);
     std::vector<index_t> involved_nets = get_unique_nets(circuit, cells);
@@ -183,7 +183,7 @@ Hnet_group get_B2B_netgroup(netlist const & circuit, detailed_placement const &
         ret.cell_widths.push_back(circuit.get_cell(c).size.x_);
 
     for(index_t n : involved_nets){
-        std::vector<pin_1D> cur_pins = get_pins_1D(circuit, pl.plt_, n).x_;
+        std::vector<pin_1D> cur_pins = get_pins_1D(circuit, view, n).x_;
         for(pin_1D & p : cur_pins){
             auto it = std::lower_bound(cells_in_row.begin(), cells_in_row.end(), p.cell_ind);
             if(it != cells_in_row.end() and it->cell_ind == p.cell_ind){
@@ -199,7 +199,7 @@ Hnet_group get_B2B_netgroup(netlist const & circuit, detailed_placement const &
     return ret;
 }
 
-Hnet_group get_RSMT_netgroup(netlist const & circuit, detailed_placement const & pl, std::vector<index_t> const & cells){
+Hnet_group get_RSMT_netgroup(netlist const & circuit, banded_placement const & view, std::vector<index_t> const & cells){
 
     std::vector<order_gettr> cells_in_row = get_sorted_ordered_cells(cells);
     std::vector<index_t> involved_nets = get_unique_nets(circuit, cells);
@@ -209,7 +209,7 @@ Hnet_group get_RSMT_netgroup(netlist const & circuit, detailed_placement const &
         ret.cell_widths.push_back(circuit.get_cell(c).size.x_);
 
     for(index_t n : involved_nets){
-        auto vpins = get_pins_2D(circuit, pl.plt_, n);
+        auto vpins = get_pins_2D(circuit, view, n);
         for(auto & p : vpins){
             auto it = std::lower_bound(cells_in_row.begin(), cells_in_row.end(), p.cell_ind);
             if(it != cells_in_row.end() and it->cell_ind == p.cell_ind){
@@ -428,21 +428,30 @@ inline std::int64_t optimize_noncvx_sequence(Hnet_group const & nets, std::vecto
     return nets.get_cost(permuted_positions, permuted_flippings);
 }
 
-std::vector<std::pair<int_t, int_t> > get_cell_ranges(netlist const & circuit, detailed_placement const & pl, std::vector<index_t> const & cells){
+// In the banded mode, a cell spanning several rows may have neighbours in another band: its own extent is used as the limit instead
+std::pair<int_t, int_t> get_row_limit_positions(netlist const & circuit, detailed_placement const & pl, banded_placement const & view, index_t c){
+    if(view.is_banded() and pl.cell_height(c) != 1){
+        int_t pos = cell_placement(view, c).positions_[c].x_;
+        return std::pair<int_t, int_t>(pos, pos + circuit.get_cell(c).size.x_);
+    }
+    return pl.get_limit_positions(circuit, c);
+}
+
+std::vector<std::pair<int_t, int_t> > get_cell_ranges(netlist const & circuit, detailed_placement const & pl, banded_placement const & view, std::vector<index_t> const & cells){
     std::vector<std::pair<int_t, int_t> > lims;
 
     for(index_t i=0; i+1<cells.size(); ++i){
-        assert(pl.plt_.positions_[cells[i]].x_ + circuit.get_cell(cells[i]).size.x_ <= pl.plt_.positions_[cells[i+1]].x_);
+        assert(cell_placement(view, cells[i]).positions_[cells[i]].x_ + circuit.get_cell(cells[i]).size.x_ <= cell_placement(view, cells[i+1]).positions_[cells[i+1]].x_);
     }
 
     // Extreme limits, except macros are allowed to be beyond the limit of the placement area
-    int_t lower_lim = pl.get_limit_positions(circuit, cells.front()).first;
-    int_t upper_lim = pl.get_limit_positions(circuit, cells.back()).second;
+    int_t lower_lim = get_row_limit_positions(circuit, pl, view, cells.front()).first;
+    int_t upper_lim = get_row_limit_positions(circuit, pl, view, cells.back()).second;
 
     for(index_t OSRP_cell : cells){
         auto attr = circuit.get_cell(OSRP_cell).attributes;
         auto cur_lim = std::pair<int_t, int_t>(lower_lim, upper_lim);
-        int_t pos = pl.plt_.positions_[OSRP_cell].x_;
+        int_t pos = cell_placement(view, OSRP_cell).positions_[OSRP_cell].x_;
         if( (attr & XMovable) == 0 or pl.cell_height(OSRP_cell) != 1){
             cur_lim = std::pair<int_t, int_t>(pos, pos + circuit.get_cell(OSRP_cell).size.x_);
         }
@@ -458,7 +467,8 @@ std::vector<std::pair<int_t, int_t> > get_cell_ranges(netlist const & circuit, d
 
 template<bool NON_CONVEX, bool RSMT>
 void OSRP_generic(netlist const & circuit, detailed_placement & pl){
-    for(index_t r=0; r<pl.row_cnt(); ++r){
+    for_each_row_band(pl, [&](index_t row_begin, index_t row_end, banded_placement const & view){
+    for(index_t r=row_begin; r<row_end; ++r){
         // Complete optimization on a row, comprising possible obstacles
 
         std::vector<index_t> cells;
@@ -472,11 +482,11 @@ void OSRP_generic(netlist const & circuit, detailed_placement & pl){
         }
 
         if(not cells.empty()){
-            std::vector<std::pair<int_t, int_t> > lims = get_cell_ranges(circuit, pl, cells); // Limit positions for each cell
+            std::vector<std::pair<int_t, int_t> > lims = get_cell_ranges(circuit, pl, view, cells); // Limit positions for each cell
 
             Hnet_group nets = RSMT ?
-                get_RSMT_netgroup(circuit, pl, cells)
-             :  get_B2B_netgroup(circuit, pl, cells);
+                get_RSMT_netgroup(circuit, view, cells)
+             :  get_B2B_netgroup(circuit, view, cells);
 
             std::vector<index_t> no_permutation(cells.size());
             for(index_t i=0; i<cells.size(); ++i) no_permutation[i] = i;
@@ -486,6 +496,7 @@ void OSRP_generic(netlist const & circuit, detailed_placement & pl){
                 std::vector<int> flipped;
                 optimize_noncvx_sequence(nets, no_permutation, final_positions, flipped, flippability, lims);
                 for(index_t i=0; i<cells.size(); ++i){
+                    if(not view.is_live(cells[i])) continue; // Belongs to another band
                     bool old_orient = pl.plt_.orientations_[cells[i]].x_;
                     pl.plt_.orientations_[cells[i]].x_ = flipped[i] ? not old_orient : old_orient;
                 }
@@ -496,10 +507,12 @@ void OSRP_generic(netlist const & circuit, detailed_placement & pl){
 
             // Update the positions and orientations
             for(index_t i=0; i<cells.size(); ++i){
-                pl.plt_.positions_[cells[i]].x_ = final_positions[i];
+                if(view.is_live(cells[i]))
+                    pl.plt_.positions_[cells[i]].x_ = final_positions[i];
             }
         }
     } // Iteration on the rows
+    });
 
     pl.selfcheck();
 }
@@ -508,7 +521,8 @@ template<bool NON_CONVEX, bool RSMT>
 void swaps_row_generic(netlist const & circuit, detailed_placement & pl, index_t range){
     assert(range >= 2);
 
-    for(index_t r=0; r<pl.row_cnt(); ++r){
+    for_each_row_band(pl, [&](index_t row_begin, index_t row_end, banded_placement const & view){
+    for(index_t r=row_begin; r<row_end; ++r){
         index_t OSRP_cell = pl.get_first_cell_on_row(r);
 
         while(OSRP_cell != null_ind){
@@ -526,11 +540,11 @@ void swaps_row_generic(netlist const & circuit, detailed_placement & pl, index_t
             }
 
             if(not cells.empty()){
-                std::vector<std::pair<int_t, int_t> > lims = get_cell_ranges(circuit, pl, cells); // Limit positions for each cell
+                std::vector<std::pair<int_t, int_t> > lims = get_cell_ranges(circuit, pl, view, cells); // Limit positions for each cell
 
                 Hnet_group nets = RSMT ?
-                    get_RSMT_netgroup(circuit, pl, cells)
-                 :  get_B2B_netgroup(circuit, pl, cells);
+                    get_RSMT_netgroup(circuit, view, cells)
+                 :  get_B2B_netgroup(circuit, view, cells);
 
                 std::int64_t best_cost = std::numeric_limits<std::int64_t>::max();
                 std::vector<int_t> positions(cells.size());
@@ -560,6 +574,7 @@ void swaps_row_generic(netlist const & circuit, detailed_placement & pl, index_t
                 for(index_t i=0; i<cells.size(); ++i){
                     index_t r_ind = best_permutation[i]; // In the row from in the Hnet_group
                     new_cell_order[r_ind] = cells[i];
+                    if(not view.is_live(cells[i])) continue; // Belongs to another band, hence fixed here
                     pl.plt_.positions_[cells[i]].x_ = best_positions[r_ind];
                     if(NON_CONVEX){
                         bool old_orient = pl.plt_.orientations_[cells[i]].x_;
@@ -579,6 +594,7 @@ void swaps_row_generic(netlist const & circuit, detailed_placement & pl, index_t
             }
         } // Iteration on the entire row
     } // Iteration on the rows
+    });
 
     pl.selfcheck();
 }
@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <stdexcept>
+#include <algorithm>
 
 namespace coloquinte{
 namespace gp{
@@ -11,6 +12,7 @@ linear_system linear_system::operator+(linear_system const & o) const{
     if(o.internal_size() != internal_size()){ throw std::runtime_error("Mismatched system sizes"); }
     linear_system ret(target_.size() + o.target_.size() - internal_size(), internal_size());
 
+    ret.matrix_.reserve(matrix_.size() + o.matrix_.size());
     ret.matrix_ = matrix_;
     std::vector<matrix_triplet> omatrix = o.matrix_;
     for(matrix_triplet & t : omatrix){
@@ -38,18 +40,10 @@ linear_system linear_system::operator+(linear_system const & o) const{
 }
 
 
-// The classical compressed sparse row storage
-struct csr_matrix{
-    std::vector<std::uint32_t> row_limits, col_indexes;
-    std::vector<float> values, diag;
-
-    std::vector<float> mul(std::vector<float> const & x) const;
-    std::vector<float> solve_CG(std::vector<float> const & goal, std::vector<float> guess, std::uint32_t min_iter, std::uint32_t max_iter, float tol) const;
-    csr_matrix(std::vector<std::uint32_t> const & row_l, std::vector<std::uint32_t> const & col_i, std::vector<float> const & vals, std::vector<float> const D) : row_limits(row_l), col_indexes(col_i), values(vals), diag(D){
-        assert(values.size() == col_indexes.size());
-        assert(diag.size()+1 == row_limits.size());
-    }
-};
+csr_matrix::csr_matrix(std::vector<std::uint32_t> const & row_l, std::vector<std::uint32_t> const & col_i, std::vector<float> const & vals, std::vector<float> const D) : row_limits(row_l), col_indexes(col_i), values(vals), diag(D){
+    assert(values.size() == col_indexes.size());
+    assert(diag.size()+1 == row_limits.size());
+}
 
 // A matrix with successive rows padded to the same length and accessed column-major; hopefully a little better
 template<std::uint32_t unroll_len>
@@ -70,153 +64,6 @@ struct ellpack_matrix{
     }
 };
 
-// The proxy matrix for compressed sparse storage
-class doublet_matrix{
-    std::vector<std::uint32_t> row_limits;
-    std::vector<matrix_doublet> doublets;
-    std::uint32_t size;
-
-    void get_compressed(std::vector<std::uint32_t> & limits, std::vector<matrix_doublet> & elements, std::vector<float> & diag) const;
-    public:
-    doublet_matrix(std::vector<matrix_triplet> const & triplets, std::uint32_t size);
-    csr_matrix get_compressed_matrix() const;
-    template<std::uint32_t unroll_len>
-    ellpack_matrix<unroll_len> get_ellpack_matrix() const;
-};
-
-doublet_matrix::doublet_matrix(std::vector<matrix_triplet> const & triplets, std::uint32_t n) : size(n){
-    row_limits.resize(size+1, 0);
-     // First store the row sizes in the array
-    for(uint32_t i=0; i<triplets.size(); ++i){
-        ++row_limits[triplets[i].r_+1];
-    }
-
-    // The total size of the uncompressed matrix
-    uint32_t tot_triplets=0;
-    // Get the beginning position of each row in the csr matrix
-    for(uint32_t i=1; i<n+1; ++i){
-        uint32_t new_tot_triplets = tot_triplets + row_limits[i];
-        row_limits[i] = tot_triplets; // Stores the beginning of the row
-        tot_triplets = new_tot_triplets;
-    }
-    assert(tot_triplets == triplets.size());
-
-    // Now we know the size and can allocate storage for the indices and values
-    doublets.resize(tot_triplets);
-    
-    // We store the triplets in the new storage and tranform beginning positions into end positions
-    for(uint32_t i=0; i<triplets.size(); ++i){
-        doublets[row_limits[triplets[i].r_+1]] = matrix_doublet(triplets[i].c_, triplets[i].val_);
-        ++row_limits[triplets[i].r_+1]; // row_limits will hold the end position of the row
-    }
-}
-
-void doublet_matrix::get_compressed(std::vector<std::uint32_t> & sizes, std::vector<matrix_doublet> & elements, std::vector<float> & diag) const{
-    assert(size+1 == row_limits.size());
-    sizes.resize(size);
-    diag.resize(size, 0.0);
-    std::vector<matrix_doublet> tmp_doublets = doublets;
-
-    for(uint32_t i=0; i<size; ++i){
-        // Sort the elements in the row
-        std::sort(tmp_doublets.begin() + row_limits[i], tmp_doublets.begin() + row_limits[i+1]);
-        // Compress them and extract the diagonal
-        std::uint32_t l=0;
-        matrix_doublet cur(tmp_doublets[row_limits[i]]);
-        for(uint32_t j=row_limits[i]+1; j<row_limits[i+1]; ++j){
-            if(tmp_doublets[j].c_ == cur.c_){
-                cur.val_ += tmp_doublets[j].val_;
-            }
-            else{
-                if(i != cur.c_){
-                    elements.push_back(cur);
-                    ++l;
-                }
-                else{
-                    diag[i] = cur.val_;
-                }
-                cur = tmp_doublets[j];
-            }
-        }
-        if(i != cur.c_){
-            elements.push_back(cur);
-            ++l;
-        }
-        else{
-            diag[i] = cur.val_;
-        }
-        sizes[i] = l;
-    }
-}
-
-csr_matrix doublet_matrix::get_compressed_matrix() const{
-    std::vector<matrix_doublet> tmp_doublets;
-    std::vector<std::uint32_t> sizes;
-    std::vector<float> diag;
-    get_compressed(sizes, tmp_doublets, diag);
-
-    // Get the limits of each row
-    std::vector<std::uint32_t> new_row_limits(row_limits.size());
-    new_row_limits[0] = 0;
-    for(std::uint32_t i=0; i<size; ++i){
-        new_row_limits[i+1] = new_row_limits[i] + sizes[i];
-    }
-
-    // Store the doublets to the sparse storage
-    std::vector<std::uint32_t> col_indices(tmp_doublets.size());
-    std::vector<float> values(tmp_doublets.size());
-    for(std::uint32_t i=0; i<tmp_doublets.size(); ++i){
-        col_indices[i] = tmp_doublets[i].c_;
-        values[i] = tmp_doublets[i].val_;
-    }
-
-    return csr_matrix(new_row_limits, col_indices, values, diag);
-}
-
-template<std::uint32_t unroll_len>
-ellpack_matrix<unroll_len> doublet_matrix::get_ellpack_matrix() const{
-    std::vector<matrix_doublet> tmp_doublets;
-    std::vector<std::uint32_t> sizes;
-    std::vector<float> diag;
-    get_compressed(sizes, tmp_doublets, diag);
-
-    std::uint32_t unrolled_size = (diag.size() % unroll_len == 0)? diag.size()/unroll_len : diag.size() / unroll_len + 1;
-    sizes.resize(unroll_len * unrolled_size, 0);
-    diag.resize(unroll_len * unrolled_size, 1.0);
-
-    // Store the maximum size of a group of rows
-    std::vector<std::uint32_t> new_row_limits(unrolled_size+1);
-    new_row_limits[0] = 0;
-    for(std::uint32_t i=0; i<unrolled_size; ++i){
-        std::uint32_t max_sz = sizes[unroll_len*i];
-        for(int j=1; j<unroll_len; ++j){
-            max_sz = std::max(max_sz, sizes[unroll_len*i + j]);
-        }
-        new_row_limits[i+1] = new_row_limits[i] + max_sz;
-    }
-
-    std::vector<std::uint32_t> col_indices(unroll_len * new_row_limits.back());
-    std::vector<float> values(unroll_len * new_row_limits.back());
-
-    std::uint32_t d = 0;
-    for(std::uint32_t i=0; i<sizes.size(); ++i){ // For every line
-        std::uint32_t ui = i/unroll_len;
-        std::uint32_t k = i%unroll_len;
-        std::uint32_t max_sz = new_row_limits[ui+1] - new_row_limits[ui];
-        std::uint32_t row_begin = new_row_limits[ui];
-        for(std::uint32_t j=0; j<sizes[i]; ++j, ++d){ // For the non-zero values
-            col_indices[unroll_len * (row_begin+j) + k] = tmp_doublets[d].c_;
-            values[unroll_len * (row_begin+j) + k] = tmp_doublets[d].val_;
-        }
-        for(std::uint32_t j=sizes[i]; j<max_sz; ++j){ // For the padding zeroes
-            col_indices[unroll_len * (row_begin+j) + k] = 0;
-            values[unroll_len * (row_begin+j) + k] = 0;
-        }
-    }
-    
-    return ellpack_matrix<unroll_len>(new_row_limits, col_indices, values, diag);
-}
-
 std::vector<float> csr_matrix::mul(std::vector<float> const & x) const{
     std::vector<float> res(x.size());
     assert(x.size() == diag.size());
@@ -366,11 +213,161 @@ std::vector<float> ellpack_matrix<unroll_len>::solve_CG(std::vector<float> goal,
 }
 
 std::vector<float_t> linear_system::solve_CG(std::vector<float_t> guess, index_t nbr_iter){
-    doublet_matrix tmp(matrix_, size());
-    csr_matrix mat = tmp.get_compressed_matrix();
-    //ellpack_matrix<16> mat = tmp.get_ellpack_matrix<16>();
+    assembled_system tmp;
+    tmp.assemble(*this);
+    return tmp.solve_CG(guess, nbr_iter);
+}
+
+void assembled_system::clear(){
+    matrix_ = csr_matrix();
+    target_.clear();
+    keys_.clear();
+    slots_.clear();
+    gather_limits_.clear();
+    gather_.clear();
+    internal_size_ = 0;
+}
+
+// Find the value slot of each triplet in the current pattern; fails if one of them is not part of it
+bool assembled_system::map_to_pattern(std::vector<matrix_triplet> const & triplets){
+    std::uint32_t const n = matrix_.diag.size();
+    std::uint32_t const nnz = matrix_.values.size();
+    std::uint32_t const * const cols = matrix_.col_indexes.data();
+    slots_.resize(triplets.size());
+
+    index_t missing = 0;
+    #pragma omp parallel for reduction(+:missing)
+    for(index_t i=0; i<triplets.size(); ++i){
+        matrix_triplet const t = triplets[i];
+        if(t.r_ >= n or t.c_ >= n){
+            ++missing;
+        }
+        else if(t.r_ == t.c_){
+            slots_[i] = nnz + t.r_;
+        }
+        else{
+            std::uint32_t const * b = cols + matrix_.row_limits[t.r_], * e = cols + matrix_.row_limits[t.r_+1];
+            std::uint32_t const * it = std::lower_bound(b, e, t.c_);
+            if(it == e or *it != t.c_) ++missing;
+            else slots_[i] = it - cols;
+        }
+    }
+    return missing == 0;
+}
+
+// Compute the sorted, deduplicated off-diagonal columns of each row
+void assembled_system::build_pattern(std::vector<matrix_triplet> const & triplets, index_t n){
+    std::vector<std::uint32_t> & limits = matrix_.row_limits;
+    std::vector<std::uint32_t> & cols = matrix_.col_indexes;
+
+    limits.assign(n+1, 0);
+    for(matrix_triplet const & t : triplets){
+        if(t.r_ != t.c_) ++limits[t.r_+1];
+    }
+    for(index_t i=0; i<n; ++i){
+        limits[i+1] += limits[i];
+    }
+    std::vector<std::uint32_t> ends(limits.begin(), limits.end()-1);
+    cols.resize(limits[n]);
+    for(matrix_triplet const & t : triplets){
+        if(t.r_ != t.c_) cols[ends[t.r_]++] = t.c_;
+    }
+
+    // Sort and compress each row in place, then pack the rows
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for(index_t i=0; i<n; ++i){
+        std::sort(cols.begin() + limits[i], cols.begin() + limits[i+1]);
+        ends[i] = std::unique(cols.begin() + limits[i], cols.begin() + limits[i+1]) - cols.begin();
+    }
+    std::uint32_t tot = 0;
+    for(index_t i=0; i<n; ++i){
+        std::uint32_t b = limits[i];
+        limits[i] = tot;
+        for(std::uint32_t j=b; j<ends[i]; ++j, ++tot){
+            cols[tot] = cols[j];
+        }
+    }
+    limits[n] = tot;
+    cols.resize(tot);
+
+    matrix_.values.resize(tot);
+    matrix_.diag.resize(n);
+}
+
+// Group the triplet indices by value slot, in increasing order so that the sums are reproducible
+void assembled_system::build_gather(index_t triplet_cnt){
+    index_t const slot_cnt = matrix_.values.size() + matrix_.diag.size();
+    gather_limits_.assign(slot_cnt+1, 0);
+    for(index_t i=0; i<triplet_cnt; ++i){
+        ++gather_limits_[slots_[i]+1];
+    }
+    std::uint32_t tot = 0;
+    for(index_t s=1; s<slot_cnt+1; ++s){
+        std::uint32_t new_tot = tot + gather_limits_[s];
+        gather_limits_[s] = tot; // Stores the beginning of slot s-1
+        tot = new_tot;
+    }
+    gather_.resize(triplet_cnt);
+    for(index_t i=0; i<triplet_cnt; ++i){
+        gather_[gather_limits_[slots_[i]+1]++] = i; // gather_limits_ will hold the end position of the slot
+    }
+}
+
+void assembled_system::refresh_values(std::vector<matrix_triplet> const & triplets){
+    index_t const nnz = matrix_.values.size();
+    index_t const slot_cnt = nnz + matrix_.diag.size();
+    #pragma omp parallel for schedule(static, 4096)
+    for(index_t s=0; s<slot_cnt; ++s){
+        float val = 0.0f;
+        for(std::uint32_t k=gather_limits_[s]; k<gather_limits_[s+1]; ++k){
+            val += triplets[gather_[k]].val_;
+        }
+        if(s < nnz) matrix_.values[s] = val;
+        else        matrix_.diag[s-nnz] = val;
+    }
+}
+
+bool assembled_system::assemble(linear_system const & L){
+    std::vector<matrix_triplet> const & triplets = L.matrix_;
+    index_t const n = L.size();
+    target_ = L.target_;
+    internal_size_ = L.internal_size();
+
+    // Same triplets in the same order: the scatter map is still valid
+    bool same = (n == matrix_.diag.size() and triplets.size() == keys_.size());
+    if(same){
+        index_t mismatches = 0;
+        #pragma omp parallel for reduction(+:mismatches)
+        for(index_t i=0; i<triplets.size(); ++i){
+            if(keys_[i] != ((static_cast<std::uint64_t>(triplets[i].r_) << 32) | triplets[i].c_)) ++mismatches;
+        }
+        same = (mismatches == 0);
+    }
+
+    bool reused = same;
+    if(not same){
+        reused = (n == matrix_.diag.size()) and map_to_pattern(triplets);
+        if(not reused){
+            build_pattern(triplets, n);
+            bool mapped = map_to_pattern(triplets);
+            assert(mapped); (void) mapped;
+        }
+        build_gather(triplets.size());
+        keys_.resize(triplets.size());
+        for(index_t i=0; i<triplets.size(); ++i){
+            keys_[i] = (static_cast<std::uint64_t>(triplets[i].r_) << 32) | triplets[i].c_;
+        }
+    }
+    if(reused) ++pattern_reuses_;
+    else       ++pattern_builds_;
+
+    refresh_values(triplets);
+    return reused;
+}
+
+std::vector<float_t> assembled_system::solve_CG(std::vector<float_t> guess, index_t nbr_iter) const{
     guess.resize(target_.size(), 0.0);
-    auto ret = mat.solve_CG(target_, guess, nbr_iter, nbr_iter, 0.0);
+    auto ret = matrix_.solve_CG(target_, guess, nbr_iter, nbr_iter, 0.0);
     ret.resize(internal_size());
     return ret;
 }
@@ -378,5 +375,3 @@ std::vector<float_t> linear_system::solve_CG(std::vector<float_t> guess, index_t
 }
 }
 
-
-
@@ -0,0 +1,157 @@
+#include "coloquinte/wirelength.hxx"
+#include "coloquinte/circuit_helper.hxx"
+
+#include <algorithm>
+#include <limits>
+#include <cassert>
+
+namespace coloquinte{
+namespace gp{
+
+wirelength_tracker::wirelength_tracker(netlist const & circuit) : HPWL_(0), RSMT_(0), initialized_(false){
+    net_limits_.push_back(0);
+    for(index_t n=0; n<circuit.net_cnt(); ++n){
+        for(auto p : circuit.get_net(n)){
+            point<int_t> size = circuit.get_cell(p.cell_ind).size;
+            pin_cells_.push_back(p.cell_ind);
+            pin_offsets_.push_back(p.offset);
+            pin_flipped_offsets_.push_back(size - p.offset);
+        }
+        net_limits_.push_back(pin_cells_.size());
+    }
+
+    cell_limits_.push_back(0);
+    for(index_t c=0; c<circuit.cell_cnt(); ++c){
+        index_t begin = cell_nets_.size();
+        for(auto p : circuit.get_cell(c)){
+            cell_nets_.push_back(p.net_ind);
+        }
+        // Uniquify the nets with several pins on the cell
+        std::sort(cell_nets_.begin() + begin, cell_nets_.end());
+        cell_nets_.resize(std::unique(cell_nets_.begin() + begin, cell_nets_.end()) - cell_nets_.begin());
+        cell_limits_.push_back(cell_nets_.size());
+    }
+
+    net_HPWL_.resize(circuit.net_cnt(), 0);
+    net_RSMT_.resize(circuit.net_cnt(), 0);
+    is_dirty_RSMT_.resize(circuit.net_cnt(), 0);
+}
+
+std::int64_t wirelength_tracker::compute_HPWL(index_t n) const{
+    index_t const b = net_limits_[n], e = net_limits_[n+1];
+    if(e - b <= 1) return 0;
+
+    int_t min_x = std::numeric_limits<int_t>::max(), max_x = std::numeric_limits<int_t>::min(),
+          min_y = std::numeric_limits<int_t>::max(), max_y = std::numeric_limits<int_t>::min();
+    #pragma omp simd reduction(min:min_x,min_y) reduction(max:max_x,max_y)
+    for(index_t p=b; p<e; ++p){
+        index_t const c = pin_cells_[p];
+        int_t const x = positions_[c].x_ + (orientations_[c].x_ ? pin_offsets_[p].x_ : pin_flipped_offsets_[p].x_);
+        int_t const y = positions_[c].y_ + (orientations_[c].y_ ? pin_offsets_[p].y_ : pin_flipped_offsets_[p].y_);
+        min_x = std::min(min_x, x); max_x = std::max(max_x, x);
+        min_y = std::min(min_y, y); max_y = std::max(max_y, y);
+    }
+    return (max_x - min_x) + (max_y - min_y);
+}
+
+std::int64_t wirelength_tracker::compute_RSMT(index_t n) const{
+    index_t const b = net_limits_[n], e = net_limits_[n+1];
+    if(e - b <= 1) return 0;
+
+    std::vector<point<int_t> > points(e - b);
+    for(index_t p=b; p<e; ++p){
+        index_t const c = pin_cells_[p];
+        points[p-b] = point<int_t>(
+            positions_[c].x_ + (orientations_[c].x_ ? pin_offsets_[p].x_ : pin_flipped_offsets_[p].x_),
+            positions_[c].y_ + (orientations_[c].y_ ? pin_offsets_[p].y_ : pin_flipped_offsets_[p].y_)
+        );
+    }
+    return RSMT_length(points, 8);
+}
+
+void wirelength_tracker::full_update(placement_t const & pl){
+    positions_ = pl.positions_;
+    orientations_ = pl.orientations_;
+
+    std::int64_t sum = 0;
+    #pragma omp parallel for reduction(+:sum) schedule(static, 1024)
+    for(index_t n=0; n<net_cnt(); ++n){
+        net_HPWL_[n] = compute_HPWL(n);
+        sum += net_HPWL_[n];
+    }
+    HPWL_ = sum;
+
+    dirty_RSMT_.resize(net_cnt());
+    for(index_t n=0; n<net_cnt(); ++n){
+        dirty_RSMT_[n] = n;
+        is_dirty_RSMT_[n] = 1;
+    }
+    initialized_ = true;
+}
+
+void wirelength_tracker::update(placement_t const & pl){
+    assert(pl.cell_cnt() == cell_limits_.size()-1);
+    if(not initialized_){
+        full_update(pl);
+        return;
+    }
+
+    std::vector<index_t> moved;
+    for(index_t c=0; c<pl.cell_cnt(); ++c){
+        if(pl.positions_[c].x_ != positions_[c].x_ or pl.positions_[c].y_ != positions_[c].y_
+        or pl.orientations_[c].x_ != orientations_[c].x_ or pl.orientations_[c].y_ != orientations_[c].y_){
+            moved.push_back(c);
+        }
+    }
+    if(moved.empty()) return;
+
+    // Beyond this point it is cheaper to recompute everything
+    if(moved.size() > pl.cell_cnt() / 8){
+        full_update(pl);
+        return;
+    }
+
+    std::vector<index_t> nets;
+    for(index_t c : moved){
+        positions_[c] = pl.positions_[c];
+        orientations_[c] = pl.orientations_[c];
+        nets.insert(nets.end(), cell_nets_.begin() + cell_limits_[c], cell_nets_.begin() + cell_limits_[c+1]);
+    }
+    std::sort(nets.begin(), nets.end());
+    nets.resize(std::unique(nets.begin(), nets.end()) - nets.begin());
+
+    std::int64_t delta = 0;
+    #pragma omp parallel for reduction(+:delta) if(nets.size() > 4096)
+    for(index_t i=0; i<nets.size(); ++i){
+        index_t n = nets[i];
+        std::int64_t cur = compute_HPWL(n);
+        delta += cur - net_HPWL_[n];
+        net_HPWL_[n] = cur;
+    }
+    HPWL_ += delta;
+
+    for(index_t n : nets){
+        if(not is_dirty_RSMT_[n]){
+            is_dirty_RSMT_[n] = 1;
+            dirty_RSMT_.push_back(n);
+        }
+    }
+}
+
+void wirelength_tracker::update_RSMT(){
+    std::int64_t delta = 0;
+    #pragma omp parallel for reduction(+:delta) schedule(dynamic, 256)
+    for(index_t i=0; i<dirty_RSMT_.size(); ++i){
+        index_t n = dirty_RSMT_[i];
+        std::int64_t cur = compute_RSMT(n);
+        delta += cur - net_RSMT_[n];
+        net_RSMT_[n] = cur;
+        is_dirty_RSMT_[n] = 0;
+    }
+    RSMT_ += delta;
+    dirty_RSMT_.clear();
+}
+
+} // namespace gp
+} // namespace coloquinte
+
@@ -16,6 +16,9 @@ Cfg.getParamPercentage("kite.edgeCapacity"        ).setMax       (110    )
 Cfg.getParamInt       ("kite.eventsLimit"         ).setInt       (4000002)
 Cfg.getParamInt       ("kite.ripupCost"           ).setInt       (3      )
 Cfg.getParamInt       ("kite.ripupCost"           ).setMin       (0      )
+Cfg.getParamBool      ("kite.conflictGraph"       ).setBool      (False  )
+Cfg.getParamInt       ("kite.concurrentCostsThreshold").setInt   (64     )
+Cfg.getParamInt       ("kite.concurrentCostsThreshold").setMin   (1      )
 
 Cfg.getParamInt       ("kite.globalRipupLimit"    ).setInt       (5      )
 Cfg.getParamInt       ("kite.globalRipupLimit"    ).setMin       (1      )
@@ -49,6 +52,8 @@ layout.addTitle     ( "Kite", "Kite - Detailed Router" )
 layout.addParameter ( "Kite", "kite.edgeCapacity"  , "Edge Capacity (%)"      , 0 )
 layout.addParameter ( "Kite", "kite.eventsLimit"   , "Events Limit"           , 0 )
 layout.addParameter ( "Kite", "kite.ripupCost"     , "Ripup Cost"             , 1, 1, Cfg.ParameterWidgetFlags.UseSpinBox )
+layout.addParameter ( "Kite", "kite.conflictGraph" , "Net Conflict Graph"     , 0 )
+layout.addParameter ( "Kite", "kite.concurrentCostsThreshold", "Concurrent Costs Threshold", 0 )
 layout.addParameter ( "Kite", "kite.metal1MinBreak", "METAL1 Length Min Break", 0 )
 layout.addParameter ( "Kite", "kite.metal2MinBreak", "METAL2 Length Min Break", 0 )
 layout.addParameter ( "Kite", "kite.metal3MinBreak", "METAL3 Length Min Break", 0 )
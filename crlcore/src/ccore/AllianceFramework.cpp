@@ -15,7 +15,10 @@
 
 
 #include  <unistd.h>
+#include  <fstream>
+#include  <algorithm>
 #include  "vlsisapd/utilities/Path.h"
+#include  "vlsisapd/configuration/Configuration.h"
 #include  "hurricane/Warning.h"
 #include  "hurricane/Technology.h"
 #include  "hurricane/DataBase.h"
@@ -115,6 +118,12 @@ namespace CRL {
 // Class  :  "CRL::AllianceFramework".
 
 
+  void  prefetchChanged ( Cfg::Parameter* p )
+  {
+    AllianceFramework::get()->setPrefetch ( p->asBool() );
+  }
+
+
   AllianceFramework* AllianceFramework::_singleton         = NULL;
   const Name         AllianceFramework::_parentLibraryName = "AllianceFramework";
 
@@ -127,7 +136,10 @@ namespace CRL {
     , _catalog()
     , _parentLibrary(NULL)
     , _routingGauges()
+    , _prefetch(Cfg::getParamBool("misc.prefetch",false)->asBool())
   {
+    Cfg::getParamBool("misc.prefetch")->registerCb ( prefetchChanged );
+
     DataBase* db = DataBase::getDB ();
     if ( not db )
       db = DataBase::create ();
@@ -478,19 +490,25 @@ namespace CRL {
   {
     cmess2 << "      " << tab++ << "+ Library: " << getString(library->getName()) << endl;
 
-    map<Name,Catalog::State*>*           states = _catalog.getStates ();
-    map<Name,Catalog::State*>::iterator  istate = states->begin ();
+    Catalog::StateMap*           states = _catalog.getStates ();
+    Catalog::StateMap::iterator  istate = states->begin ();
+    vector<string>               names;
 
-    unsigned int count = 0;
+  // Loading a cell may add or remove Catalog entries, so the names are
+  // collected first.
     for ( ; istate != states->end() ; istate++ ) {
-      if ( istate->second->getLibrary() == library ) {
-        getCell ( getString(istate->first), Catalog::State::Views );
-        count++; 
-      }
+      if ( istate->second->getLibrary() == library )
+        names.push_back ( getString(istate->first) );
     }
+    sort ( names.begin(), names.end() );
+
+    if ( _prefetch ) prefetchCells ( names, Catalog::State::Views );
+
+    for ( size_t i=0 ; i<names.size() ; ++i )
+      getCell ( names[i], Catalog::State::Views );
     tab--;
     
-    return count;
+    return names.size();
   }
     
 
@@ -537,6 +555,46 @@ namespace CRL {
   }
 
 
+  void  AllianceFramework::prefetchCells ( const vector<string>& names, unsigned int mode )
+  {
+  // The parsers build Hurricane objects and cannot run concurrently,
+  // so only the file system part (locating & reading the files) is
+  // done in parallel. The subsequent loads find them in the OS cache.
+    static const unsigned int views[2] = { Catalog::State::Logical, Catalog::State::Physical };
+
+    SearchPath&    LIBRARIES = _environment.getLIBRARIES ();
+    vector<string> files;
+
+    for ( size_t i=0 ; i<names.size() ; ++i ) {
+      Catalog::State* state = _catalog.getState ( names[i] );
+
+      for ( size_t iview=0 ; iview<2 ; ++iview ) {
+        unsigned int view = views[iview];
+        if ( not (mode & view) ) continue;
+        if ( state and state->getFlags(view) ) continue;
+
+        ParserFormatSlot& format = _parsers.getParserSlot ( names[i], view, _environment );
+        for ( format.cbegin() ; !format.cend() ; format++ )
+          files.push_back ( names[i] + "." + getString(format.getExt()) );
+      }
+    }
+
+    LIBRARIES.buildIndexes ();
+
+    #pragma omp parallel for schedule(dynamic)
+    for ( long i=0 ; i<(long)files.size() ; ++i ) {
+      string path = LIBRARIES.find ( files[i] );
+      if ( path.empty() ) continue;
+
+      char     buffer [ 65536 ];
+      ifstream stream ( path.c_str(), ios::in|ios::binary );
+      while ( stream.read(buffer,sizeof(buffer)) ) ;
+    }
+
+    cmess2 << "     - Prefetched " << files.size() << " files." << endl;
+  }
+
+
   bool  AllianceFramework::_writeLocate ( const string& file, unsigned int mode, bool isLib )
   {
     SearchPath& LIBRARIES = _environment.getLIBRARIES ();
@@ -663,6 +721,7 @@ namespace CRL {
     record->add ( getSlot ( "_routingGauges"       ,  _routingGauges       ) );
     record->add ( getSlot ( "_defaultCellGauge"    ,  _defaultCellGauge    ) );
     record->add ( getSlot ( "_cellGauges"          ,  _cellGauges          ) );
+    record->add ( getSlot ( "_prefetch"            ,  _prefetch            ) );
     return record;
   }
 
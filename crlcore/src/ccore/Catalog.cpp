@@ -15,6 +15,7 @@
 
 
 # include <iomanip>
+# include <algorithm>
 using namespace std;
 
 #include "hurricane/Collection.h"
@@ -100,7 +101,7 @@ namespace CRL {
 
   Catalog::State* Catalog::getState ( const Name& name, bool add )
   {
-    map<Name,State*>::iterator  it;
+    StateMap::iterator  it;
 
     if ( (it=_states.find(name)) != _states.end() ) return it->second;
 
@@ -115,7 +116,7 @@ namespace CRL {
 
   void  Catalog::mergeState ( const Name& name, const State& other )
   {
-    map<Name,State*>::iterator  it;
+    StateMap::iterator  it;
     State* state;
 
     if ( (it=_states.find(name)) == _states.end() )
@@ -129,7 +130,7 @@ namespace CRL {
 
   bool  Catalog::deleteState ( const Name& name )
   {
-    map<Name,State*>::iterator  it;
+    StateMap::iterator  it;
 
     if ( (it=_states.find(name)) == _states.end() ) return false;
 
@@ -144,7 +145,7 @@ namespace CRL {
 
   void  Catalog::clear ()
   {
-    map<Name,State*>::const_iterator  istate;
+    StateMap::const_iterator  istate;
     for ( istate=_states.begin() ; istate!=_states.end() ; istate++ ) {
       delete istate->second;
     }
@@ -213,10 +214,10 @@ namespace CRL {
 
   string  Catalog::_getPrint () const
   {
-    map<Name,State*>::const_iterator  it;
-    ostringstream  s;
+    map<Name,State*>  sorteds ( _states.begin(), _states.end() );
+    ostringstream     s;
 
-    for ( it=_states.begin() ; it!=_states.end() ; it++ ) {
+    for ( map<Name,State*>::const_iterator it=sorteds.begin() ; it!=sorteds.end() ; it++ ) {
       s << left << setw(30) << getString(it->first) << getString(it->second) << endl;
     }
 
@@ -235,11 +236,11 @@ namespace CRL {
 
   Record* Catalog::_getRecord () const
   {
-    map<Name,State*>::const_iterator  it;
-
     Record* record = new Record ( "<Catalog>" );
 
-    record->add ( getSlot ( "States", &_states ) );
+    StateMap::const_iterator  it;
+    for ( it=_states.begin() ; it!=_states.end() ; it++ )
+      record->add ( getSlot ( getString(it->first), it->second ) );
 
     return record;
   }
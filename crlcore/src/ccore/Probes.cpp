@@ -0,0 +1,295 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |          Alliance / Hurricane  Interface                        |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./Probes.cpp"                             |
+// +-----------------------------------------------------------------+
+
+
+#include  <cstdlib>
+#include  <chrono>
+#include  <mutex>
+#include  <fstream>
+#include  <iomanip>
+#include  "hurricane/Warning.h"
+#include  "crlcore/Utilities.h"
+#include  "crlcore/Probes.h"
+
+
+namespace {
+
+  using namespace std;
+  using CRL::Probes;
+
+
+  struct ProbeEntry {
+    string        _name;
+    Probes::Kind  _kind;
+  };
+
+
+// The registry is never freed, so probes may be used from static
+// destructors without ordering problems.
+
+  struct Registry {
+    mutex                     _mutex;
+    vector<ProbeEntry>        _probes;
+    vector<Probes::Buffer*>   _buffers;
+    string                    _tracePath;
+  };
+
+
+  Registry& getRegistry ()
+  {
+    static Registry* registry = new Registry();
+    return *registry;
+  }
+
+
+  size_t  binOf ( uint64_t value )
+  {
+    size_t bin = 0;
+    while ( (value >>= 1) and (bin+1 < Probes::HistogramBins) ) ++bin;
+    return bin;
+  }
+
+
+  uint64_t  percentile ( const Probes::Slot& slot, double ratio )
+  {
+    uint64_t target = (uint64_t)(ratio * slot._count);
+    uint64_t sum    = 0;
+    for ( size_t i=0 ; i<Probes::HistogramBins ; ++i ) {
+      sum += slot._bins[i];
+      if (sum > target) return (uint64_t)1 << i;
+    }
+    return slot._max;
+  }
+
+
+} // Anonymous namespace.
+
+
+namespace CRL {
+
+  using std::string;
+  using std::vector;
+  using std::ofstream;
+  using std::setw;
+  using std::left;
+  using std::right;
+  using std::fixed;
+  using std::setprecision;
+  using std::cerr;
+  using std::endl;
+  using std::lock_guard;
+  using std::mutex;
+  using Hurricane::Warning;
+
+
+// -------------------------------------------------------------------
+// Class  :  "CRL::Probes".
+
+
+  Probes::Mode               Probes::_mode   = Probes::Disabled;
+  thread_local Probes::Buffer* Probes::_buffer = NULL;
+
+
+  Probes::Buffer::Buffer ( unsigned int index )
+    : _index  (index)
+    , _slots  ()
+    , _events ()
+    , _dropped(0)
+  { }
+
+
+  unsigned int  Probes::registerProbe ( const string& name, Kind kind )
+  {
+    Registry&             registry = getRegistry();
+    lock_guard<mutex>     lock     ( registry._mutex );
+
+    for ( size_t id=0 ; id<registry._probes.size() ; ++id ) {
+      if (registry._probes[id]._name == name) return id;
+    }
+
+    registry._probes.push_back( ProbeEntry() );
+    registry._probes.back()._name = name;
+    registry._probes.back()._kind = kind;
+    return registry._probes.size() - 1;
+  }
+
+
+  void  Probes::setMode ( Mode mode )
+  {
+    static bool atExitRegistered = false;
+
+    _mode = mode;
+    if ((mode != Disabled) and not atExitRegistered) {
+      atexit( _dumpAtExit );
+      atExitRegistered = true;
+    }
+  }
+
+
+  void  Probes::_dumpAtExit ()
+  { dump( "exit" ); }
+
+
+  void  Probes::setTracePath ( const string& path )
+  {
+    Registry&          registry = getRegistry();
+    lock_guard<mutex>  lock     ( registry._mutex );
+    registry._tracePath = path;
+  }
+
+
+  uint64_t  Probes::now ()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+      ( std::chrono::steady_clock::now().time_since_epoch() ).count();
+  }
+
+
+  Probes::Buffer* Probes::_newBuffer ()
+  {
+    Registry&          registry = getRegistry();
+    lock_guard<mutex>  lock     ( registry._mutex );
+
+  // Buffers outlive their thread so the samples are kept until dump().
+    _buffer = new Buffer( registry._buffers.size() );
+    registry._buffers.push_back( _buffer );
+    return _buffer;
+  }
+
+
+  void  Probes::sample ( unsigned int id, uint64_t value )
+  {
+    if (not isEnabled()) return;
+
+    Slot& slot = _getBuffer()->getSlot( id );
+    slot._count += 1;
+    slot._total += value;
+    if (value < slot._min) slot._min = value;
+    if (value > slot._max) slot._max = value;
+    slot._bins[ binOf(value) ] += 1;
+  }
+
+
+  void  Probes::record ( unsigned int id, uint64_t start, uint64_t stop )
+  {
+    Buffer* buffer = _getBuffer();
+    sample( id, stop - start );
+
+    if (isTracing()) {
+      if (buffer->_events.size() < TraceCapacity) {
+        TraceEvent event;
+        event._id       = id;
+        event._start    = start;
+        event._duration = stop - start;
+        buffer->_events.push_back( event );
+      } else
+        ++buffer->_dropped;
+    }
+  }
+
+
+  void  Probes::dump ( const string& tag )
+  {
+    if (not isEnabled()) return;
+
+    Registry&           registry = getRegistry();
+    vector<ProbeEntry>  probes;
+    vector<Slot>        merged;
+    size_t              dropped  = 0;
+    {
+      lock_guard<mutex>  lock ( registry._mutex );
+
+      probes = registry._probes;
+      merged.resize( probes.size() );
+      for ( Buffer* buffer : registry._buffers ) {
+        dropped += buffer->_dropped;
+        for ( size_t id=0 ; id<buffer->_slots.size() ; ++id ) {
+          const Slot& from = buffer->_slots[id];
+          Slot&       to   = merged[id];
+          to._count += from._count;
+          to._total += from._total;
+          if (from._min < to._min) to._min = from._min;
+          if (from._max > to._max) to._max = from._max;
+          for ( size_t i=0 ; i<HistogramBins ; ++i ) to._bins[i] += from._bins[i];
+        }
+      }
+    }
+
+    cmess0 << "  o  Probes summary <" << tag << ">." << endl;
+    cmess0 << "     " << left  << setw(44) << "Probe"
+                      << right << setw(12) << "Count"
+                      << setw(12) << "Total(ms)"
+                      << setw(10) << "Mean"
+                      << setw(10) << "p50"
+                      << setw(10) << "p90"
+                      << setw(10) << "Max" << endl;
+    for ( size_t id=0 ; id<merged.size() ; ++id ) {
+      const Slot& slot = merged[id];
+      if (not slot._count) continue;
+
+      const ProbeEntry& entry = probes[id];
+      cmess0 << "     " << left << setw(44) << entry._name.substr(0,43)
+             << right << setw(12) << slot._count;
+      if (entry._kind == Counter) {
+        cmess0 << endl;
+        continue;
+      }
+
+    // Timers are in nanoseconds, reported in milliseconds/microseconds.
+      double scale = (entry._kind == Timer) ? 1000.0 : 1.0;
+      cmess0 << fixed << setprecision(2);
+      if (entry._kind == Timer) cmess0 << setw(12) << (slot._total / 1.0e6);
+      else                      cmess0 << setw(12) << "-";
+      cmess0 << setw(10) << ((double)slot._total / slot._count / scale)
+             << setw(10) << (percentile(slot,0.5) / scale)
+             << setw(10) << (percentile(slot,0.9) / scale)
+             << setw(10) << (slot._max / scale) << endl;
+    }
+
+    if (isTracing()) {
+      string path = registry._tracePath;
+      if (path.empty()) path = "probes";
+      path += "." + tag + ".json";
+
+      ofstream o ( path.c_str() );
+      if (not o.good()) {
+        cerr << Warning( "Probes::dump(): Unable to open Chrome trace file <%s>.", path.c_str() ) << endl;
+      } else {
+        lock_guard<mutex>  lock ( registry._mutex );
+
+        bool first = true;
+        o << "{ \"traceEvents\": [\n";
+        for ( Buffer* buffer : registry._buffers ) {
+          for ( const TraceEvent& event : buffer->_events ) {
+            o << (first ? "  " : ",\n  ")
+              << "{ \"name\": \"" << probes[event._id]._name << "\""
+              << ", \"ph\": \"X\""
+              << ", \"ts\": "  << (event._start    / 1000)
+              << ", \"dur\": " << (event._duration / 1000)
+              << ", \"pid\": 1, \"tid\": " << buffer->getIndex() << " }";
+            first = false;
+          }
+        }
+        o << "\n] }\n";
+        o.close();
+        cmess0 << "     Chrome trace written in <" << path << ">";
+        if (dropped) cmess0 << " (" << dropped << " events dropped)";
+        cmess0 << "." << endl;
+      }
+    }
+  }
+
+
+}  // CRL namespace.
@@ -14,6 +14,9 @@
 // +-----------------------------------------------------------------+
 
 
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
 #include "crlcore/SearchPath.h"
 
 
@@ -57,8 +60,71 @@ namespace CRL {
   }
 
 
-  bool SearchPath::_canOpen ( const SearchPath::Element& directory, const string& file, ios::openmode mode )
+  const SearchPath::DirectoryIndex& SearchPath::_getIndex ( const string& path, bool refreshStale )
   {
+    map<string,IndexedDirectory>::iterator iindex = _indexes.find( path );
+    if ((iindex != _indexes.end()) and not refreshStale) return iindex->second._entries;
+
+  // A directory is checked for modification at most once per second: a
+  // lookup missing in every library does not cost one stat() per library.
+    time_t now = time( NULL );
+    if (iindex != _indexes.end()) {
+      if (iindex->second._checkedAt == now) return iindex->second._entries;
+      iindex->second._checkedAt = now;
+    }
+
+    struct stat status;
+    time_t      mtime = (stat(path.c_str(),&status) == 0) ? status.st_mtime : 0;
+
+    if (iindex != _indexes.end()) {
+    // The directory may have been modified in the same second it was
+    // indexed, so an equal time stamp is considered stale too.
+      IndexedDirectory& index = iindex->second;
+      if ((mtime == index._mtime) and (mtime < index._indexedAt)) return index._entries;
+    }
+
+    IndexedDirectory& index = _indexes[ path ];
+    index._mtime     = mtime;
+    index._indexedAt = now;
+    index._checkedAt = now;
+    index._entries.clear();
+
+    DIR* dir = opendir( path.c_str() );
+    if (dir) {
+      struct dirent* entry;
+      while ( (entry = readdir(dir)) ) index._entries.insert( entry->d_name );
+      closedir( dir );
+    }
+    return index._entries;
+  }
+
+
+  const SearchPath::DirectoryIndex& SearchPath::getDirectoryIndex ( size_t index )
+  { return _getIndex( _paths[index].getPath() ); }
+
+
+  void  SearchPath::buildIndexes ()
+  {
+    for ( size_t i=1 ; i<_paths.size() ; ++i ) _getIndex( _paths[i].getPath() );
+  }
+
+
+  bool SearchPath::_canOpen ( size_t index, const string& file, ios::openmode mode )
+  {
+    const Element& directory = _paths[index];
+
+  // Library directories are indexed once, so a miss do not cost a file
+  // opening. The index is rebuilt on a miss if the directory has been
+  // modified since. The working directory (index 0) is written into by
+  // the tools and always checked directly.
+    if (mode & ios::out) {
+      _indexes.erase( directory.getPath() );
+    } else if (index and not _getIndex(directory.getPath()).count(file)
+                     and not _getIndex(directory.getPath(),true).count(file)) {
+      _selected = _selectFailed;
+      return false;
+    }
+
     _selected = directory.getPath() + "/" + file;
     fstream filestream ( _selected.c_str(), mode );
     if ( filestream.is_open() ) {
@@ -110,10 +176,10 @@ namespace CRL {
 
   size_t  SearchPath::locate ( const string& file, ios::openmode mode, int first, int last )
   {
-    if ( hasSelected() and _canOpen(_paths[_index],file,mode) ) return _index;
+    if ( hasSelected() and _canOpen(_index,file,mode) ) return _index;
 
     for ( int i=max(0,first) ; i < min((int)_paths.size(),last) ; i++ ) {
-      if ( _canOpen(_paths[i],file,mode) ) {
+      if ( _canOpen(i,file,mode) ) {
         return _index = i;
       }
     }
@@ -122,6 +188,24 @@ namespace CRL {
   }
 
 
+  string  SearchPath::find ( const string& file ) const
+  {
+  // Read-only lookup, safe to call concurrently provided that
+  // buildIndexes() has been called first.
+    for ( size_t i=0 ; i < _paths.size() ; i++ ) {
+      string path = _paths[i].getPath() + "/" + file;
+
+      map<string,IndexedDirectory>::const_iterator iindex = _indexes.find( _paths[i].getPath() );
+      if (i and (iindex != _indexes.end())) {
+        if (iindex->second._entries.count(file)) return path;
+        continue;
+      }
+      if (access(path.c_str(),R_OK) == 0) return path;
+    }
+    return "";
+  }
+
+
   size_t  SearchPath::hasPath ( const string& path ) const
   {
     for ( size_t i=0 ; i < _paths.size() ; i++ )
@@ -162,6 +246,7 @@ namespace CRL {
     record->add ( getSlot ( "_paths"   , &_paths    ) );
     record->add ( getSlot ( "_selected", &_selected ) );
     record->add ( getSlot ( "_index"   ,  _index    ) );
+    record->add ( getSlot ( "_indexes" ,  _indexes.size() ) );
     return record;
   }
 
@@ -30,6 +30,7 @@ namespace boptions = boost::program_options;
 #include  "hurricane/viewer/Script.h"
 #include  "crlcore/Utilities.h"
 #include  "crlcore/AllianceFramework.h"
+#include  "crlcore/Probes.h"
 
 
 namespace {
@@ -94,6 +95,18 @@ namespace {
   }
 
 
+  void  probesChanged ( Cfg::Parameter* p )
+  {
+    Probes::setMode( (Probes::Mode)p->asInt() );
+  }
+
+
+  void  probesTraceChanged ( Cfg::Parameter* p )
+  {
+    Probes::setTracePath( p->asString() );
+  }
+
+
   void  stratus1MappingNameChanged ( Cfg::Parameter* p )
   {
     Utilities::Path stratusMappingName ( p->asString() );
@@ -330,6 +343,8 @@ namespace CRL {
     Cfg::getParamBool  ("misc.bug"            ,false)->registerCb ( bugChanged );
     Cfg::getParamBool  ("misc.logMode"        ,false)->registerCb ( logModeChanged );
     Cfg::getParamInt   ("misc.traceLevel"     ,1000 )->registerCb ( traceLevelChanged );
+    Cfg::getParamEnumerate("misc.probes"      ,0    )->registerCb ( probesChanged );
+    Cfg::getParamString("misc.probesTrace"    ,"probes")->registerCb ( probesTraceChanged );
     Cfg::getParamString("stratus1.mappingName","./stratus2sxlib.xml")->registerCb ( stratus1MappingNameChanged );
 
   // Immediate update from the configuration.
@@ -341,6 +356,8 @@ namespace CRL {
     bugChanged           ( Cfg::getParamBool("misc.bug"          ) );
     logModeChanged       ( Cfg::getParamBool("misc.logMode"      ) );
     traceLevelChanged    ( Cfg::getParamInt ("misc.traceLevel"   ) );
+    probesChanged        ( Cfg::getParamEnumerate("misc.probes"  ) );
+    probesTraceChanged   ( Cfg::getParamString("misc.probesTrace") );
 
     Utilities::Path stratusMappingName;
     if ( arguments.count("stratus_mapping_name") ) {
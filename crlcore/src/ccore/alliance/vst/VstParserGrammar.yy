@@ -1398,6 +1398,14 @@ void  vstParser ( const string cellPath, Cell *cell )
     yyin = ccell.getFile ();
     if ( !firstCall ) yyrestart ( VSTin );
     yyparse ();
+
+  // 1.2 step: Read ahead, concurrently, the files of the models still to load.
+    if ( Vst::framework->isPrefetch() and !Vst::states->_cellQueue.empty() ) {
+      vector<string> models;
+      for ( size_t i=0 ; i<Vst::states->_cellQueue.size() ; ++i )
+        models.push_back ( getString(Vst::states->_cellQueue[i]) );
+      Vst::framework->prefetchCells ( models, Catalog::State::Views );
+    }
   
   // 1.5 step: Load, in order, the model Cells (recursive).
     while ( !Vst::states->_cellQueue.empty() ) {
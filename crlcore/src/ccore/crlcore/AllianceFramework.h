@@ -65,6 +65,7 @@ namespace CRL {
       inline bool                     isPad                    ( const string& name );
       inline bool                     isPad                    ( const Name&   name );
       inline bool                     isPad                    ( const Cell* );
+      inline bool                     isPrefetch               () const;
     // Accessors.
       inline Environment*             getEnvironment           ();
       inline Catalog*                 getCatalog               ();
@@ -84,6 +85,7 @@ namespace CRL {
     // Modifiers.                     
              void                     addRoutingGauge          ( RoutingGauge* );
              void                     addCellGauge             ( CellGauge* );
+      inline void                     setPrefetch              ( bool );
     // Cell Management.               
              Cell*                    getCell                  ( const string& name
                                                                , unsigned int  mode
@@ -92,6 +94,7 @@ namespace CRL {
              void                     saveCell                 ( Cell* , unsigned int mode );
              unsigned int             loadLibraryCells         ( Library* );
              unsigned int             loadLibraryCells         ( const Name& );
+             void                     prefetchCells            ( const vector<string>& names, unsigned int mode );
       static size_t                   getInstancesCount        ( Cell*, unsigned int flags );
     // Hurricane Managment.           
       inline string                   _getTypeName             () const;
@@ -114,6 +117,7 @@ namespace CRL {
              map<const Name,CellGauge*>
                                  _cellGauges;
              CellGauge*          _defaultCellGauge;
+             bool                _prefetch;
 
     // Internals - Constructors.
                                  AllianceFramework       ();
@@ -145,6 +149,8 @@ namespace CRL {
   inline bool         AllianceFramework::isPad                 ( const string& name ) { return isPad(name.c_str()); }
   inline bool         AllianceFramework::isPad                 ( const Name&   name ) { return isPad(getString(name)); }
   inline bool         AllianceFramework::isPad                 ( const Cell*   cell ) { return isPad(cell->getName()); }
+  inline bool         AllianceFramework::isPrefetch            () const { return _prefetch; }
+  inline void         AllianceFramework::setPrefetch           ( bool state ) { _prefetch = state; }
   inline Environment* AllianceFramework::getEnvironment        () { return &_environment; }
   inline Catalog*     AllianceFramework::getCatalog            () { return &_catalog; }
   inline const Name&  AllianceFramework::getParentLibraryName
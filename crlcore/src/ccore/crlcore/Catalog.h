@@ -19,6 +19,7 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include "hurricane/Name.h"
 #include "hurricane/Property.h"
 #include "hurricane/Slot.h"
@@ -55,6 +56,10 @@ namespace CRL {
 
     public:
       class State;
+      struct NameHash {
+        inline size_t  operator() ( const Name& name ) const;
+      };
+      typedef std::unordered_map<Name,State*,NameHash>  StateMap;
     public:
       inline                   Catalog      ();
                               ~Catalog      ();
@@ -63,7 +68,7 @@ namespace CRL {
              bool              deleteState  ( const Name& name );
              void              clear        ();
              bool              loadFromFile ( const string& path, Library* library );
-      inline map<Name,State*>* getStates    ();
+      inline StateMap*         getStates    ();
              string            _getPrint    () const;
       inline string            _getTypeName () const;
              string            _getString   () const;
@@ -130,7 +135,7 @@ namespace CRL {
 
     private:
     // Attributes.
-      map<Name,State*>  _states;
+      StateMap  _states;
 
     private:
                    Catalog  ( const Catalog& );
@@ -201,7 +206,11 @@ namespace CRL {
   inline string            Catalog::State::_getTypeName     () const { return _TName("Catalog::State"); }
 
   inline                   Catalog::Catalog                 () : _states() {}
-  inline map<Name,Catalog::State*>*
+
+// Names are hash-consed, so their SharedName address is a valid key.
+  inline size_t            Catalog::NameHash::operator()    ( const Name& name ) const
+                                                            { return std::hash<const void*>()( name._getSharedName() ); }
+  inline Catalog::StateMap*
                            Catalog::getStates               () { return &_states; }
   inline string            Catalog::_getTypeName            () const { return _TName("Catalog"); }
 
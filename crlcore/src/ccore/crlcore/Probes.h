@@ -0,0 +1,164 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |          Alliance / Hurricane  Interface                        |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Header  :   "./crlcore/Probes.h"                           |
+// +-----------------------------------------------------------------+
+
+
+#ifndef  CRL_PROBES_H
+#define  CRL_PROBES_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace CRL {
+
+
+// -------------------------------------------------------------------
+// Class  :  "CRL::Probes".
+//
+// Lightweight instrumentation of the hot paths of the tools. A probe
+// is registered once (usually through a function static) and then
+// fed through an integer identifier. Three kinds of probes exist:
+//   - Timer     : cumulated duration of a scope (see ScopedProbe).
+//   - Counter   : monotonic event counter.
+//   - Histogram : distribution of a value, in power of two bins.
+// Samples are accumulated in per thread buffers, without locking,
+// and merged only when dumped. When the "misc.probes" parameter is
+// zero every probe reduces to a single test of a static flag.
+//
+// Probes are process wide (the same hot path is shared by all the
+// engines), so they are dumped only once, at exit, when no worker
+// thread can be writing in its buffer anymore. Buffers are never
+// cleared.
+//
+// In Trace mode, each timed scope is also recorded as an event and
+// written in Chrome tracing format (chrome://tracing) by dump().
+
+  class Probes {
+    public:
+      enum Kind  { Timer     = 1
+                 , Counter   = 2
+                 , Histogram = 3
+                 };
+      enum Mode  { Disabled  = 0
+                 , Summary   = 1
+                 , Trace     = 2
+                 };
+      static const size_t  HistogramBins = 32;
+      static const size_t  TraceCapacity = 1 << 20;
+    public:
+      struct Slot {
+        inline          Slot ();
+        uint64_t  _count;
+        uint64_t  _total;
+        uint64_t  _min;
+        uint64_t  _max;
+        uint64_t  _bins[HistogramBins];
+      };
+      struct TraceEvent {
+        unsigned int  _id;
+        uint64_t      _start;
+        uint64_t      _duration;
+      };
+      class Buffer {
+        public:
+                               Buffer  ( unsigned int index );
+          inline Slot&         getSlot ( unsigned int id );
+          inline unsigned int  getIndex() const;
+        public:
+          unsigned int             _index;
+          std::vector<Slot>        _slots;
+          std::vector<TraceEvent>  _events;
+          size_t                   _dropped;
+      };
+    public:
+      static unsigned int  registerProbe ( const std::string& name, Kind );
+      static inline bool   isEnabled     ();
+      static inline bool   isTracing     ();
+      static inline Mode   getMode       ();
+      static void          setMode       ( Mode );
+      static void          setTracePath  ( const std::string& );
+      static uint64_t      now           ();
+      static inline void   count         ( unsigned int id, uint64_t increment=1 );
+      static void          sample        ( unsigned int id, uint64_t value );
+      static void          record        ( unsigned int id, uint64_t start, uint64_t stop );
+      static void          dump          ( const std::string& tag );
+    private:
+      static inline Buffer* _getBuffer   ();
+      static Buffer*        _newBuffer   ();
+      static void           _dumpAtExit  ();
+    private:
+      static Mode                        _mode;
+      static thread_local Buffer*        _buffer;
+  };
+
+
+  inline Probes::Slot::Slot ()
+    : _count(0), _total(0), _min(UINT64_MAX), _max(0)
+  { for ( size_t i=0 ; i<HistogramBins ; ++i ) _bins[i] = 0; }
+
+  inline unsigned int   Probes::Buffer::getIndex () const { return _index; }
+
+  inline Probes::Slot& Probes::Buffer::getSlot ( unsigned int id )
+  {
+    if (id >= _slots.size()) _slots.resize( id+1 );
+    return _slots[id];
+  }
+
+  inline bool            Probes::isEnabled  () { return _mode != Disabled; }
+  inline bool            Probes::isTracing  () { return _mode == Trace; }
+  inline Probes::Mode    Probes::getMode    () { return _mode; }
+  inline Probes::Buffer* Probes::_getBuffer () { return (_buffer) ? _buffer : _newBuffer(); }
+
+  inline void  Probes::count ( unsigned int id, uint64_t increment )
+  {
+    if (not isEnabled()) return;
+    _getBuffer()->getSlot(id)._count += increment;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "CRL::ScopedProbe".
+//
+// Time the enclosing scope into a Timer probe. Usage:
+//
+//     static unsigned int probe = Probes::registerProbe( "Kite::Track::getOverlapCost()", Probes::Timer );
+//     ScopedProbe scope ( probe );
+
+  class ScopedProbe {
+    public:
+      inline  ScopedProbe ( unsigned int id );
+      inline ~ScopedProbe ();
+    private:
+                    ScopedProbe ( const ScopedProbe& );
+      ScopedProbe&  operator=   ( const ScopedProbe& );
+    private:
+      unsigned int  _id;
+      uint64_t      _start;
+  };
+
+
+  inline  ScopedProbe::ScopedProbe ( unsigned int id )
+    : _id   (id)
+    , _start((Probes::isEnabled()) ? Probes::now() : 0)
+  { }
+
+  inline  ScopedProbe::~ScopedProbe ()
+  { if (_start and Probes::isEnabled()) Probes::record( _id, _start, Probes::now() ); }
+
+
+}  // CRL namespace.
+
+#endif  // CRL_PROBES_H
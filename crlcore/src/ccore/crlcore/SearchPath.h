@@ -17,8 +17,11 @@
 #ifndef  CRL_SEARCH_PATH_H
 #define  CRL_SEARCH_PATH_H
 
+#include <ctime>
 #include <string>
 #include <vector>
+#include <map>
+#include <unordered_set>
 #include "hurricane/Commons.h"
 #include "hurricane/Slot.h"
 
@@ -44,6 +47,14 @@ namespace CRL {
           std::string  _path;
           std::string  _name;
       };
+    public:
+      typedef std::unordered_set<std::string>  DirectoryIndex;
+      struct IndexedDirectory {
+        std::time_t     _mtime;
+        std::time_t     _indexedAt;
+        std::time_t     _checkedAt;
+        DirectoryIndex  _entries;
+      };
     public:
       static const size_t       npos;
       static std::string        extractLibName ( const std::string& );
@@ -58,7 +69,12 @@ namespace CRL {
                                                ,       std::ios::openmode  mode =std::ios::in
                                                ,       int                 first=0
                                                ,       int                 last =64 );
+             std::string        find           ( const std::string& file ) const;
              void               select         ( const std::string& );
+             void               buildIndexes   ();
+             const DirectoryIndex&
+                                getDirectoryIndex ( size_t index );
+      inline void               refresh        ();
       inline size_t             getSize        () const;
       inline const std::string& getSelected    () const;
       inline size_t             getIndex       () const;
@@ -71,12 +87,15 @@ namespace CRL {
              std::vector<Element>      _paths;
              size_t                    _index;
              std::string               _selected;
+             std::map<std::string,IndexedDirectory>
+                                       _indexes;
     private:
                           SearchPath   ( const SearchPath& );
-             bool         _canOpen     ( const Element&     directory
+             bool         _canOpen     ( size_t             index
                                        , const std::string& file
                                        , std::ios::openmode mode
                                        );
+      const DirectoryIndex& _getIndex  ( const std::string& path, bool refreshStale=false );
     public:
       inline std::string  _getTypeName () const;
              std::string  _getString   () const;
@@ -86,6 +105,7 @@ namespace CRL {
 
   // Inline Functions.
   inline void               SearchPath::reset        () { _paths.resize(1); }
+  inline void               SearchPath::refresh      () { _indexes.clear(); }
   inline size_t             SearchPath::getSize      () const { return _paths.size(); }
   inline const std::string& SearchPath::getSelected  () const { return _selected; }
   inline size_t             SearchPath::getIndex     () const { return _index; }
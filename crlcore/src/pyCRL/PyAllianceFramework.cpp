@@ -210,6 +210,37 @@ extern "C" {
   }
 
 
+  static PyObject* PyAllianceFramework_isPrefetch ( PyAllianceFramework* self )
+  {
+    trace << "PyAllianceFramework_isPrefetch ()" << endl;
+
+    HTRY
+    METHOD_HEAD("AllianceFramework.isPrefetch()")
+    if (af->isPrefetch()) Py_RETURN_TRUE;
+    HCATCH
+
+    Py_RETURN_FALSE;
+  }
+
+
+  static PyObject* PyAllianceFramework_setPrefetch ( PyAllianceFramework* self, PyObject* args )
+  {
+    trace << "PyAllianceFramework_setPrefetch ()" << endl;
+
+    HTRY
+    METHOD_HEAD("AllianceFramework.setPrefetch()")
+    PyObject* arg0 = NULL;
+    if ( not PyArg_ParseTuple(args,"O:AllianceFramework.setPrefetch",&arg0) or not PyBool_Check(arg0) ) {
+      PyErr_SetString ( ConstructorError, "AllianceFramework.setPrefetch(): argument must be a boolean." );
+      return NULL;
+    }
+    af->setPrefetch ( PyObject_IsTrue(arg0) );
+    HCATCH
+
+    Py_RETURN_NONE;
+  }
+
+
   extern PyObject* PyAllianceFramework_addRoutingGauge ( PyAllianceFramework* self, PyObject* args )
   {
     trace << "PyAllianceFramework_addRoutingGauge ()" << endl;
@@ -312,6 +343,10 @@ extern "C" {
                                , "Create a Cell in the Alliance framework." }
     , { "isPad"                , (PyCFunction)PyAllianceFramework_isPad                 , METH_VARARGS
                                , "Tells if a cell name is a Pad." }
+    , { "isPrefetch"           , (PyCFunction)PyAllianceFramework_isPrefetch           , METH_NOARGS
+                               , "Tells if the library prefetch is enabled." }
+    , { "setPrefetch"          , (PyCFunction)PyAllianceFramework_setPrefetch          , METH_VARARGS
+                               , "Enable/disable the parallel prefetch of the netlist models files." }
     , { "addCellGauge"         , (PyCFunction)PyAllianceFramework_addCellGauge         , METH_VARARGS
                                , "Add a new cell gauge." }
     , { "getCellGauge"         , (PyCFunction)PyAllianceFramework_getCellGauge         , METH_VARARGS
@@ -95,7 +95,7 @@ namespace Equinox {
       i = _equis.begin(); 
       (*i)->destroy();  // Delete also addresse of objet Equi from current Equinox
     } 
-    _occurrences.clear(); // Clear also map<Occurrence, Equi*>
+    _occurrences.clear(); // Clear also OccurrenceMap
   }  
 
 
@@ -163,7 +163,7 @@ void EquinoxEngine::withoutAlimExtract(unsigned int nbwindows)
     Record* record = ToolEngine::_getRecord ();
     record->add ( getSlot           ( "_isExtracted"        ,  _isExtracted    ) ); 
     record->add ( getSlot           ( "_equis"              ,  _equis          ) ); 
-    record->add ( getSlot           ( "_occurrences"        ,  _occurrences    ) );                                      
+    record->add ( getSlot           ( "_occurrences"        ,  _occurrences.size() ) );                                      
     return ( record );
   }
   
@@ -185,7 +185,7 @@ void EquinoxEngine::withoutAlimExtract(unsigned int nbwindows)
  Equi* EquinoxEngine::getEquiByOccurrence(Occurrence occurrence)
 	      // *********************************************
 	      {
-                 map<Occurrence, Equi*>::iterator i = _occurrences.end();
+                 OccurrenceMap::iterator i = _occurrences.end();
                   if( _occurrences.find(occurrence) == i) { 
                      Component * component = dynamic_cast<Component*>(occurrence.getEntity());
                
@@ -207,7 +207,7 @@ void EquinoxEngine::withoutAlimExtract(unsigned int nbwindows)
 Occurrence EquinoxEngine::getEquiOccurrence(Occurrence occurrence)
 	      // ***********************************************
 	      {
-                  map<Occurrence, Equi*>::iterator i = _occurrences.end();
+                  OccurrenceMap::iterator i = _occurrences.end();
                   if( _occurrences.find(occurrence) == i ) {
                      Component* component = dynamic_cast<Component*>(occurrence.getEntity());
                      if( component && occurrence.getPath().isEmpty() ) { // If this is a component, maybe it has been factorized.
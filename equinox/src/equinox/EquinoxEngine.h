@@ -29,6 +29,7 @@
 #ifndef  __EQUINOX_EQUINOX_ENGINE__
 #define  __EQUINOX_EQUINOX_ENGINE__
 
+#include <unordered_map>
 #include <equinox/IntervalTree.h>
 #include <equinox/Equis.h>
 #include <hurricane/Occurrences.h>
@@ -62,6 +63,7 @@ namespace Equinox {
   using std::string;
   using std::set;
   using std::map;
+  using std::unordered_map;
   using std::vector;
 
   using Hurricane::Cell;
@@ -96,6 +98,10 @@ using Hurricane::ComponentFilter;
     friend  class Strategy;
     friend  class WithAlimStrategy;
     friend  class WithoutAlimStrategy;
+
+    // Types
+  public:
+    typedef unordered_map<Occurrence, Equi*, Occurrence::HashKey>  OccurrenceMap;
     
     // Statics
   public:
@@ -116,7 +122,7 @@ using Hurricane::ComponentFilter;
     inline          unsigned long long        getNumOfEquis              ();
     inline          void                      addEqui                    (Equi* equi);
     inline          void                      removeEqui                 (Equi* equi);
-    inline          map<Occurrence, Equi*>&  _getOccurrences             ();
+    inline          OccurrenceMap&           _getOccurrences             ();
 
     /**/    virtual Record*                   _getRecord                 () const;
     /**/    virtual string                    _getString                 () const;
@@ -166,7 +172,7 @@ using Hurricane::ComponentFilter;
     static  Strategy *                       _strategy;
     /**/    bool                             _isExtracted;			          
     /**/    set<Equi*>                       _equis;
-    /**/    map<Occurrence, Equi*>           _occurrences;
+    /**/    OccurrenceMap                    _occurrences;
     /**/    vector<Tile*>*                   _tilesByXmin;
     /**/    vector<Tile*>*                   _tilesByXmax;
 
@@ -194,7 +200,8 @@ using Hurricane::ComponentFilter;
   inline  EquinoxEngine*              EquinoxEngine::get                (const Cell* cell )         { return static_cast<EquinoxEngine*>(ToolEngine::get(cell,staticGetName())); };
 
   inline  const   Name&               EquinoxEngine::staticGetName      ()                          { return _toolName; }
-  inline  map<Occurrence,Equi*>&      EquinoxEngine::_getOccurrences    ()                          { return _occurrences; };
+  inline  EquinoxEngine::OccurrenceMap&
+                                      EquinoxEngine::_getOccurrences    ()                          { return _occurrences; };
   inline   void                       EquinoxEngine::setStrategy        (Strategy * s)              { if (_strategy) delete _strategy;   _strategy = s;    };
   inline  EquiFilter                  EquinoxEngine::getIsRoutingFilter ()                          { return IsRoutingFilter();}
   inline  Equis                       EquinoxEngine::getRoutingEquis    ()                    const { return getCollection(_equis).getSubSet(getIsRoutingFilter()); };
@@ -0,0 +1,247 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |   E t e s i a n  -  A n a l y t i c   P l a c e r               |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./Checkpoint.cpp"                         |
+// +-----------------------------------------------------------------+
+
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include "etesian/Checkpoint.h"
+
+
+namespace {
+
+  using namespace std;
+
+
+  const char      Magic[8] = { 'E', 'T', 'E', 'S', 'C', 'K', 'P', 'T' };
+  const uint32_t  Version  = 1;
+
+
+  template< typename T >
+  inline bool  writeRaw ( FILE* file, const T* data, size_t count )
+  { return fwrite( data, sizeof(T), count, file ) == count; }
+
+
+  template< typename T >
+  inline bool  readRaw ( FILE* file, T* data, size_t count )
+  { return fread( data, sizeof(T), count, file ) == count; }
+
+
+// Positions as two int32 per cell, orientations packed in one byte per cell.
+  bool  writePlacement ( FILE* file, const coloquinte::placement_t& placement )
+  {
+    size_t           count = placement.cell_cnt();
+    vector<int32_t>  positions    ( 2*count );
+    vector<uint8_t>  orientations (   count );
+    for ( size_t i=0 ; i<count ; ++i ) {
+      positions[2*i  ] = placement.positions_[i].x_;
+      positions[2*i+1] = placement.positions_[i].y_;
+      orientations[i]  = (placement.orientations_[i].x_ ? 1 : 0) | (placement.orientations_[i].y_ ? 2 : 0);
+    }
+    return writeRaw( file, positions.data(), positions.size() )
+       and writeRaw( file, orientations.data(), orientations.size() );
+  }
+
+
+  bool  readPlacement ( FILE* file, size_t count, coloquinte::placement_t& placement )
+  {
+    vector<int32_t>  positions    ( 2*count );
+    vector<uint8_t>  orientations (   count );
+    if (not readRaw(file,positions.data(),positions.size())) return false;
+    if (not readRaw(file,orientations.data(),orientations.size())) return false;
+
+    placement.positions_   .resize( count );
+    placement.orientations_.resize( count );
+    for ( size_t i=0 ; i<count ; ++i ) {
+      placement.positions_[i]    = coloquinte::point<coloquinte::int_t>( positions[2*i], positions[2*i+1] );
+      placement.orientations_[i] = coloquinte::point<bool>( orientations[i] & 1, orientations[i] & 2 );
+    }
+    return true;
+  }
+
+
+}  // Anonymous namespace.
+
+
+namespace Etesian {
+
+  using std::string;
+  using std::mutex;
+  using std::unique_lock;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Etesian::Checkpoint".
+
+
+  Checkpoint::Checkpoint ()
+    : _stage       (0)
+    , _iteration   (0)
+    , _pullingForce(0.0)
+    , _cellCount   (0)
+    , _netCount    (0)
+    , _pinCount    (0)
+    , _placementLB ()
+    , _placementUB ()
+  { }
+
+
+  Checkpoint::Checkpoint ( unsigned int                   stage
+                         , unsigned int                   iteration
+                         , float                          pullingForce
+                         , const coloquinte::netlist&     circuit
+                         , const coloquinte::placement_t& placementLB
+                         , const coloquinte::placement_t& placementUB )
+    : _stage       (stage)
+    , _iteration   (iteration)
+    , _pullingForce(pullingForce)
+    , _cellCount   (circuit.cell_cnt())
+    , _netCount    (circuit.net_cnt())
+    , _pinCount    (circuit.pin_cnt())
+    , _placementLB (placementLB)
+    , _placementUB (placementUB)
+  { }
+
+
+  bool  Checkpoint::matches ( const coloquinte::netlist& circuit ) const
+  {
+    return (_stage     != 0)
+       and (_cellCount == circuit.cell_cnt())
+       and (_netCount  == circuit.net_cnt())
+       and (_pinCount  == circuit.pin_cnt());
+  }
+
+
+  bool  Checkpoint::save ( const string& path ) const
+  {
+  // Written aside then renamed, so a crash while writing leaves the
+  // previous checkpoint untouched.
+    string  tmpPath = path + ".tmp";
+    FILE*   file    = fopen( tmpPath.c_str(), "wb" );
+    if (not file) return false;
+
+    uint32_t header[7] = { Version, _stage, _iteration, _cellCount, _netCount, _pinCount, 0 };
+    bool     success   = writeRaw( file, Magic, sizeof(Magic) )
+                     and writeRaw( file, header, 7 )
+                     and writeRaw( file, &_pullingForce, 1 )
+                     and writePlacement( file, _placementLB )
+                     and writePlacement( file, _placementUB );
+
+    success = (fclose(file) == 0) and success;
+    if (success) success = (rename(tmpPath.c_str(),path.c_str()) == 0);
+    if (not success) remove( tmpPath.c_str() );
+    return success;
+  }
+
+
+  bool  Checkpoint::load ( const string& path )
+  {
+    FILE* file = fopen( path.c_str(), "rb" );
+    if (not file) return false;
+
+    char      magic[8];
+    uint32_t  header[7];
+    float     pullingForce;
+    bool      success = readRaw( file, magic, sizeof(magic) )
+                    and (memcmp(magic,Magic,sizeof(Magic)) == 0)
+                    and readRaw( file, header, 7 )
+                    and (header[0] == Version)
+                    and readRaw( file, &pullingForce, 1 )
+                    and readPlacement( file, header[3], _placementLB )
+                    and readPlacement( file, header[3], _placementUB );
+    fclose( file );
+
+    if (not success) { *this = Checkpoint(); return false; }
+
+    _stage        = header[1];
+    _iteration    = header[2];
+    _cellCount    = header[3];
+    _netCount     = header[4];
+    _pinCount     = header[5];
+    _pullingForce = pullingForce;
+    return true;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Etesian::CheckpointWriter".
+
+
+  CheckpointWriter::CheckpointWriter ( const string& path )
+    : _path      (path)
+    , _mutex     ()
+    , _condition ()
+    , _pending   ()
+    , _hasPending(false)
+    , _writing   (false)
+    , _stop      (false)
+    , _written   (0)
+    , _thread    (&CheckpointWriter::_run,this)
+  { }
+
+
+  CheckpointWriter::~CheckpointWriter ()
+  {
+    {
+      unique_lock<mutex> lock ( _mutex );
+      _stop = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+  }
+
+
+  void  CheckpointWriter::push ( Checkpoint&& checkpoint )
+  {
+    {
+      unique_lock<mutex> lock ( _mutex );
+      _pending    = std::move( checkpoint );
+      _hasPending = true;
+    }
+    _condition.notify_all();
+  }
+
+
+  void  CheckpointWriter::flush ()
+  {
+    unique_lock<mutex> lock ( _mutex );
+    _condition.wait( lock, [this]{ return not _hasPending and not _writing; } );
+  }
+
+
+  void  CheckpointWriter::_run ()
+  {
+    unique_lock<mutex> lock ( _mutex );
+    while ( true ) {
+      _condition.wait( lock, [this]{ return _hasPending or _stop; } );
+      if (not _hasPending) break;
+
+      Checkpoint checkpoint = std::move( _pending );
+      _hasPending = false;
+      _writing    = true;
+      lock.unlock();
+
+      bool success = checkpoint.save( _path );
+
+      lock.lock();
+      _writing = false;
+      if (success) ++_written;
+      _condition.notify_all();
+    }
+  }
+
+
+} // Etesian namespace.
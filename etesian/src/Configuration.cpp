@@ -60,6 +60,11 @@ namespace Etesian {
     , _routingDriven(                             Cfg::getParamBool      ("etesian.routingDriven", false      )->asBool())
     , _spaceMargin  (                             Cfg::getParamPercentage("etesian.spaceMargin"   ,  5.0)->asDouble() )
     , _aspectRatio  (                             Cfg::getParamPercentage("etesian.aspectRatio"   ,100.0)->asDouble() )
+    , _bandRows     (                             Cfg::getParamInt       ("etesian.bandRows"      ,  0  )->asInt() )
+    , _clusterLevels(                             Cfg::getParamInt       ("etesian.clusterLevels" ,  0  )->asInt() )
+    , _rudyBinSize  (                             Cfg::getParamInt       ("etesian.rudyBinSize"   ,  0  )->asInt() )
+    , _rudyPeriod   (                             Cfg::getParamInt       ("etesian.rudyPeriod"    ,  5  )->asInt() )
+    , _checkpointPeriod(                          Cfg::getParamInt       ("etesian.checkpointPeriod", 0 )->asInt() )
   {
     if ( cg == NULL ) cg = AllianceFramework::get()->getCellGauge();
 
@@ -74,6 +79,11 @@ namespace Etesian {
     , _spreadingConf( other._spreadingConf )
     , _spaceMargin  ( other._spaceMargin   )
     , _aspectRatio  ( other._aspectRatio   )
+    , _bandRows     ( other._bandRows      )
+    , _clusterLevels( other._clusterLevels )
+    , _rudyBinSize  ( other._rudyBinSize   )
+    , _rudyPeriod   ( other._rudyPeriod    )
+    , _checkpointPeriod( other._checkpointPeriod )
   {
     if ( other._cg ) _cg = other._cg->getClone();
   }
@@ -99,6 +109,11 @@ namespace Etesian {
     cmess1 << Dots::asBool      ("     - Routing driven",_routingDriven) << endl;
     cmess1 << Dots::asPercentage("     - Space Margin"  ,_spaceMargin  ) << endl;
     cmess1 << Dots::asPercentage("     - Aspect Ratio"  ,_aspectRatio  ) << endl;
+    cmess1 << Dots::asUInt      ("     - Row bands"     ,_bandRows     ) << endl;
+    cmess1 << Dots::asUInt      ("     - Cluster levels",_clusterLevels) << endl;
+    cmess1 << Dots::asUInt      ("     - RUDY bin size" ,_rudyBinSize  ) << endl;
+    cmess1 << Dots::asUInt      ("     - RUDY period"   ,_rudyPeriod   ) << endl;
+    cmess1 << Dots::asUInt      ("     - Checkpoint period",_checkpointPeriod) << endl;
   }
 
 
@@ -125,6 +140,11 @@ namespace Etesian {
     record->add ( getSlot( "_spreadingConf"   ,  (int)_spreadingConf ) );
     record->add ( getSlot( "_spaceMargin"     ,       _spaceMargin   ) );
     record->add ( getSlot( "_aspectRatio"     ,       _aspectRatio   ) );
+    record->add ( getSlot( "_bandRows"        ,       _bandRows      ) );
+    record->add ( getSlot( "_clusterLevels"   ,       _clusterLevels ) );
+    record->add ( getSlot( "_rudyBinSize"     ,       _rudyBinSize   ) );
+    record->add ( getSlot( "_rudyPeriod"      ,       _rudyPeriod    ) );
+    record->add ( getSlot( "_checkpointPeriod",       _checkpointPeriod) );
     return record;
   }
 
@@ -0,0 +1,453 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |   E t e s i a n  -  A n a l y t i c   P l a c e r               |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./EtesianBench.cpp"                       |
+// +-----------------------------------------------------------------+
+
+
+#include <unistd.h>
+#include <sys/resource.h>
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <memory>
+using namespace std;
+
+#include <boost/program_options.hpp>
+namespace bopts = boost::program_options;
+
+#include "vlsisapd/configuration/Configuration.h"
+#include "hurricane/Warning.h"
+#include "hurricane/Error.h"
+#include "hurricane/DataBase.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Net.h"
+#include "hurricane/Instance.h"
+#include "hurricane/Plug.h"
+#include "hurricane/UpdateSession.h"
+using namespace Hurricane;
+
+#include "crlcore/Utilities.h"
+#include "crlcore/Banner.h"
+#include "crlcore/Measures.h"
+#include "crlcore/AllianceFramework.h"
+using namespace CRL;
+
+#include "etesian/EtesianEngine.h"
+using namespace Etesian;
+
+#include "kite/KiteEngine.h"
+
+
+namespace {
+
+
+// -------------------------------------------------------------------
+// Class  :  "SyntheticDesign".
+//
+// Procedural netlist generator. Instances are drawn from a small set
+// of standard cells and numbered in creation order; each input of an
+// instance is driven by the output of a previous instance picked
+// either inside a sliding window (local, Rent-like connection) or
+// anywhere (global connection). The generator is fully determined by
+// its seed so runs are comparable between revisions.
+
+
+  class SyntheticDesign {
+    public:
+                     SyntheticDesign ( AllianceFramework*, const vector<string>& masters, unsigned int seed );
+             Cell*   build           ( const string& name, size_t instances );
+      inline size_t  getNetsCount    () const;
+    private:
+      struct Master {
+        Cell*         _cell;
+        vector<Net*>  _inputs;
+        vector<Net*>  _outputs;
+        vector<Net*>  _supplies;
+      };
+    private:
+      AllianceFramework* _framework;
+      vector<Master>     _masters;
+      mt19937            _rng;
+      size_t             _window;
+      double             _localRatio;
+      size_t             _netsCount;
+  };
+
+
+  inline size_t  SyntheticDesign::getNetsCount () const { return _netsCount; }
+
+
+  SyntheticDesign::SyntheticDesign ( AllianceFramework* framework, const vector<string>& masters, unsigned int seed )
+    : _framework (framework)
+    , _masters   ()
+    , _rng       (seed)
+    , _window    (64)
+    , _localRatio(0.9)
+    , _netsCount (0)
+  {
+    for ( const string& name : masters ) {
+      Cell* cell = _framework->getCell( name, Catalog::State::Views );
+      if (not cell) {
+        cerr << Warning( "SyntheticDesign: Standard cell \"%s\" not found, skipped.", name.c_str() ) << endl;
+        continue;
+      }
+
+      Master master;
+      master._cell = cell;
+      for ( Net* net : cell->getExternalNets() ) {
+        if      (net->isSupply()) master._supplies.push_back( net );
+        else if (net->isClock ()) continue;
+        else if (net->getDirection() & Net::Direction::DirOut) master._outputs.push_back( net );
+        else master._inputs.push_back( net );
+      }
+      if (master._outputs.empty()) continue;
+
+      _masters.push_back( master );
+    }
+
+    if (_masters.empty())
+      throw Error( "SyntheticDesign: No usable standard cell in the library." );
+  }
+
+
+  Cell* SyntheticDesign::build ( const string& name, size_t instancesNb )
+  {
+    UpdateSession::open();
+
+    Cell* cell = _framework->createCell( name );
+    Net*  vdd  = Net::create( cell, "vdd" );
+    Net*  vss  = Net::create( cell, "vss" );
+    vdd->setExternal( true );
+    vdd->setGlobal  ( true );
+    vdd->setType    ( Net::Type::POWER );
+    vss->setExternal( true );
+    vss->setGlobal  ( true );
+    vss->setType    ( Net::Type::GROUND );
+
+    vector<Net*> drivers;
+    drivers.reserve( instancesNb );
+
+    uniform_int_distribution<size_t> masterDist ( 0, _masters.size()-1 );
+    uniform_real_distribution<>      localDist  ( 0.0, 1.0 );
+
+  // Primary inputs: undriven nets feeding the first instances.
+    size_t inputsNb = std::max( (size_t)4, instancesNb/100 );
+    for ( size_t i=0 ; i<inputsNb ; ++i ) {
+      ostringstream netName;
+      netName << "pi_" << i;
+      drivers.push_back( Net::create(cell,netName.str()) );
+    }
+
+    vector<size_t> fanouts ( inputsNb, 0 );
+    for ( size_t i=0 ; i<instancesNb ; ++i ) {
+      const Master& master = _masters[ masterDist(_rng) ];
+
+      ostringstream instanceName;
+      instanceName << "g_" << i;
+      Instance* instance = Instance::create( cell, instanceName.str(), master._cell );
+
+      for ( Net* supply : master._supplies )
+        instance->getPlug( supply )->setNet( supply->isPower() ? vdd : vss );
+
+      for ( Net* input : master._inputs ) {
+        size_t last   = drivers.size() - 1;
+        size_t driver = 0;
+        if ((localDist(_rng) < _localRatio) and (last > _window)) {
+          uniform_int_distribution<size_t> windowDist ( last-_window, last );
+          driver = windowDist( _rng );
+        } else {
+          uniform_int_distribution<size_t> globalDist ( 0, last );
+          driver = globalDist( _rng );
+        }
+        instance->getPlug( input )->setNet( drivers[driver] );
+        ++fanouts[driver];
+      }
+
+      for ( Net* output : master._outputs ) {
+        ostringstream netName;
+        netName << "n_" << i << "_" << output->getName();
+        Net* net = Net::create( cell, netName.str() );
+        instance->getPlug( output )->setNet( net );
+        drivers.push_back( net );
+        fanouts.push_back( 0 );
+      }
+    }
+
+  // Dangling outputs are not worth routing, remove them.
+    for ( size_t i=0 ; i<drivers.size() ; ++i ) {
+      if (fanouts[i] == 0) {
+        vector<Plug*> plugs;
+        for ( Plug* plug : drivers[i]->getPlugs() ) plugs.push_back( plug );
+        for ( Plug* plug : plugs ) plug->setNet( NULL );
+        drivers[i]->destroy();
+      } else
+        ++_netsCount;
+    }
+
+    UpdateSession::close();
+    return cell;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "StageReport".
+
+
+  class StageReport {
+    public:
+      typedef chrono::steady_clock  Clock;
+    public:
+                    StageReport ( const string& name );
+             void   stop        ();
+             void   toJson      ( ostream& ) const;
+      static long   getPeakRss  ();
+      static long   getRss      ();
+    private:
+      string             _name;
+      Clock::time_point  _start;
+      double             _wallTime;
+      long               _startRss;
+      long               _endRss;
+      long               _peakRss;
+  };
+
+
+  StageReport::StageReport ( const string& name )
+    : _name    (name)
+    , _start   (Clock::now())
+    , _wallTime(0.0)
+    , _startRss(getRss())
+    , _endRss  (0)
+    , _peakRss (0)
+  {
+    cmess1 << "  o  Benchmark stage <" << _name << ">." << endl;
+  }
+
+
+  // Peak resident size of the whole process since it started, not of
+  // the stage alone: it never decreases from one stage to the next.
+  long  StageReport::getPeakRss ()
+  {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF,&usage) != 0) return 0;
+    return usage.ru_maxrss;  // In kilobytes under Linux.
+  }
+
+
+  // Current resident size, in kilobytes (second field of statm, in pages).
+  long  StageReport::getRss ()
+  {
+    ifstream statm ( "/proc/self/statm" );
+    long     size     = 0;
+    long     resident = 0;
+    if (not (statm >> size >> resident)) return 0;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+  }
+
+
+  void  StageReport::stop ()
+  {
+    _wallTime = chrono::duration<double>( Clock::now() - _start ).count();
+    _endRss   = getRss();
+    _peakRss  = getPeakRss();
+  }
+
+
+  void  StageReport::toJson ( ostream& o ) const
+  {
+    o << "    { \"name\": \""                << _name     << "\""
+      <<     ", \"wallTime\": "              << _wallTime
+      <<     ", \"startRssKb\": "            << _startRss
+      <<     ", \"endRssKb\": "              << _endRss
+      <<     ", \"cumulativePeakRssKb\": "   << _peakRss  << " }";
+  }
+
+
+  template<typename Data>
+  void  jsonMeasure ( ostream& o, Cell* cell, const char* name, const char* key, bool& first )
+  {
+    const Measure<Data>* measure = getMeasure<Data>( cell, name );
+    if (not measure) return;
+
+    o << (first ? "" : ",\n") << "    \"" << key << "\": " << measure->getData();
+    first = false;
+  }
+
+
+} // Anonymous namespace.
+
+
+// -------------------------------------------------------------------
+// Function  :  "main()".
+
+int main ( int argc, char *argv[] )
+{
+  int returnCode = 0;
+
+  try {
+    Banner banner( "Etesian Bench"
+                 , "1.0"
+                 , "Synthetic Place & Route Benchmark"
+                 , "2026"
+                 , "agent"
+                 , ""
+                 );
+
+    size_t        instancesNb;
+    unsigned int  seed;
+    string        masters;
+    string        output;
+    bool          verbose1;
+    bool          verbose2;
+    bool          placeOnly;
+    bool          noDetailed;
+
+    bopts::options_description options ("Command line arguments & options");
+    options.add_options()
+      ( "help,h"         , "Print this help." )
+      ( "verbose,v"      , bopts::bool_switch(&verbose1)->default_value(false)
+                         , "First level of verbosity.")
+      ( "very-verbose,V" , bopts::bool_switch(&verbose2)->default_value(false)
+                         , "Second level of verbosity.")
+      ( "instances,n"    , bopts::value<size_t>(&instancesNb)->default_value(10000)
+                         , "Number of standard cells of the generated design." )
+      ( "seed,s"         , bopts::value<unsigned int>(&seed)->default_value(1)
+                         , "Seed of the netlist generator." )
+      ( "masters,m"      , bopts::value<string>(&masters)->default_value("inv_x1,na2_x1,no2_x1,a2_x2,o2_x2,nao22_x1,xr2_x1")
+                         , "Comma separated list of standard cells to instanciate." )
+      ( "output,o"       , bopts::value<string>(&output)->default_value("etesian-bench.json")
+                         , "Path of the JSON report." )
+      ( "place-only"     , bopts::bool_switch(&placeOnly)->default_value(false)
+                         , "Stop after the placement stage." )
+      ( "no-detailed"    , bopts::bool_switch(&noDetailed)->default_value(false)
+                         , "Stop after the global routing and layer assignment." );
+
+    bopts::variables_map arguments;
+    bopts::store  ( bopts::parse_command_line(argc,argv,options), arguments );
+    bopts::notify ( arguments );
+
+    if (arguments.count("help")) {
+      cout << banner << endl;
+      cout << options << endl;
+      exit( 0 );
+    }
+
+    Cfg::Configuration::pushDefaultPriority( Cfg::Parameter::CommandLine );
+    if (verbose1) Cfg::getParamBool("misc.verboseLevel1")->setBool( true );
+    if (verbose2) Cfg::getParamBool("misc.verboseLevel2")->setBool( true );
+    Cfg::Configuration::popDefaultPriority();
+
+    cmess1 << banner << endl;
+
+    dbo_ptr<DataBase>          db ( DataBase::create() );
+    dbo_ptr<AllianceFramework> af ( AllianceFramework::create() );
+
+    vector<string> masterNames;
+    istringstream  smasters ( masters );
+    string         name;
+    while ( getline(smasters,name,',') ) if (not name.empty()) masterNames.push_back( name );
+
+    vector<StageReport> stages;
+
+    stages.push_back( StageReport("generate") );
+    ostringstream cellName;
+    cellName << "bench_" << instancesNb << "_" << seed;
+    SyntheticDesign generator ( af.get(), masterNames, seed );
+    Cell* cell = generator.build( cellName.str(), instancesNb );
+    stages.back().stop();
+
+    stages.push_back( StageReport("etesian") );
+    EtesianEngine* etesian = EtesianEngine::create( cell );
+    etesian->place();
+    etesian->destroy();
+    stages.back().stop();
+
+    bool routed = false;
+    if (not placeOnly) {
+      stages.push_back( StageReport("knik") );
+      Kite::KiteEngine* kite = Kite::KiteEngine::create( cell );
+      kite->runGlobalRouter( Kite::KtBuildGlobalRouting );
+      stages.back().stop();
+
+      stages.push_back( StageReport("katabatic") );
+      kite->loadGlobalRouting   ( Katabatic::EngineLoadGrByNet );
+      kite->balanceGlobalDensity();
+      kite->layerAssign         ( Katabatic::EngineNoNetLayerAssign );
+      stages.back().stop();
+
+      if (not noDetailed) {
+        stages.push_back( StageReport("kite") );
+        kite->runNegociate();
+        routed = kite->getToolSuccess();
+        kite->finalizeLayout();
+        stages.back().stop();
+      }
+      kite->destroy();
+    }
+
+    ofstream o ( output.c_str() );
+    if (not o.good())
+      throw Error( "Cannot open benchmark report <%s> for writing.", output.c_str() );
+
+    o << setprecision(6) << fixed;
+    o << "{\n";
+    o << "  \"design\": {\n";
+    o << "    \"name\": \""    << cellName.str()              << "\",\n";
+    o << "    \"instances\": " << instancesNb                 << ",\n";
+    o << "    \"nets\": "      << generator.getNetsCount()    << ",\n";
+    o << "    \"seed\": "      << seed                        << "\n";
+    o << "  },\n";
+    o << "  \"stages\": [\n";
+    for ( size_t i=0 ; i<stages.size() ; ++i ) {
+      stages[i].toJson( o );
+      o << ((i+1 < stages.size()) ? ",\n" : "\n");
+    }
+    o << "  ],\n";
+    o << "  \"metrics\": {\n";
+    bool first = true;
+    jsonMeasure<unsigned long long>( o, cell, "HPWL(l)", "hpwl"          , first );
+    jsonMeasure<unsigned long long>( o, cell, "RMST(l)", "rsmt"          , first );
+    jsonMeasure<unsigned long long>( o, cell, "knikOv" , "overflow"      , first );
+    jsonMeasure<unsigned long long>( o, cell, "GWL(l)" , "globalWL"      , first );
+    jsonMeasure<unsigned long long>( o, cell, "DWL(l)" , "detailedWL"    , first );
+    jsonMeasure<size_t>            ( o, cell, "Segs"   , "segments"      , first );
+    jsonMeasure<size_t>            ( o, cell, "uSegs"  , "unrouted"      , first );
+    jsonMeasure<size_t>            ( o, cell, "Events" , "routingEvents" , first );
+    o << (first ? "" : ",\n") << "    \"routed\": " << (routed ? "true" : "false") << "\n";
+    o << "  }\n";
+    o << "}\n";
+    o.close();
+
+    cmess1 << "  o  Benchmark report written in <" << output << ">." << endl;
+  }
+  catch ( Error& e ) {
+    cerr << e.what() << endl;
+    returnCode = 1;
+  }
+  catch ( bopts::error& e ) {
+    cerr << "[ERROR] " << e.what() << endl;
+    returnCode = 1;
+  }
+  catch ( exception& e ) {
+    cerr << "[ERROR] " << e.what() << endl;
+    returnCode = 1;
+  }
+  catch ( ... ) {
+    cerr << "[ERROR] Unknown exception." << endl;
+    returnCode = 2;
+  }
+
+  return returnCode;
+}
@@ -15,6 +15,7 @@
 
 
 
+#include <cstdio>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
@@ -46,6 +47,7 @@
 #include "crlcore/Utilities.h"
 #include "crlcore/Measures.h"
 #include "crlcore/AllianceFramework.h"
+#include "crlcore/RoutingGauge.h"
 #include "etesian/EtesianEngine.h"
 #include "etesian/FeedCells.h"
 
@@ -65,6 +67,7 @@ namespace {
   unsigned const ForceUniformDensity = 0x0010;
   unsigned const UpdateLB            = 0x0020;
   unsigned const UpdateUB            = 0x0040;
+  unsigned const CoarseLevel         = 0x0080;
 
   // Options for the detailed placer
   unsigned const UpdateDetailed      = 0x0100;
@@ -210,6 +213,7 @@ namespace Etesian {
   using CRL::ToolEngine;
   using CRL::AllianceFramework;
   using CRL::Catalog;
+  using CRL::RoutingGauge;
   using CRL::addMeasure;
   using CRL::Measures;
   using CRL::MeasuresSet;
@@ -256,10 +260,18 @@ namespace Etesian {
     , _circuit      ()
     , _placementLB  ()
     , _placementUB  ()
+    , _linearSystems()
+    , _wirelengthLB (NULL)
+    , _wirelengthUB (NULL)
+    , _congestion   (NULL)
+    , _routingCapacity(0.0)
     , _cellsToIds   ()
     , _idsToInsts   ()
     , _viewer       (NULL)
     , _feedCells    (this)
+    , _yspinSlice0  (0)
+    , _checkpoints  (NULL)
+    , _resume       (false)
   {
   }
 
@@ -302,6 +314,10 @@ namespace Etesian {
 
   EtesianEngine::~EtesianEngine ()
   {
+    delete _wirelengthLB;
+    delete _wirelengthUB;
+    delete _congestion;
+    delete _checkpoints;
     delete _configuration;
   }
 
@@ -314,6 +330,10 @@ namespace Etesian {
   { return _configuration; }
 
 
+  string  EtesianEngine::getCheckpointPath () const
+  { return getString(getCell()->getName()) + ".etesian-ckpt"; }
+
+
   Configuration* EtesianEngine::getConfiguration ()
   { return _configuration; }
 
@@ -457,6 +477,9 @@ namespace Etesian {
   //getCell()->flattenNets( Cell::Flags::BuildRings|Cell::Flags::NoClockFlatten );
     getCell()->flattenNets( Cell::Flags::NoClockFlatten );
 
+    _cellsToIds.clear();
+    _idsToInsts.clear();
+
   // Coloquinte circuit description data-structures.
     size_t                  instancesNb = getCell()->getLeafInstanceOccurrences().getSize();
     vector<Transformation>  idsToTransf ( instancesNb );
@@ -589,6 +612,24 @@ namespace Etesian {
     _placementLB.positions_    = positions;
     _placementLB.orientations_ = orientations;
     _placementUB = _placementLB;
+
+    delete _wirelengthLB;
+    delete _wirelengthUB;
+    _wirelengthLB = new coloquinte::gp::wirelength_tracker( _circuit );
+    _wirelengthUB = new coloquinte::gp::wirelength_tracker( _circuit );
+
+    delete _congestion;
+    _congestion = NULL;
+    if (getRudyBinSize()) {
+    // One track per layer pitch on each routing layer, in placement pitches.
+      RoutingGauge* rg = AllianceFramework::get()->getRoutingGauge();
+      _routingCapacity = 0.0;
+      for ( size_t depth=0 ; depth<rg->getDepth() ; ++depth ) {
+        if (rg->getLayerType(depth) == Constant::PinOnly) continue;
+        _routingCapacity += (float)pitch / (float)rg->getLayerPitch(depth);
+      }
+      _congestion = new coloquinte::gp::congestion_map( _circuit, _surface, getRudyBinSize()*(getSliceHeight()/pitch) );
+    }
   //cerr << "Coloquinte cell height: " << _circuit.get_cell(0).size.y_ << endl;
 
   }
@@ -609,7 +650,7 @@ namespace Etesian {
     cmess2 << "  o  Star (*) Optimization." << endl;
     auto solv = get_star_linear_system( _circuit, _placementLB, 1.0, 0, 10) // Limit the number of pins: don't want big awful nets with high weight
               + get_pulling_forces( _circuit, _placementUB, 1000000.0);
-    solve_linear_system( _circuit, _placementLB, solv, 200 );
+    solve_linear_system( _circuit, _placementLB, solv, _linearSystems, 200 );
     _progressReport2("     [--]" );
   }
 
@@ -657,7 +698,7 @@ namespace Etesian {
     // Get information about the GCells
     // Create different densities
 
-    _densityLimits.clear();
+    _routingDensityLimits.clear();
     for(GCell* gc : grid->getGCells()){
         float density = gc->getMaxHVDensity();
         if(density >= densityThreshold){
@@ -670,9 +711,10 @@ namespace Etesian {
                 gc->getYMax() / pitch
             );
             cur.density_ = densityThreshold/density;
-            _densityLimits.push_back(cur);
+            _routingDensityLimits.push_back(cur);
         }
     }
+    _densityLimits = _routingDensityLimits;
 
     // TODO: Careful to keep the densities high enough
     // Will just fail later if the densities are too high
@@ -680,14 +722,33 @@ namespace Etesian {
     // Expand areas: TODO
   }
 
-  void  EtesianEngine::globalPlace ( float initPenalty, float minDisruption, float targetImprovement, float minInc, float maxInc, unsigned options ){
+  void  EtesianEngine::feedCongestion(){
+    /*
+     * Estimate the congestion of the legalized placement with RUDY and lower the allowed
+     * density where it exceeds the routing capacity. Unlike feedRoutingBack(), this is
+     * cheap enough to be done during global placement.
+     */
+    const float densityThreshold = 0.9;
+    const float minDensity       = 0.5;
+
+    // The limits found by the router are kept: where both overlap, the region
+    // distribution uses the lowest density.
+    _congestion->update( _placementUB );
+    coloquinte::density_restrictions rudyLimits = _congestion->get_density_limits( _routingCapacity, densityThreshold, minDensity );
+    _densityLimits = _routingDensityLimits;
+    _densityLimits.insert( _densityLimits.end(), rudyLimits.begin(), rudyLimits.end() );
+    cmess2 << "          RUDY.     Max:" << setw(7) << setprecision(3) << _congestion->get_max_congestion( _routingCapacity )
+           << " Restricted bins:" << setw(6) << rudyLimits.size() << endl;
+  }
+
+  float  EtesianEngine::globalPlace ( float initPenalty, float minDisruption, float targetImprovement, float minInc, float maxInc, unsigned options ){
     using namespace coloquinte::gp;
 
     float_t penaltyIncrease = minInc;
     float_t linearDisruption  = get_mean_linear_disruption(_circuit, _placementLB, _placementUB);
     float_t pullingForce = initPenalty;
-    float_t upperWL = static_cast<float_t>(get_HPWL_wirelength(_circuit, _placementUB)),
-            lowerWL = static_cast<float_t>(get_HPWL_wirelength(_circuit, _placementLB));
+    float_t upperWL = static_cast<float_t>(_wirelengthUB->get_HPWL(_placementUB)),
+            lowerWL = static_cast<float_t>(_wirelengthLB->get_HPWL(_placementLB));
     float_t prevOptRatio = lowerWL / upperWL;
 
     index_t i=0;
@@ -701,7 +762,7 @@ namespace Etesian {
       label  << "     [" << setw(2) << setfill('0') << i << "] Bipart.";
       _progressReport1(label.str() );
 
-      upperWL = static_cast<float_t>(get_HPWL_wirelength(_circuit, _placementUB));
+      upperWL = static_cast<float_t>(_wirelengthUB->get_HPWL(_placementUB));
     //float_t legRatio = lowerWL / upperWL;
 
       // Get the system to optimize (tolerance, maximum and minimum pin counts)
@@ -711,7 +772,8 @@ namespace Etesian {
       : get_HPWLF_linear_system ( _circuit, _placementLB, minDisruption, 2, 100000 ); 
       auto solv = opt_problem
                 + get_linear_pulling_forces( _circuit, _placementUB, _placementLB, pullingForce, 2.0f * linearDisruption);
-      solve_linear_system( _circuit, _placementLB, solv, 200 ); // 200 iterations
+      // The compressed systems are kept between iterations: only the values change when the topology is the same
+      solve_linear_system( _circuit, _placementLB, solv, _linearSystems, 200 ); // 200 iterations
       _progressReport2("          Linear." );
 
       if(options & UpdateLB)
@@ -723,7 +785,7 @@ namespace Etesian {
           _progressReport2("          Orient." );
       }
 
-      lowerWL = static_cast<float_t>(get_HPWL_wirelength(_circuit, _placementLB));
+      lowerWL = static_cast<float_t>(_wirelengthLB->get_HPWL(_placementLB));
       float_t optRatio = lowerWL / upperWL;
 
      /*
@@ -743,10 +805,97 @@ namespace Etesian {
 
       linearDisruption  = get_mean_linear_disruption(_circuit, _placementLB, _placementUB);
       ++i;
+
+      // The clustered netlists are not the one the congestion map was built for
+      if (_congestion and not (options & CoarseLevel) and (i % getRudyPeriod() == 0))
+        feedCongestion();
+      if (_checkpoints and not (options & CoarseLevel) and (i % getCheckpointPeriod() == 0))
+        _saveCheckpoint( Checkpoint::Global, i, pullingForce );
       // First way to exit the loop: UB and LB difference is <10%
       // Second way to exit the loop: the legalization is close enough to the previous result
     } while (linearDisruption > minDisruption and prevOptRatio <= 0.9);
-    _updatePlacement( _placementUB );
+    // A clustered netlist has no instance to update
+    if(not (options & CoarseLevel))
+      _updatePlacement( _placementUB );
+    return pullingForce;
+  }
+
+  float  EtesianEngine::multilevelPlace ( unsigned int levels, float minDisruption, float targetImprovement, float minInc, float maxInc, unsigned options ){
+    using namespace coloquinte::gp;
+
+    /*
+     * V-cycle: the netlist is clustered level by level, the coarsest one is placed from scratch, then
+     * each level is interpolated to the finer one and refined by a shorter global placement.
+     * The flat netlist is left with its interpolated placement, and the returned penalty is the
+     * one the final global placement should start with.
+     */
+    vector<coloquinte::netlist>    netlists;
+    vector<coloquinte::placement_t> placements;
+    vector<netlist_clustering>     clusterings;
+
+    netlists  .push_back( std::move(_circuit) );
+    placements.push_back( _placementLB );
+    while ( clusterings.size() < levels ) {
+      // Stop when the netlist is small enough or the clustering does not reduce it much
+      if (netlists.back().cell_cnt() < 1000) break;
+      netlist_clustering clustering ( netlists.back() );
+      if (5*clustering.coarse_cnt() > 4*clustering.fine_cnt()) break;
+
+      netlists  .push_back( clustering.get_coarse_netlist( netlists[netlists.size()-1] ) );
+      placements.push_back( clustering.get_coarse_placement( netlists[netlists.size()-2], netlists.back(), placements.back() ) );
+      clusterings.push_back( std::move(clustering) );
+      cmess2 << "     - Level " << clusterings.size() << ": "
+             << netlists.back().cell_cnt() << " cells, " << netlists.back().net_cnt() << " nets." << endl;
+    }
+
+    auto loadLevel = [&]( size_t level, coloquinte::placement_t const& LB, coloquinte::placement_t const& UB ){
+      _circuit       = std::move( netlists[level] );
+      _placementLB   = LB;
+      _placementUB   = UB;
+      _linearSystems = coloquinte::point<assembled_system>();
+      delete _wirelengthLB;
+      delete _wirelengthUB;
+      _wirelengthLB = new wirelength_tracker( _circuit );
+      _wirelengthUB = new wirelength_tracker( _circuit );
+    };
+
+    if (clusterings.empty()) {
+      loadLevel( 0, placements[0], placements[0] );
+      preplace();
+      return minInc;
+    }
+
+    coloquinte::placement_t  placementLB  = placements.back();
+    coloquinte::placement_t  placementUB  = placementLB;
+    float                    pullingForce = minInc;
+    options &= ~(UpdateLB|UpdateUB);
+    for ( size_t level=clusterings.size() ; level>0 ; --level ) {
+      Timer timer;
+      timer.start();
+
+      loadLevel( level, placementLB, placementUB );
+      if (level == clusterings.size()) preplace();
+
+      // A refined level starts well spread, so it does not need to go through the weak penalties again
+      float initPenalty = (level == clusterings.size()) ? minInc : pullingForce / 4.0f;
+      pullingForce = globalPlace( initPenalty, minDisruption, targetImprovement, minInc, maxInc, options|CoarseLevel );
+
+      timer.stop();
+      cmess2 << "     - Level " << level << " placed in " << Timer::getStringTime(timer.getCombTime())
+             << ", HPWL:" << setw(11) << _wirelengthUB->get_HPWL( _placementUB )
+             << " (lower bound:" << setw(11) << _wirelengthLB->get_HPWL( _placementLB ) << ")" << endl;
+
+      // Both bounds are interpolated so that the finer level starts with the same disruption
+      netlists[level] = std::move( _circuit );
+      placementLB = placements[level-1];
+      placementUB = placements[level-1];
+      clusterings[level-1].interpolate( netlists[level-1], netlists[level], _placementLB, placementLB );
+      clusterings[level-1].interpolate( netlists[level-1], netlists[level], _placementUB, placementUB );
+    }
+    loadLevel( 0, placementLB, placementUB );
+    _progressReport1("     [ML] Interpolated" );
+
+    return pullingForce / 4.0f;
   }
 
   void  EtesianEngine::detailedPlace    ( int iterations, int effort, unsigned options ){
@@ -767,6 +916,8 @@ namespace Etesian {
           _updatePlacement( _placementUB );
 
         auto legalizer = legalize( _circuit, _placementUB, _surface, sliceHeight );
+        // Non-zero: the row optimizations below work in parallel on bands of rows
+        legalizer.band_rows_ = getBandRows();
         coloquinte::dp::get_result( _circuit, legalizer, _placementUB );
         _progressReport1("          Legalized ......" );
         if(options & UpdateDetailed)
@@ -804,6 +955,8 @@ namespace Etesian {
           verify_placement_legality( _circuit, _placementUB, _surface );
           _progressReport1("          Final Legalize ." );
         }
+        if (_checkpoints)
+          _saveCheckpoint( Checkpoint::Detailed, i+1, 0.0 );
     }
     _placementLB = _placementUB; // In case we run other passes
     _updatePlacement( _placementUB );
@@ -827,6 +980,7 @@ namespace Etesian {
     GraphicUpdate placementUpdate = getUpdateConf();
     Density       densityConf     = getSpreadingConf();
     bool          routingDriven   = getRoutingDriven();
+    unsigned int  clusterLevels   = getClusterLevels();
 
     startMeasures();
     double         sliceHeight = getSliceHeight() / getPitch();
@@ -835,9 +989,6 @@ namespace Etesian {
     cmess2 << "     - Computing initial placement..." << endl;
     cmess2 << right;
 
-    preplace();
-
-
     float_t minPenaltyIncrease, maxPenaltyIncrease, targetImprovement;
     int detailedIterations, detailedEffort;
     unsigned globalOptions=0, detailedOptions=0;
@@ -882,8 +1033,44 @@ namespace Etesian {
         detailedEffort     = 3;
     }
 
-    cmess1 << "  o  Global placement." << endl;
-    globalPlace(minPenaltyIncrease, sliceHeight, targetImprovement, minPenaltyIncrease, maxPenaltyIncrease, globalOptions);
+    // Restart from the last checkpoint only if it was taken on the same netlist
+    Checkpoint checkpoint;
+    if(_resume){
+      _resume = false;
+      if(checkpoint.load(getCheckpointPath()) and checkpoint.matches(_circuit)){
+        cmess1 << "  o  Resuming from <" << getCheckpointPath() << ">, "
+               << ((checkpoint.getStage() == Checkpoint::Global) ? "global" : "detailed")
+               << " placement iteration " << checkpoint.getIteration() << "." << endl;
+        _placementLB = checkpoint.getPlacementLB();
+        _placementUB = checkpoint.getPlacementUB();
+      }
+      else{
+        cerr << Warning("EtesianEngine::resumePlace(): No usable checkpoint <%s>, placing from scratch."
+                       ,getCheckpointPath().c_str()) << endl;
+        checkpoint = Checkpoint();
+      }
+    }
+    if(getCheckpointPeriod())
+      _checkpoints = new CheckpointWriter( getCheckpointPath() );
+
+    if(checkpoint.getStage() != Checkpoint::Detailed){
+      float_t initPenalty = minPenaltyIncrease;
+      if(checkpoint.getStage() == Checkpoint::Global)
+        initPenalty = checkpoint.getPullingForce();
+      else if(clusterLevels){
+        cmess1 << "  o  Multilevel global placement." << endl;
+        initPenalty = multilevelPlace(clusterLevels, sliceHeight, targetImprovement, minPenaltyIncrease, maxPenaltyIncrease, globalOptions);
+      }
+      else
+        preplace();
+
+      cmess1 << "  o  Global placement." << endl;
+      globalPlace(initPenalty, sliceHeight, targetImprovement, minPenaltyIncrease, maxPenaltyIncrease, globalOptions);
+      if(_checkpoints)
+        _saveCheckpoint( Checkpoint::Detailed, 0, 0.0 );
+    }
+    else
+      detailedIterations = std::max<int>(1, detailedIterations - checkpoint.getIteration());
 
     cmess1 << "  o  Detailed Placement." << endl;
     detailedPlace(detailedIterations, detailedEffort, detailedOptions);
@@ -912,22 +1099,180 @@ namespace Etesian {
         }
     }
 
+    // The placement is complete, a checkpoint would only be misleading now
+    if(_checkpoints){
+      _checkpoints->flush();
+      cmess2 << "     - Checkpoints written: " << _checkpoints->getWritten() << endl;
+      delete _checkpoints;
+      _checkpoints = NULL;
+      std::remove( getCheckpointPath().c_str() );
+    }
+
     cmess2 << "  o  Adding feed cells." << endl;
     addFeeds();
 
     cmess1 << "  o  Placement finished." << endl;
     stopMeasures();
     printMeasures( "total" );
-    cmess1 << ::Dots::asString
-      ( "     - HPWL", DbU::getValueString( (DbU::Unit)coloquinte::gp::get_HPWL_wirelength(_circuit,_placementUB )*getPitch() ) ) << endl;
-    cmess1 << ::Dots::asString
-      ( "     - RMST", DbU::getValueString( (DbU::Unit)coloquinte::gp::get_RSMT_wirelength(_circuit,_placementUB )*getPitch() ) ) << endl;
+
+    DbU::Unit hpwl = (DbU::Unit)_wirelengthUB->get_HPWL( _placementUB )*getPitch();
+    DbU::Unit rmst = (DbU::Unit)_wirelengthUB->get_RSMT( _placementUB )*getPitch();
+    cmess1 << ::Dots::asString( "     - HPWL", DbU::getValueString(hpwl) ) << endl;
+    cmess1 << ::Dots::asString( "     - RMST", DbU::getValueString(rmst) ) << endl;
+
+    addMeasure<double>            ( getCell(), "placeT" , _timer.getCombTime() );
+    addMeasure<unsigned long long>( getCell(), "HPWL(l)", (unsigned long long)DbU::toLambda(hpwl), 12 );
+    addMeasure<unsigned long long>( getCell(), "RMST(l)", (unsigned long long)DbU::toLambda(rmst), 12 );
 
     _placed = true;
 
     getCell()->setFlags( Cell::Flags::Placed );
   }
 
+  void  EtesianEngine::resumePlace ()
+  {
+    _resume = true;
+    place();
+  }
+
+
+  void  EtesianEngine::placeEco ()
+  {
+    using namespace coloquinte::dp;
+
+    if (not _placed) {
+      cmess2 << Warning("No previous placement to start from; running a full placement") << std::endl;
+      place();
+      return;
+    }
+
+    startMeasures();
+    cmess1 << "  o  ECO placement of <" << getCell()->getName() << ">." << endl;
+
+  // What was exported last time, to be compared with the current netlist.
+    unordered_map<string,unsigned int>  previousIds;
+    vector< point<int_t> >              previousSizes ( _circuit.cell_cnt() );
+    placement_t                         previousPlacement = _placementUB;
+    previousIds.swap( _cellsToIds );
+    for ( index_t i=0 ; i<_circuit.cell_cnt() ; ++i ) previousSizes[i] = _circuit.get_cell(i).size;
+
+    toColoquinte();
+
+    int_t           sliceHeight = getSliceHeight() / getPitch();
+    index_t         rowsNb      = (_surface.y_max_ - _surface.y_min_) / sliceHeight;
+    vector<index_t> ecoCells;
+    vector<char>    placed      ( _circuit.cell_cnt(), 1 );
+    for ( auto iid : _cellsToIds ) {
+      index_t id = iid.second;
+      if (not (_circuit.get_cell(id).attributes & coloquinte::XMovable)) continue;
+
+      auto iprevious = previousIds.find( iid.first );
+      if (  (iprevious == previousIds.end())
+         or (previousSizes[(*iprevious).second].x_ != _circuit.get_cell(id).size.x_)
+         or (previousSizes[(*iprevious).second].y_ != _circuit.get_cell(id).size.y_) ) {
+        ecoCells.push_back( id );
+        placed[id] = 0;
+      } else {
+        _placementUB.positions_   [id] = previousPlacement.positions_   [(*iprevious).second];
+        _placementUB.orientations_[id] = previousPlacement.orientations_[(*iprevious).second];
+      }
+    }
+    std::sort( ecoCells.begin(), ecoCells.end() );
+    cmess1 << "     - New or resized instances: " << ecoCells.size()
+           << " (" << (_circuit.cell_cnt() - ecoCells.size()) << " kept)." << endl;
+
+  // Put each new instance at the barycenter of its already placed neighbours. A second
+  // pass handles the instances only connected to other new ones.
+    for ( int pass=0 ; pass<2 ; ++pass ) {
+      for ( index_t id : ecoCells ) {
+        if (placed[id]) continue;
+
+        point<std::int64_t> sum ( 0, 0 );
+        std::int64_t        count = 0;
+        for ( auto pin : _circuit.get_cell(id) ) {
+          auto net = _circuit.get_net( pin.net_ind );
+          if (net.pin_cnt > 32) continue; // Global nets do not tell much about the location.
+          for ( auto other : net ) {
+            if (not placed[other.cell_ind]) continue;
+            sum.x_ += _placementUB.positions_[other.cell_ind].x_ + other.offset.x_;
+            sum.y_ += _placementUB.positions_[other.cell_ind].y_ + other.offset.y_;
+            ++count;
+          }
+        }
+        if (not count and not pass) continue;
+
+        point<int_t> size   = _circuit.get_cell(id).size;
+        point<int_t> center = (count) ? point<int_t>( sum.x_/count, sum.y_/count )
+                                      : point<int_t>( (_surface.x_min_+_surface.x_max_)/2, (_surface.y_min_+_surface.y_max_)/2 );
+        _placementUB.positions_[id] = point<int_t>
+          ( std::max( _surface.x_min_, std::min(_surface.x_max_-size.x_, center.x_-size.x_/2) )
+          , std::max( _surface.y_min_, std::min(_surface.y_max_-size.y_, center.y_-size.y_/2) ) );
+        placed[id] = 1;
+      }
+    }
+
+  // Only the rows around the inserted instances are legalized again, the other cells
+  // act as obstacles.
+    vector<char> activeRows ( rowsNb, 0 );
+    auto         rowOf      = [&]( index_t id ) -> index_t {
+      return std::min<index_t>( rowsNb-1, std::max<int_t>(0, _placementUB.positions_[id].y_ - _surface.y_min_) / sliceHeight );
+    };
+    for ( index_t id : ecoCells ) {
+      index_t row = rowOf( id );
+      index_t end = std::min<index_t>( rowsNb, row + (_circuit.get_cell(id).size.y_ + sliceHeight - 1)/sliceHeight + 1 );
+      for ( index_t r=(row ? row-1 : 0) ; r<end ; ++r ) activeRows[r] = 1;
+    }
+    vector<char> legalized ( _circuit.cell_cnt(), 0 );
+    for ( index_t id=0 ; id<_circuit.cell_cnt() ; ++id ) {
+      if (not (_circuit.get_cell(id).attributes & coloquinte::XMovable)) continue;
+      if (not placed[id] or activeRows[rowOf(id)]) legalized[id] = 1;
+    }
+    for ( index_t id : ecoCells ) legalized[id] = 1;
+
+    _placementLB = _placementUB;
+    auto legalizer = legalize( _circuit, _placementUB, _surface, sliceHeight, legalized );
+
+  // Some instances may have found room outside of the initial rows.
+    legalizer.active_rows_.assign( legalizer.row_cnt(), 0 );
+    for ( index_t id=0 ; id<_circuit.cell_cnt() ; ++id ) {
+      if (not legalized[id]) continue;
+      for ( index_t r=0 ; r<legalizer.cell_height(id) ; ++r )
+        legalizer.active_rows_[ legalizer.cell_rows_[id] + r ] = 1;
+    }
+    coloquinte::dp::get_result( _circuit, legalizer, _placementUB );
+    _progressReport1("     [ECO] Legalized ......" );
+
+    row_compatible_orientation( _circuit, legalizer, true );
+    swaps_global_HPWL( _circuit, legalizer, 3, 4 );
+    OSRP_convex_HPWL( _circuit, legalizer );
+    swaps_row_convex_HPWL( _circuit, legalizer, 4 );
+    row_compatible_orientation( _circuit, legalizer, true );
+    coloquinte::dp::get_result( _circuit, legalizer, _placementUB );
+    verify_placement_legality( _circuit, _placementUB, _surface );
+
+    size_t rowsCount = 0;
+    for ( char active : legalizer.active_rows_ ) if (active) ++rowsCount;
+    _progressReport1("     [ECO] Optimized ......" );
+    cmess2 << "     - Rows optimized: " << rowsCount << " out of " << rowsNb << "." << endl;
+
+    _placementLB = _placementUB;
+    _updatePlacement( _placementUB );
+
+    cmess2 << "  o  Adding feed cells." << endl;
+    addFeeds();
+
+    cmess1 << "  o  ECO placement finished." << endl;
+    stopMeasures();
+    printMeasures( "eco" );
+
+    DbU::Unit hpwl = (DbU::Unit)_wirelengthUB->get_HPWL( _placementUB )*getPitch();
+    cmess1 << ::Dots::asString( "     - HPWL", DbU::getValueString(hpwl) ) << endl;
+    addMeasure<double>( getCell(), "ecoT", _timer.getCombTime() );
+
+    _placed = true;
+    getCell()->setFlags( Cell::Flags::Placed );
+  }
+
 
   void  EtesianEngine::_progressReport1 ( string label ) const
   {
@@ -942,8 +1287,8 @@ namespace Etesian {
     //elapsed << "  dTime:" << setw(5) << _timer.getCombTime() << "s ";
 
     cmess2 << label << elapsed.str()
-           << " HPWL:" << setw(11) << coloquinte::gp::get_HPWL_wirelength( _circuit, _placementUB )
-           << " RMST:" << setw(11) << coloquinte::gp::get_RSMT_wirelength( _circuit, _placementUB )
+           << " HPWL:" << setw(11) << _wirelengthUB->get_HPWL( _placementUB )
+           << " RMST:" << setw(11) << _wirelengthUB->get_RSMT( _placementUB )
            << endl;
     cparanoid << indent
            <<   " L-Dsrpt:" << setw(8) << coloquinte::gp::get_mean_linear_disruption   ( _circuit, _placementLB, _placementUB )
@@ -952,6 +1297,14 @@ namespace Etesian {
   }
 
 
+  void  EtesianEngine::_saveCheckpoint ( unsigned int stage, unsigned int iteration, float pullingForce )
+  {
+  // Only the copy of the placements is done here, the file is written
+  // by the background thread.
+    _checkpoints->push( Checkpoint( stage, iteration, pullingForce, _circuit, _placementLB, _placementUB ) );
+  }
+
+
   void  EtesianEngine::_progressReport2 ( string label ) const
   {
     size_t w      = label.size();
@@ -965,8 +1318,8 @@ namespace Etesian {
     //elapsed << "  dTime:" << setw(5) << _timer.getCombTime() << "s ";
 
     cmess2 << label << elapsed.str()
-           << " HPWL:" << setw(11) << coloquinte::gp::get_HPWL_wirelength( _circuit, _placementLB )
-           << " RMST:" << setw(11) << coloquinte::gp::get_RSMT_wirelength( _circuit, _placementLB )
+           << " HPWL:" << setw(11) << _wirelengthLB->get_HPWL( _placementLB )
+           << " RMST:" << setw(11) << _wirelengthLB->get_RSMT( _placementLB )
            << endl;
   }
 
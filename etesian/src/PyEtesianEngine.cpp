@@ -144,6 +144,40 @@ extern "C" {
     Py_RETURN_NONE;
   }
 
+  static PyObject* PyEtesianEngine_placeEco ( PyEtesianEngine* self )
+  {
+    trace << "PyEtesianEngine_placeEco()" << endl;
+    HTRY
+    METHOD_HEAD("EtesianEngine.placeEco()")
+    if (etesian->getViewer()) {
+      if (ExceptionWidget::catchAllWrapper( std::bind(&EtesianEngine::placeEco,etesian) )) {
+        PyErr_SetString( HurricaneError, "EtesianEngine::placeEco() has thrown an exception (C++)." );
+        return NULL;
+      }
+    } else {
+      etesian->placeEco();
+    }
+    HCATCH
+    Py_RETURN_NONE;
+  }
+
+  static PyObject* PyEtesianEngine_resumePlace ( PyEtesianEngine* self )
+  {
+    trace << "PyEtesianEngine_resumePlace()" << endl;
+    HTRY
+    METHOD_HEAD("EtesianEngine.resumePlace()")
+    if (etesian->getViewer()) {
+      if (ExceptionWidget::catchAllWrapper( std::bind(&EtesianEngine::resumePlace,etesian) )) {
+        PyErr_SetString( HurricaneError, "EtesianEngine::resumePlace() has thrown an exception (C++)." );
+        return NULL;
+      }
+    } else {
+      etesian->resumePlace();
+    }
+    HCATCH
+    Py_RETURN_NONE;
+  }
+
   // Standart Accessors (Attributes).
   // DirectVoidMethod(EtesianEngine,etesian,runNegociate)
   // DirectGetBoolAttribute(PyEtesianEngine_getToolSuccess,getToolSuccess,PyEtesianEngine,EtesianEngine)
@@ -161,6 +195,10 @@ extern "C" {
                             , "Associate a Viewer to this EtesianEngine." }
     , { "place"             , (PyCFunction)PyEtesianEngine_place             , METH_NOARGS
                             , "Run the placer (Etesian)." }
+    , { "placeEco"          , (PyCFunction)PyEtesianEngine_placeEco          , METH_NOARGS
+                            , "Incremental placement of the new or resized instances." }
+    , { "resumePlace"       , (PyCFunction)PyEtesianEngine_resumePlace       , METH_NOARGS
+                            , "Run the placer, restarting from the last checkpoint if any." }
     , { "destroy"           , (PyCFunction)PyEtesianEngine_destroy           , METH_NOARGS
                             , "Destroy the associated hurricane object. The python object remains." }
     , {NULL, NULL, 0, NULL} /* sentinel */
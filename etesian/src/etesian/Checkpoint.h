@@ -0,0 +1,118 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |   E t e s i a n  -  A n a l y t i c   P l a c e r               |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Header  :       "./etesian/Checkpoint.h"                   |
+// +-----------------------------------------------------------------+
+
+
+#ifndef ETESIAN_CHECKPOINT_H
+#define ETESIAN_CHECKPOINT_H
+
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "coloquinte/netlist.hxx"
+
+
+namespace Etesian {
+
+
+// -------------------------------------------------------------------
+// Class  :  "Etesian::Checkpoint".
+//
+// Snapshot of the placement state: both placements (lower and upper
+// bound) and where the placer was when it was taken. The file is a
+// compact native endian binary dump, only meant to be read back on
+// the same machine, by the same netlist. The netlist is identified
+// by its cell, net & pin counts.
+
+  class Checkpoint {
+    public:
+      enum Stage { Global=1, Detailed=2 };
+    public:
+                                    Checkpoint   ();
+                                    Checkpoint   ( unsigned int stage, unsigned int iteration, float pullingForce
+                                                 , const coloquinte::netlist&
+                                                 , const coloquinte::placement_t& placementLB
+                                                 , const coloquinte::placement_t& placementUB );
+      inline  unsigned int          getStage     () const;
+      inline  unsigned int          getIteration () const;
+      inline  float                 getPullingForce () const;
+      inline  const coloquinte::placement_t&
+                                    getPlacementLB  () const;
+      inline  const coloquinte::placement_t&
+                                    getPlacementUB  () const;
+              bool                  matches      ( const coloquinte::netlist& ) const;
+              bool                  save         ( const std::string& path ) const;
+              bool                  load         ( const std::string& path );
+    private:
+      unsigned int             _stage;
+      unsigned int             _iteration;
+      float                    _pullingForce;
+      unsigned int             _cellCount;
+      unsigned int             _netCount;
+      unsigned int             _pinCount;
+      coloquinte::placement_t  _placementLB;
+      coloquinte::placement_t  _placementUB;
+  };
+
+
+  inline  unsigned int                    Checkpoint::getStage        () const { return _stage; }
+  inline  unsigned int                    Checkpoint::getIteration    () const { return _iteration; }
+  inline  float                           Checkpoint::getPullingForce () const { return _pullingForce; }
+  inline  const coloquinte::placement_t&  Checkpoint::getPlacementLB  () const { return _placementLB; }
+  inline  const coloquinte::placement_t&  Checkpoint::getPlacementUB  () const { return _placementUB; }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Etesian::CheckpointWriter".
+//
+// Writes the checkpoints from a background thread, so the placer only
+// pays for the copy of the placements. Only the most recent snapshot
+// is kept: if the disk is slower than the placer, the intermediate
+// ones are dropped. The destructor waits for the last pending write.
+
+  class CheckpointWriter {
+    public:
+                           CheckpointWriter ( const std::string& path );
+                          ~CheckpointWriter ();
+      inline  const std::string&
+                           getPath          () const;
+      inline  unsigned int getWritten       () const;
+              void         push             ( Checkpoint&& );
+              void         flush            ();
+    private:
+              void         _run             ();
+    private:
+      std::string              _path;
+      std::mutex               _mutex;
+      std::condition_variable  _condition;
+      Checkpoint               _pending;
+      bool                     _hasPending;
+      bool                     _writing;
+      bool                     _stop;
+      unsigned int             _written;
+      std::thread              _thread;
+    private:
+                         CheckpointWriter ( const CheckpointWriter& );
+      CheckpointWriter&  operator=        ( const CheckpointWriter& );
+  };
+
+
+  inline  const std::string&  CheckpointWriter::getPath    () const { return _path; }
+  inline  unsigned int        CheckpointWriter::getWritten () const { return _written; }
+
+
+} // Etesian namespace.
+
+#endif  // ETESIAN_CHECKPOINT_H
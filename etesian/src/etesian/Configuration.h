@@ -69,6 +69,11 @@ namespace Etesian {
       inline bool             getRoutingDriven  () const;
       inline double           getSpaceMargin   () const;
       inline double           getAspectRatio   () const;
+      inline unsigned int     getBandRows      () const;
+      inline unsigned int     getClusterLevels () const;
+      inline unsigned int     getRudyBinSize   () const;
+      inline unsigned int     getRudyPeriod    () const;
+      inline unsigned int     getCheckpointPeriod () const;
              void             print            ( Cell* ) const;
              Record*          _getRecord       () const;
              string           _getString       () const;
@@ -82,6 +87,11 @@ namespace Etesian {
       bool           _routingDriven;
       double         _spaceMargin;
       double         _aspectRatio;
+      unsigned int   _bandRows;
+      unsigned int   _clusterLevels;
+      unsigned int   _rudyBinSize;
+      unsigned int   _rudyPeriod;
+      unsigned int   _checkpointPeriod;
     private:
                              Configuration ( const Configuration& );
       Configuration& operator=             ( const Configuration& );
@@ -95,6 +105,11 @@ namespace Etesian {
   inline bool          Configuration::getRoutingDriven () const { return _routingDriven; }
   inline double        Configuration::getSpaceMargin   () const { return _spaceMargin; }
   inline double        Configuration::getAspectRatio   () const { return _aspectRatio; }
+  inline unsigned int  Configuration::getBandRows      () const { return _bandRows; }
+  inline unsigned int  Configuration::getClusterLevels () const { return _clusterLevels; }
+  inline unsigned int  Configuration::getRudyBinSize   () const { return _rudyBinSize; }
+  inline unsigned int  Configuration::getRudyPeriod    () const { return _rudyPeriod; }
+  inline unsigned int  Configuration::getCheckpointPeriod () const { return _checkpointPeriod; }
 
 
 } // Etesian namespace.
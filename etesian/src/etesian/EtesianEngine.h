@@ -20,6 +20,9 @@
 #include <iostream>
 #include <unordered_map>
 #include "coloquinte/circuit.hxx"
+#include "coloquinte/wirelength.hxx"
+#include "coloquinte/clustering.hxx"
+#include "coloquinte/congestion.hxx"
 
 #include "hurricane/Timer.h"
 #include "hurricane/Name.h"
@@ -35,6 +38,7 @@ namespace Hurricane {
 #include "crlcore/ToolEngine.h"
 #include "etesian/Configuration.h"
 #include "etesian/FeedCells.h"
+#include "etesian/Checkpoint.h"
 
 
 namespace Etesian {
@@ -69,6 +73,12 @@ namespace Etesian {
       inline  bool                   getRoutingDriven () const;
       inline  double                 getSpaceMargin   () const;
       inline  double                 getAspectRatio   () const;
+      inline  unsigned int           getBandRows      () const;
+      inline  unsigned int           getClusterLevels () const;
+      inline  unsigned int           getRudyBinSize   () const;
+      inline  unsigned int           getRudyPeriod    () const;
+      inline  unsigned int           getCheckpointPeriod () const;
+              std::string            getCheckpointPath   () const;
       inline  const FeedCells&       getFeedCells     () const;
       inline  Hurricane::CellViewer* getViewer        () const;
       inline  void                   setViewer        ( Hurricane::CellViewer* );
@@ -83,11 +93,15 @@ namespace Etesian {
                                      
               void                   preplace         ();
               void                   roughLegalize    ( float minDisruption, unsigned options );
-              void                   globalPlace      ( float initPenalty, float minDisruption, float targetImprovement, float minInc, float maxInc, unsigned options=0 );
+              float                  globalPlace      ( float initPenalty, float minDisruption, float targetImprovement, float minInc, float maxInc, unsigned options=0 );
+              float                  multilevelPlace  ( unsigned int levels, float minDisruption, float targetImprovement, float minInc, float maxInc, unsigned options=0 );
               void                   detailedPlace    ( int iterations, int effort, unsigned options=0 );
               void                   feedRoutingBack  ();
+              void                   feedCongestion   ();
                                      
               void                   place            ();
+              void                   placeEco         ();
+              void                   resumePlace      ();
                                      
       inline  void                   useFeed          ( Cell* );
               size_t                 findYSpin        ();
@@ -110,11 +124,20 @@ namespace Etesian {
              coloquinte::placement_t                  _placementLB;
              coloquinte::placement_t                  _placementUB;
              coloquinte::density_restrictions         _densityLimits;
+             coloquinte::density_restrictions         _routingDensityLimits;
+             coloquinte::point<coloquinte::gp::assembled_system>
+                                                      _linearSystems;
+             coloquinte::gp::wirelength_tracker*      _wirelengthLB;
+             coloquinte::gp::wirelength_tracker*      _wirelengthUB;
+             coloquinte::gp::congestion_map*          _congestion;
+             float                                    _routingCapacity;
              std::unordered_map<string,unsigned int>  _cellsToIds;
              std::vector<Instance*>                   _idsToInsts;
              Hurricane::CellViewer*                   _viewer;
              FeedCells                                _feedCells;
              size_t                                   _yspinSlice0;
+             CheckpointWriter*                        _checkpoints;
+             bool                                     _resume;
 
     protected:
     // Constructors & Destructors.
@@ -129,6 +152,7 @@ namespace Etesian {
               void           _updatePlacement ( const coloquinte::placement_t& );
               void           _progressReport1 ( string label ) const;
               void           _progressReport2 ( string label ) const;
+              void           _saveCheckpoint  ( unsigned int stage, unsigned int iteration, float pullingForce );
   };
 
 
@@ -144,6 +168,11 @@ namespace Etesian {
   inline  bool                   EtesianEngine::getRoutingDriven () const { return getConfiguration()->getRoutingDriven(); }
   inline  double                 EtesianEngine::getSpaceMargin   () const { return getConfiguration()->getSpaceMargin(); }
   inline  double                 EtesianEngine::getAspectRatio   () const { return getConfiguration()->getAspectRatio(); }
+  inline  unsigned int           EtesianEngine::getBandRows      () const { return getConfiguration()->getBandRows(); }
+  inline  unsigned int           EtesianEngine::getClusterLevels () const { return getConfiguration()->getClusterLevels(); }
+  inline  unsigned int           EtesianEngine::getRudyBinSize   () const { return getConfiguration()->getRudyBinSize(); }
+  inline  unsigned int           EtesianEngine::getRudyPeriod    () const { return getConfiguration()->getRudyPeriod(); }
+  inline  unsigned int           EtesianEngine::getCheckpointPeriod () const { return getConfiguration()->getCheckpointPeriod(); }
   inline  void                   EtesianEngine::useFeed          ( Cell* cell ) { _feedCells.useFeed(cell); }
   inline  const FeedCells&       EtesianEngine::getFeedCells     () const { return _feedCells; }
 
@@ -17,6 +17,7 @@
 // not, see <http://www.gnu.org/licenses/>.
 // ****************************************************************************************************
 
+#include <unordered_set>
 #include "hurricane/HyperNet.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Net.h"
@@ -28,6 +29,8 @@
 
 namespace Hurricane {
 
+    using std::unordered_set;
+
 
 
 // ****************************************************************************************************
@@ -50,7 +53,7 @@ class HyperNet_NetOccurrences : public Collection<Occurrence> {
         private: const HyperNet* _hyperNet;
         private: bool _doExtraction;
         private: bool _allowInterruption;
-        private: set<Occurrence> _netOccurrenceSet;
+        private: unordered_set<Occurrence,Occurrence::HashKey> _netOccurrenceSet;
         private: stack<Occurrence> _netOccurrenceStack;
 
         public: Locator();
@@ -123,7 +126,7 @@ class HyperNet_NetOccurrencesUnder : public Collection<Occurrence> {
     private: Box  _area;
         private: bool _doExtraction;
         private: bool _allowInterruption;
-        private: set<Occurrence> _netOccurrenceSet;
+        private: unordered_set<Occurrence,Occurrence::HashKey> _netOccurrenceSet;
         private: stack<Occurrence> _netOccurrenceStack;
 
         public: Locator();
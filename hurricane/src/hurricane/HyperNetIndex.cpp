@@ -0,0 +1,217 @@
+// -*- C++ -*-
+//
+// Copyright (c) 2026, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :  "./HyperNetIndex.cpp"                           |
+// +-----------------------------------------------------------------+
+
+
+#include <stack>
+#include <unordered_set>
+#include "hurricane/HyperNetIndex.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Net.h"
+#include "hurricane/Instance.h"
+#include "hurricane/Plug.h"
+#include "hurricane/Error.h"
+
+
+namespace Hurricane {
+
+  using std::stack;
+  using std::unordered_set;
+  using std::vector;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::HyperNetIndex".
+
+
+  unsigned int  HyperNetIndex::_revision = 0;
+
+
+  HyperNetIndex::HyperNetIndex ()
+    : PrivateProperty()
+    , _builtRevision (_revision)
+    , _entries       ()
+    , _netToEntry    ()
+  { }
+
+
+  const Name& HyperNetIndex::getPropertyName ()
+  {
+    static Name name = "Hurricane::HyperNetIndex";
+    return name;
+  }
+
+
+  HyperNetIndex* HyperNetIndex::get ( const Cell* cell )
+  {
+    if (not cell) return NULL;
+
+    Property* property = cell->getProperty( getPropertyName() );
+    if (not property) return NULL;
+
+    HyperNetIndex* index = dynamic_cast<HyperNetIndex*>( property );
+    if (not index)
+      throw Error( "HyperNetIndex::get(): Bad property type for \"%s\" on %s."
+                 , getString(getPropertyName()).c_str()
+                 , getString(cell).c_str() );
+    return index;
+  }
+
+
+  HyperNetIndex* HyperNetIndex::create ( Cell* cell )
+  {
+    HyperNetIndex* index = get( cell );
+    if (index) return index;
+
+    index = new HyperNetIndex();
+    index->_postCreate();
+    cell->put( index );
+
+    return index;
+  }
+
+
+  Name  HyperNetIndex::getName () const
+  { return getPropertyName(); }
+
+
+  Cell* HyperNetIndex::getCell () const
+  { return static_cast<Cell*>( getOwner() ); }
+
+
+  void  HyperNetIndex::clear ()
+  {
+    _entries   .clear();
+    _netToEntry.clear();
+    _builtRevision = _revision;
+  }
+
+
+  const HyperNetIndex::Entry& HyperNetIndex::getEntry ( const Occurrence& netOccurrence )
+  {
+    if (_builtRevision != _revision) clear();
+
+    auto ientry = _netToEntry.find( netOccurrence );
+    if (ientry != _netToEntry.end()) return _entries[ ientry->second ];
+
+    return _build( netOccurrence );
+  }
+
+
+  HyperNetIndex::Entry& HyperNetIndex::_build ( const Occurrence& rootOccurrence )
+  {
+    if (not dynamic_cast<Net*>(rootOccurrence.getEntity()))
+      throw Error( "HyperNetIndex::getEntry(): %s is not a net occurrence."
+                 , getString(rootOccurrence).c_str() );
+
+    if (rootOccurrence.getOwnerCell() != getCell())
+      throw Error( "HyperNetIndex::getEntry(): %s do not belong to %s."
+                 , getString(rootOccurrence).c_str()
+                 , getString(getCell()).c_str() );
+
+    size_t  entryIndex = _entries.size();
+    _entries.push_back( Entry() );
+    Entry&  entry      = _entries.back();
+
+  // Same walk as HyperNet_NetOccurrences::Locator, without extraction.
+    unordered_set<Occurrence,Occurrence::HashKey>  netOccurrenceSet;
+    stack<Occurrence>                              netOccurrenceStack;
+
+    netOccurrenceSet  .insert( rootOccurrence );
+    netOccurrenceStack.push  ( rootOccurrence );
+
+    while ( not netOccurrenceStack.empty() ) {
+      Occurrence netOccurrence = netOccurrenceStack.top();
+      netOccurrenceStack.pop();
+
+      entry._netOccurrences.push_back( netOccurrence );
+      _netToEntry[ netOccurrence ] = entryIndex;
+
+      Net* net  = static_cast<Net*>( netOccurrence.getEntity() );
+      Path path = netOccurrence.getPath();
+
+      for ( Plug* plug : net->getPlugs() ) {
+        Occurrence occurrence = Occurrence( plug->getMasterNet(), Path(path,plug->getInstance()) );
+        if (netOccurrenceSet.insert(occurrence).second)
+          netOccurrenceStack.push( occurrence );
+      }
+
+    // The root is the only net occurrence with no connected plug above it.
+      bool isRoot = true;
+      if (net->isExternal()) {
+        Instance* instance = path.getTailInstance();
+        if (instance) {
+          Plug* plug = instance->getPlug( net );
+          if (plug and plug->getNet()) {
+            isRoot = false;
+            Occurrence occurrence = Occurrence( plug->getNet(), path.getHeadPath() );
+            if (netOccurrenceSet.insert(occurrence).second)
+              netOccurrenceStack.push( occurrence );
+          }
+        }
+      }
+      if (isRoot) entry._rootNetOccurrence = netOccurrence;
+
+    // Same selection as HyperNet_LeafPlugOccurrences::Locator.
+      if (not path.isEmpty() and net->getCell()->isTerminal()) {
+        Plug* plug = path.getTailInstance()->getPlug( net );
+        if (plug) entry._leafPlugOccurrences.push_back( Occurrence(plug,path.getHeadPath()) );
+      }
+    }
+
+    return entry;
+  }
+
+
+  string  HyperNetIndex::_getTypeName () const
+  { return _TName( "HyperNetIndex" ); }
+
+
+  string  HyperNetIndex::_getString () const
+  {
+    string s = PrivateProperty::_getString();
+    s.insert( s.length() - 1, " " + getString(_entries.size()) );
+    if (_builtRevision != _revision) s.insert( s.length() - 1, " [invalid]" );
+    return s;
+  }
+
+
+  Record* HyperNetIndex::_getRecord () const
+  {
+    Record* record = PrivateProperty::_getRecord();
+    if (record) {
+      record->add( getSlot("_revision"     , _revision      ) );
+      record->add( getSlot("_builtRevision", _builtRevision ) );
+      record->add( getSlot("_netToEntry"   , _netToEntry.size() ) );
+    }
+    return record;
+  }
+
+
+}  // Hurricane namespace.
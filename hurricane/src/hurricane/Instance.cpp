@@ -177,7 +177,7 @@ Instance::Instance(Cell* cell, const Name& name, Cell* masterCell, const Transfo
     _transformation(transformation),
     _placementStatus(placementstatus),
     _plugMap(),
-    _sharedPathMap(),
+    _firstSharedPath(NULL),
     _nextOfCellInstanceMap(NULL),
     _nextOfCellSlaveInstanceSet(NULL)
 {
@@ -442,11 +442,13 @@ void Instance::setMasterCell(Cell* masterCell, bool secureFlag)
             end_for;
         }
 
-        for_each_shared_path(sharedPath, _getSharedPathes()) {
+        // Deleting a SharedPath only deletes the ones of other (slave) instances
+        for (SharedPath* sharedPath = _firstSharedPath; sharedPath; ) {
+            SharedPath* nextSharedPath = sharedPath->_getNextOfInstance();
             if (!sharedPath->getTailSharedPath())
                 // if the tail is empty the SharedPath isn't impacted by the change
                 delete sharedPath;
-            end_for;
+            sharedPath = nextSharedPath;
         }
 
         invalidate(true);
@@ -556,7 +558,7 @@ void Instance::_postCreate()
 void Instance::_preDestroy()
 // ************************
 {
-    for_each_shared_path(sharedPath, _getSharedPathes()) delete sharedPath; end_for;
+    while (_firstSharedPath) delete _firstSharedPath;
 
     Inherit::_preDestroy();
 
@@ -568,6 +570,29 @@ void Instance::_preDestroy()
     if (_masterCell->isUniquified()) _masterCell->destroy();
 }
 
+void Instance::_addSharedPath(SharedPath* sharedPath)
+// **************************************************
+{
+    sharedPath->_setPreviousOfInstance(NULL);
+    sharedPath->_setNextOfInstance(_firstSharedPath);
+    if (_firstSharedPath) _firstSharedPath->_setPreviousOfInstance(sharedPath);
+    _firstSharedPath = sharedPath;
+}
+
+void Instance::_removeSharedPath(SharedPath* sharedPath)
+// *****************************************************
+{
+    SharedPath* previousSharedPath = sharedPath->_getPreviousOfInstance();
+    SharedPath* nextSharedPath     = sharedPath->_getNextOfInstance();
+
+    if (previousSharedPath) previousSharedPath->_setNextOfInstance(nextSharedPath);
+    else                    _firstSharedPath = nextSharedPath;
+    if (nextSharedPath) nextSharedPath->_setPreviousOfInstance(previousSharedPath);
+
+    sharedPath->_setPreviousOfInstance(NULL);
+    sharedPath->_setNextOfInstance(NULL);
+}
+
 string Instance::_getString() const
 // ********************************
 {
@@ -590,7 +615,7 @@ Record* Instance::_getRecord() const
         record->add(getSlot("XCenter", DbU::getValueString(getAbutmentBox().getXCenter())));
         record->add(getSlot("YCenter", DbU::getValueString(getAbutmentBox().getYCenter())));
         record->add(getSlot("Plugs", &_plugMap));
-        record->add(getSlot("SharedPathes", &_sharedPathMap));
+        record->add(getSlot("FirstSharedPath", _firstSharedPath));
     }
     return record;
 }
@@ -631,40 +656,6 @@ void Instance::PlugMap::_setNextElement(Plug* plug, Plug* nextPlug) const
 
 
 
-// ****************************************************************************************************
-// Instance::SharedPathMap implementation
-// ****************************************************************************************************
-
-Instance::SharedPathMap::SharedPathMap()
-// *************************************
-:    Inherit()
-{
-}
-
-const SharedPath* Instance::SharedPathMap::_getKey(SharedPath* sharedPath) const
-// *****************************************************************************
-{
-    return sharedPath->getTailSharedPath();
-}
-
-unsigned Instance::SharedPathMap::_getHashValue(const SharedPath* tailSharedPath) const
-// ************************************************************************************
-{
-  return (tailSharedPath) ? (tailSharedPath->getId()/8) : 0;
-}
-
-SharedPath* Instance::SharedPathMap::_getNextElement(SharedPath* sharedPath) const
-// *******************************************************************************
-{
-    return sharedPath->_getNextOfInstanceSharedPathMap();
-}
-
-void Instance::SharedPathMap::_setNextElement(SharedPath* sharedPath, SharedPath* nextSharedPath) const
-// ****************************************************************************************************
-{
-    sharedPath->_setNextOfInstanceSharedPathMap(nextSharedPath);
-};
-
 // ****************************************************************************************************
 // Instance::PlacementStatus implementation
 // ****************************************************************************************************
@@ -30,6 +30,7 @@
 #include "hurricane/Horizontal.h"
 #include "hurricane/Pad.h"
 #include "hurricane/UpdateSession.h"
+#include "hurricane/HyperNetIndex.h"
 #include "hurricane/Error.h"
 
 namespace Hurricane {
@@ -458,6 +459,7 @@ void Net::setExternal(bool isExternal)
 // ***********************************
 {
     if (isExternal != _isExternal) {
+        HyperNetIndex::invalidateAll();
         if (!isExternal) {
             if (!getConnectedSlavePlugs().isEmpty())
                 throw Error("Can't set internal : has connected slave plugs");
@@ -680,6 +682,8 @@ void Net::_preDestroy()
 {
     Inherit::_preDestroy();
 
+    HyperNetIndex::invalidateAll();
+
     for_each_plug(slavePlug, getSlavePlugs()) slavePlug->_destroy(); end_for;
 
     unmaterialize();
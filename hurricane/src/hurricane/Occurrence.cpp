@@ -92,6 +92,13 @@ bool Occurrence::operator<(const Occurrence& occurrence) const
               ((_entity == occurrence._entity) && (_sharedPath < occurrence._sharedPath)));
 }
 
+uint64_t Occurrence::getKey() const
+// *********************************
+{
+    if (!_entity) return 0;
+    return ((uint64_t)((_sharedPath) ? _sharedPath->getId()+1 : 0) << 32) | _entity->getId();
+}
+
 Cell* Occurrence::getOwnerCell() const
 // **********************************
 {
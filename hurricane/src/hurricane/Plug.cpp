@@ -21,6 +21,7 @@
 #include "hurricane/Net.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Instance.h"
+#include "hurricane/HyperNetIndex.h"
 #include "hurricane/Error.h"
 
 namespace Hurricane {
@@ -147,6 +148,7 @@ void Plug::setNet(Net* net)
         }
 
         _setNet(net);
+        HyperNetIndex::invalidateAll();
     }
 }
 
@@ -164,6 +166,7 @@ void Plug::_postCreate()
 // *********************
 {
     _instance->_getPlugMap()._insert(this);
+    HyperNetIndex::invalidateAll();
 
     Inherit::_postCreate();
 }
@@ -185,6 +188,7 @@ void Plug::_preDestroy()
     Inherit::_preDestroy();
 
     _instance->_getPlugMap()._remove(this);
+    HyperNetIndex::invalidateAll();
 
 // trace << "exiting Plug::_preDestroy:" << endl;
 // trace_out();
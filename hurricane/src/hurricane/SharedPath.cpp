@@ -18,6 +18,9 @@
 // ****************************************************************************************************
 
 #include <limits>
+#include <vector>
+#include <unordered_map>
+#include <stdint.h>
 #include "hurricane/SharedPath.h"
 #include "hurricane/Instance.h"
 #include "hurricane/Cell.h"
@@ -98,22 +101,96 @@ class SharedPath_Instances : public Collection<Instance*> {
 // ****************************************************************************************************
 
 static char NAME_SEPARATOR = '.';
-unsigned int  SharedPath::_idCounter = 0;
+
+
+// Global hash-consing table. Every SharedPath is uniquely identified by
+// its head instance and its tail SharedPath, the pair being packed into
+// a 64 bits key. Identifiers are kept dense by recycling the ones of
+// destroyed pathes, so they can be used directly as array indexes. The
+// key is *not* built upon them but upon the Entity identifier of the head
+// and the serial of the tail, neither of which is ever reused, so a key
+// can never alias the one of a dead SharedPath. This table is the only
+// lookup: an Instance merely chains its SharedPathes to destroy them.
+//
+// Like the rest of the database, the tables are not thread safe. Lookups
+// may run concurrently only while no thread creates or destroys a
+// SharedPath, that is, builds a Path or an Occurrence that did not exist
+// yet, or edits the hierarchy.
+
+namespace {
+
+  typedef std::unordered_map<uint64_t,SharedPath*>  SharedPathTable;
+
+// Allocated once and never freed, as SharedPathes may still be deleted
+// from the destructors of other static objects.
+  std::vector<SharedPath*>*   ID_TABLE          = NULL;
+  std::vector<unsigned int>*  FREE_IDS          = NULL;
+  SharedPathTable*            SHARED_PATH_TABLE = NULL;
+  unsigned int                SERIAL_COUNTER    = 0;
+
+  SharedPathTable& getSharedPathTable ()
+  {
+    if (not SHARED_PATH_TABLE) {
+      SHARED_PATH_TABLE = new SharedPathTable();
+      ID_TABLE          = new std::vector<SharedPath*>();
+      FREE_IDS          = new std::vector<unsigned int>();
+    }
+    return *SHARED_PATH_TABLE;
+  }
+
+  inline uint64_t  getSharedPathKey ( const Instance* headInstance, const SharedPath* tailSharedPath )
+  {
+    return ((uint64_t)headInstance->getId() << 32)
+         | (uint64_t)((tailSharedPath) ? tailSharedPath->_getSerial()+1 : 0);
+  }
+
+  unsigned int  allocateSerial ()
+  {
+    if (SERIAL_COUNTER >= std::numeric_limits<unsigned int>::max()-1)
+      throw Error( "SharedPath::SharedPath(): Serial counter has reached it's limit (%d bits)."
+                 , std::numeric_limits<unsigned int>::digits );
+    return SERIAL_COUNTER++;
+  }
+
+  unsigned int  allocateId ( SharedPath* sharedPath )
+  {
+    getSharedPathTable();
+
+    if (not FREE_IDS->empty()) {
+      unsigned int id = FREE_IDS->back();
+      FREE_IDS->pop_back();
+      (*ID_TABLE)[id] = sharedPath;
+      return id;
+    }
+
+    if (ID_TABLE->size() >= (size_t)std::numeric_limits<unsigned int>::max()-1)
+      throw Error( "SharedPath::SharedPath(): Identifier table has reached it's limit (%d bits)."
+                 , std::numeric_limits<unsigned int>::digits );
+
+    ID_TABLE->push_back( sharedPath );
+    return ID_TABLE->size() - 1;
+  }
+
+  void  releaseId ( unsigned int id )
+  {
+    (*ID_TABLE)[id] = NULL;
+    FREE_IDS->push_back( id );
+  }
+
+}  // Anonymous namespace.
+
 
 
 SharedPath::SharedPath(Instance* headInstance, SharedPath* tailSharedPath)
 // ***********************************************************************
-  : _id(_idCounter++),
+  : _id(0),
+    _serial(0),
     _headInstance(headInstance),
     _tailSharedPath(tailSharedPath),
     _quarkMap(),
-    _nextOfInstanceSharedPathMap(NULL)
+    _previousOfInstance(NULL),
+    _nextOfInstance(NULL)
 {
-    if (_idCounter == std::numeric_limits<unsigned int>::max()) {
-      throw Error( "SharedName::SharedName(): Identifier counter has reached it's limit (%d bits)."
-                 , std::numeric_limits<unsigned int>::digits );
-    }
-
     if (!_headInstance)
         throw Error("Can't create " + _TName("SharedPath") + " : null head instance");
 
@@ -129,7 +206,10 @@ SharedPath::SharedPath(Instance* headInstance, SharedPath* tailSharedPath)
                    , getString(_tailSharedPath->getOwnerCell ()).c_str()
                    );
 
-    _headInstance->_getSharedPathMap()._insert(this);
+    _id     = allocateId(this);
+    _serial = allocateSerial();
+    _headInstance->_addSharedPath(this);
+    getSharedPathTable()[getSharedPathKey(_headInstance, _tailSharedPath)] = this;
 }
 
 SharedPath::~SharedPath()
@@ -143,7 +223,11 @@ SharedPath::~SharedPath()
         if (sharedPath) delete sharedPath;
         end_for;
     }
-    _headInstance->_getSharedPathMap()._remove(this);
+    _headInstance->_removeSharedPath(this);
+    SharedPathTable&          table = getSharedPathTable();
+    SharedPathTable::iterator entry = table.find(getSharedPathKey(_headInstance, _tailSharedPath));
+    if ((entry != table.end()) and (entry->second == this)) table.erase(entry);
+    releaseId(_id);
 }
 
 SharedPath* SharedPath::getHeadSharedPath() const
@@ -166,6 +250,26 @@ Instance* SharedPath::getTailInstance() const
     return (_tailSharedPath) ? _tailSharedPath->getTailInstance() : _headInstance;
 }
 
+SharedPath* SharedPath::getFromId(unsigned int id)
+// ***********************************************
+{
+    return (ID_TABLE and (id < ID_TABLE->size())) ? (*ID_TABLE)[id] : NULL;
+}
+
+size_t SharedPath::getIdTableSize()
+// ********************************
+{
+    return (ID_TABLE) ? ID_TABLE->size() : 0;
+}
+
+SharedPath* SharedPath::_lookup(const Instance* headInstance, const SharedPath* tailSharedPath)
+// ******************************************************************************************
+{
+    SharedPathTable&          table = getSharedPathTable();
+    SharedPathTable::iterator it    = table.find(getSharedPathKey(headInstance, tailSharedPath));
+    return (it != table.end()) ? it->second : NULL;
+}
+
 char SharedPath::getNameSeparator()
 // ********************************
 {
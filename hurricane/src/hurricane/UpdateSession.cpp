@@ -21,6 +21,7 @@
 #include "hurricane/Go.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Instance.h"
+#include "hurricane/HyperNetIndex.h"
 #include "hurricane/Error.h"
 
 namespace Hurricane {
@@ -89,6 +90,8 @@ void UpdateSession::_destroy()
 
     UPDATOR_STACK->pop();
 
+    if (not getOwners().isEmpty()) HyperNetIndex::invalidateAll();
+
     vector<Cell*> changedCells;
     for ( DBo* owner : getOwners() ) {
       Cell* cell = dynamic_cast<Cell*>(owner);
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//
+// Copyright (c) 2026, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/HyperNetIndex.h"                   |
+// +-----------------------------------------------------------------+
+
+
+#ifndef  HURRICANE_HYPERNET_INDEX_H
+#define  HURRICANE_HYPERNET_INDEX_H
+
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include "hurricane/Property.h"
+#include "hurricane/Occurrence.h"
+
+
+namespace Hurricane {
+
+  class Cell;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::HyperNetIndex".
+//
+// Memoized flat connectivity of the hypernets of one top cell, attached
+// to it as a private property. The first query about a net occurrence
+// walks its whole hypernet once and records, in contiguous arrays, its
+// root net occurrence, its net occurrences and its leaf plug
+// occurrences. Any later query on a net occurrence of the same hypernet
+// is a lookup, and returns the recorded arrays: O(size of result).
+//
+// The index is emptied, on its next query, once the connectivity may
+// have changed: an UpdateSession holding modified objects is closed, a
+// Plug is created, destroyed or reconnected, a Net is destroyed or its
+// external state changed. The returned references are therefore only
+// valid until the next connectivity change. Only the non extracting
+// traversal is indexed, the extracting one depends on the geometry.
+// Like the rest of the database, the index is not thread safe.
+
+  class HyperNetIndex : public PrivateProperty {
+    public:
+      typedef PrivateProperty  Inherit;
+    public:
+      class Entry {
+        public:
+          inline                                 Entry                  ();
+          inline const Occurrence&               getRootNetOccurrence   () const;
+          inline const std::vector<Occurrence>&  getNetOccurrences      () const;
+          inline const std::vector<Occurrence>&  getLeafPlugOccurrences () const;
+        private:
+          Occurrence               _rootNetOccurrence;
+          std::vector<Occurrence>  _netOccurrences;
+          std::vector<Occurrence>  _leafPlugOccurrences;
+        friend class HyperNetIndex;
+      };
+    public:
+      static  const Name&          getPropertyName        ();
+      static  HyperNetIndex*       get                    ( const Cell* );
+      static  HyperNetIndex*       create                 ( Cell* );
+      static  inline void          invalidateAll          ();
+      virtual Name                 getName                () const;
+              Cell*                getCell                () const;
+      inline  size_t               getEntriesSize         () const;
+              const Entry&         getEntry               ( const Occurrence& netOccurrence );
+      inline  const Occurrence&    getRootNetOccurrence   ( const Occurrence& netOccurrence );
+      inline  const std::vector<Occurrence>&
+                                   getNetOccurrences      ( const Occurrence& netOccurrence );
+      inline  const std::vector<Occurrence>&
+                                   getLeafPlugOccurrences ( const Occurrence& netOccurrence );
+              void                 clear                  ();
+      virtual string               _getTypeName           () const;
+      virtual string               _getString             () const;
+      virtual Record*              _getRecord             () const;
+    protected:
+                                   HyperNetIndex          ();
+    private:
+                                   HyperNetIndex          ( const HyperNetIndex& );
+              HyperNetIndex&       operator=              ( const HyperNetIndex& );
+              Entry&               _build                 ( const Occurrence& netOccurrence );
+    private:
+      static  unsigned int                   _revision;
+              unsigned int                   _builtRevision;
+              std::deque<Entry>              _entries;
+              std::unordered_map<Occurrence,size_t,Occurrence::HashKey>
+                                             _netToEntry;
+  };
+
+
+  inline HyperNetIndex::Entry::Entry ()
+    : _rootNetOccurrence  ()
+    , _netOccurrences     ()
+    , _leafPlugOccurrences()
+  { }
+
+  inline const Occurrence&              HyperNetIndex::Entry::getRootNetOccurrence   () const { return _rootNetOccurrence; }
+  inline const std::vector<Occurrence>& HyperNetIndex::Entry::getNetOccurrences      () const { return _netOccurrences; }
+  inline const std::vector<Occurrence>& HyperNetIndex::Entry::getLeafPlugOccurrences () const { return _leafPlugOccurrences; }
+
+  inline void    HyperNetIndex::invalidateAll  () { ++_revision; }
+  inline size_t  HyperNetIndex::getEntriesSize () const { return _entries.size(); }
+
+  inline const Occurrence& HyperNetIndex::getRootNetOccurrence ( const Occurrence& netOccurrence )
+  { return getEntry(netOccurrence).getRootNetOccurrence(); }
+
+  inline const std::vector<Occurrence>& HyperNetIndex::getNetOccurrences ( const Occurrence& netOccurrence )
+  { return getEntry(netOccurrence).getNetOccurrences(); }
+
+  inline const std::vector<Occurrence>& HyperNetIndex::getLeafPlugOccurrences ( const Occurrence& netOccurrence )
+  { return getEntry(netOccurrence).getLeafPlugOccurrences(); }
+
+
+} // Hurricane namespace.
+
+
+INSPECTOR_P_SUPPORT(Hurricane::HyperNetIndex);
+
+
+#endif  // HURRICANE_HYPERNET_INDEX_H
@@ -78,20 +78,6 @@ class Instance : public Go {
 
     };
 
-    public: class SharedPathMap : public IntrusiveMap<const SharedPath*, SharedPath> {
-    // *****************************************************************************
-
-        public: typedef IntrusiveMap<const SharedPath*, SharedPath> Inherit;
-    
-        public: SharedPathMap();
-
-        public: virtual const SharedPath* _getKey(SharedPath* sharedPath) const;
-        public: virtual unsigned _getHashValue(const SharedPath* tailSharedPath) const;
-        public: virtual SharedPath* _getNextElement(SharedPath* sharedPath) const;
-        public: virtual void _setNextElement(SharedPath* sharedPath, SharedPath* nextSharedPath) const;
-
-    };
-
 // Attributes
 // **********
 
@@ -101,7 +87,7 @@ class Instance : public Go {
     private: Transformation _transformation;
     private: PlacementStatus _placementStatus;
     private: PlugMap _plugMap;
-    private: SharedPathMap _sharedPathMap;
+    private: SharedPath* _firstSharedPath; // lookup through the global SharedPath table only
     private: Instance* _nextOfCellInstanceMap;
     private: Instance* _nextOfCellSlaveInstanceSet;
 
@@ -179,9 +165,10 @@ class Instance : public Go {
     public: virtual string _getString() const;
     public: virtual Record* _getRecord() const;
     public: PlugMap& _getPlugMap() {return _plugMap;};
-    public: SharedPath* _getSharedPath(const SharedPath* tailSharedPath) const {return _sharedPathMap.getElement(tailSharedPath);}
-    public: SharedPathes _getSharedPathes() const {return _sharedPathMap.getElements();};
-    public: SharedPathMap& _getSharedPathMap() {return _sharedPathMap;};
+    public: SharedPath* _getSharedPath(const SharedPath* tailSharedPath) const {return SharedPath::_lookup(this, tailSharedPath);}
+    public: SharedPath* _getFirstSharedPath() const {return _firstSharedPath;};
+    public: void _addSharedPath(SharedPath* sharedPath);
+    public: void _removeSharedPath(SharedPath* sharedPath);
     public: Instance* _getNextOfCellInstanceMap() const {return _nextOfCellInstanceMap;};
     public: Instance* _getNextOfCellSlaveInstanceSet() const {return _nextOfCellSlaveInstanceSet;};
 
@@ -243,7 +230,6 @@ inline Hurricane::Record* getRecord<const Hurricane::Instance::PlacementStatus::
 INSPECTOR_P_SUPPORT(Hurricane::Instance);
 INSPECTOR_P_SUPPORT(Hurricane::Instance::PlacementStatus);
 INSPECTOR_P_SUPPORT(Hurricane::Instance::PlugMap);
-INSPECTOR_P_SUPPORT(Hurricane::Instance::SharedPathMap);
 
 
 #endif // HURRICANE_INSTANCE
@@ -20,6 +20,8 @@
 #ifndef HURRICANE_OCCURENCE
 #define HURRICANE_OCCURENCE
 
+#include <stdint.h>
+#include <functional>
 #include "hurricane/Path.h"
 #include "hurricane/Name.h"
 #include "hurricane/Properties.h"
@@ -40,6 +42,19 @@ class BasicLayer;
 class Occurrence {
 // *************
 
+// Types
+// *****
+
+    // Functors for hash tables & cheap sorting based on the packed key.
+    public: struct HashKey {
+                inline size_t operator()(const Occurrence& occurrence) const
+                    {return std::hash<uint64_t>()(occurrence.getKey());};
+            };
+    public: struct CompareByKey {
+                inline bool operator()(const Occurrence& lhs, const Occurrence& rhs) const
+                    {return lhs.getKey() < rhs.getKey();};
+            };
+
 // Attributes
 // **********
 
@@ -75,6 +90,7 @@ class Occurrence {
     public: Occurrence getNetOccurrence() const;
     public: Box getBoundingBox() const;
     public: Box getBoundingBox(const BasicLayer*) const;
+    public: uint64_t getKey() const; // (SharedPath id + 1) << 32 | Entity id
 
 // Predicates
 // **********
@@ -112,6 +128,14 @@ class Occurrence {
 INSPECTOR_PV_SUPPORT(Hurricane::Occurrence);
 
 
+namespace std {
+
+    template<>
+    struct hash<Hurricane::Occurrence> : public Hurricane::Occurrence::HashKey { };
+
+} // End of std namespace.
+
+
 #endif // HURRICANE_OCCURENCE
 
 
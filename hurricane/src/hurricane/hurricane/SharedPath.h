@@ -60,12 +60,13 @@ class SharedPath {
 // Attributes
 // **********
 
-    private: static unsigned int _idCounter;
-    private: unsigned int _id;
+    private: unsigned int _id; // dense, recycled on destruction
+    private: unsigned int _serial; // never reused, for the hash-consing key
     private: Instance* _headInstance;
     private: SharedPath* _tailSharedPath;
     private: QuarkMap _quarkMap;
-    private: SharedPath* _nextOfInstanceSharedPathMap;
+    private: SharedPath* _previousOfInstance; // enumeration of the SharedPathes
+    private: SharedPath* _nextOfInstance;     // of the head instance
 
 // Constructors
 // ************
@@ -90,6 +91,8 @@ class SharedPath {
 // *********
 
     public: static char getNameSeparator();
+    public: static SharedPath* getFromId(unsigned int id);
+    public: static size_t getIdTableSize();
 
     public: unsigned int  getId() const { return _id; }
     public: Instance* getHeadInstance() const {return _headInstance;};
@@ -114,12 +117,16 @@ class SharedPath {
     public: string _getString() const;
     public: Record* _getRecord() const;
 
+    public: unsigned int _getSerial() const { return _serial; }
+    public: static SharedPath* _lookup(const Instance* headInstance, const SharedPath* tailSharedPath);
     public: Quark* _getQuark(const Entity* entity) const {return _quarkMap.getElement(entity);};
     public: Quarks _getQuarks() const {return _quarkMap.getElements();};
     public: QuarkMap& _getQuarkMap() {return _quarkMap;};
-    public: SharedPath* _getNextOfInstanceSharedPathMap() const {return _nextOfInstanceSharedPathMap;};
+    public: SharedPath* _getPreviousOfInstance() const {return _previousOfInstance;};
+    public: SharedPath* _getNextOfInstance() const {return _nextOfInstance;};
 
-    public: void _setNextOfInstanceSharedPathMap(SharedPath* sharedPath) {_nextOfInstanceSharedPathMap = sharedPath;};
+    public: void _setPreviousOfInstance(SharedPath* sharedPath) {_previousOfInstance = sharedPath;};
+    public: void _setNextOfInstance(SharedPath* sharedPath) {_nextOfInstance = sharedPath;};
 
 };
 
@@ -27,6 +27,7 @@
 #include  "hurricane/Vertical.h"
 #include  "hurricane/RoutingPad.h"
 #include  "crlcore/RoutingGauge.h"
+#include  "crlcore/Probes.h"
 #include  "katabatic/AutoContact.h"
 #include  "katabatic/AutoSegment.h"
 #include  "katabatic/GCell.h"
@@ -264,6 +265,8 @@ namespace Katabatic {
   using Hurricane::Bug;
   using Hurricane::Horizontal;
   using Hurricane::Vertical;
+  using CRL::Probes;
+  using CRL::ScopedProbe;
   
 
 
@@ -755,6 +758,9 @@ namespace Katabatic {
   {
     if (isValid()) return (isSaturated()) ? 1 : 0;
 
+    static unsigned int probe = Probes::registerProbe( "Katabatic::GCell::updateDensity()", Probes::Timer );
+    ScopedProbe         scope ( probe );
+
     _flags &= ~GCellSaturated;
 
     for ( size_t i=0 ; i<_vsegments.size() ; i++ ) {
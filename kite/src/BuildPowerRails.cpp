@@ -15,7 +15,8 @@
 
 
 #include <map>
-#include <list>
+#include <vector>
+#include <algorithm>
 #include "hurricane/DebugSession.h"
 #include "hurricane/Error.h"
 #include "hurricane/Warning.h"
@@ -470,25 +471,23 @@ namespace {
                  void          doLayout          ( const Layer* );
                  string        _getString        () const;
         private:
-          Rails*         _rails;
-          DbU::Unit      _axis;
-          DbU::Unit      _width;
-          list<Interval> _chunks;
+          Rails*           _rails;
+          DbU::Unit        _axis;
+          DbU::Unit        _width;
+          vector<Interval> _chunks;
       };
 
-    private:
-      class RailCompare {
+    // Rail fragments are only recorded while the layers are queried.
+    // They are sorted & merged into rails once, in sweep().
+      class Fragment {
         public:
-          bool operator() ( const Rail* lhs, const Rail* rhs );
-      };
-
-      class RailMatch : public unary_function<Rail*,bool> {
+          inline      Fragment   ( DbU::Unit axis, DbU::Unit width, DbU::Unit source, DbU::Unit target );
+          inline bool operator<  ( const Fragment& ) const;
         public:
-          inline      RailMatch  ( DbU::Unit axis, DbU::Unit width );
-          inline bool operator() ( const Rail* );
-        private:
           DbU::Unit  _axis;
           DbU::Unit  _width;
+          DbU::Unit  _source;
+          DbU::Unit  _target;
       };
 
     public:
@@ -501,12 +500,14 @@ namespace {
           inline unsigned int  getDirection      () const;
           inline Net*          getNet            () const;
                  void          merge             ( const Box& );
+                 void          sweep             ();
                  void          doLayout          ( const Layer* );
         private:
-          Plane*         _plane;
-          unsigned int   _direction;
-          Net*           _net;
-          vector<Rail*>  _rails;
+          Plane*            _plane;
+          unsigned int      _direction;
+          Net*              _net;
+          vector<Fragment>  _fragments;
+          vector<Rail*>     _rails;
       };
 
     public:
@@ -521,6 +522,7 @@ namespace {
           inline unsigned int  getDirection      () const;
           inline unsigned int  getPowerDirection () const;
                  void          merge             ( const Box&, Net* );
+                 void          getRails          ( vector<Rails*>& );
                  void          doLayout          ();
         private:
           const Layer*         _layer;
@@ -542,6 +544,7 @@ namespace {
       inline Plane* getActivePlane         () const;
       inline Plane* getActiveBlockagePlane () const;
              void   merge                  ( const Box&, Net* );
+             void   sweep                  ();
              void   doLayout               ();
     private:
       KiteEngine*     _kite;
@@ -557,13 +560,7 @@ namespace {
     , _axis  (axis)
     , _width (width)
     , _chunks()
-  {
-    ltrace(300) << "    new Rail "
-                << " @" << DbU::getValueString(axis)
-                << " " << getRoutingPlane()->getLayer()->getName()
-                << " " << getRails()->getNet()
-                << " " << ((getDirection()==KbHorizontal) ? "Horizontal" : "Vertical")<< endl;
-  }
+  { }
 
   inline DbU::Unit                PowerRailsPlanes::Rail::getAxis          () const { return _axis; }
   inline DbU::Unit                PowerRailsPlanes::Rail::getWidth         () const { return _width; }
@@ -573,60 +570,15 @@ namespace {
   inline Net*                     PowerRailsPlanes::Rail::getNet           () const { return _rails->getNet(); }
 
 
+// Chunks must be merged by increasing source: either the new one
+// overlaps (or touches) the last chunk, or it starts after it.
   void  PowerRailsPlanes::Rail::merge ( DbU::Unit source, DbU::Unit target )
   {
-    Interval chunkToMerge ( source, target );
-    ltrace(300) << "    Rail::merge() "
-                << ((getDirection()==KbHorizontal) ? "Horizontal" : "Vertical")
-                << " " << chunkToMerge << endl;
-    ltrace(300) << "    | " << _getString() << endl;
-
-    list<Interval>::iterator imerge = _chunks.end();
-    list<Interval>::iterator ichunk = _chunks.begin();
-
-    while ( ichunk != _chunks.end() ) {
-      if (imerge == _chunks.end()) {
-        if (chunkToMerge.getVMax() < (*ichunk).getVMin()) {
-          ltrace(300) << "    | Insert before " << *ichunk << endl;
-          imerge = _chunks.insert( ichunk, chunkToMerge );
-          break;
-        }
-
-        if (chunkToMerge.intersect(*ichunk)) {
-          ltrace(300) << "    | Merge with " << *ichunk << endl;
-          imerge = ichunk;
-          (*imerge).merge( chunkToMerge );
-        }
-      } else {
-        if (chunkToMerge.getVMax() >= (*ichunk).getVMin()) {
-          (*imerge).merge( *ichunk );
-          ltrace(300) << "    | Absorb (erase) " << *ichunk << endl;
-          ichunk = _chunks.erase( ichunk );
-          continue;
-        } else
-          break;
-      }
-
-      // if (chunkToMerge.intersect(*ichunk)) {
-      //   if (imerge == _chunks.end()) {
-      //     ltrace(300) << "    | Merge with " << *ichunk << endl;
-      //     imerge = ichunk;
-      //     (*imerge).merge( chunkToMerge );
-      //   } else {
-      //     (*imerge).merge( *ichunk );
-      //     ltrace(300) << "    | Absorb (erase) " << *ichunk << endl;
-      //     ichunk = _chunks.erase( ichunk );
-      //     continue;
-      //   }
-      // }
-      ++ichunk;
-    }
-
-    if (imerge == _chunks.end()) {
-      _chunks.insert( ichunk, chunkToMerge );
-      ltrace(300) << "    | Insert at end " << DbU::getValueString(_axis) << " " << chunkToMerge << endl;
-      ltrace(300) << "    | " << _getString() << endl;
+    if (not _chunks.empty() and (source <= _chunks.back().getVMax())) {
+      _chunks.back().merge( target );
+      return;
     }
+    _chunks.push_back( Interval(source,target) );
   }
 
 
@@ -662,14 +614,11 @@ namespace {
     // }
 
     if ( getDirection() == KbHorizontal ) {
-      list<Interval>::iterator ichunk     = _chunks.begin();
-      list<Interval>::iterator ichunknext = ichunk;
-      ++ichunknext;
+      for ( size_t i=0 ; i<_chunks.size() ; ++i ) {
+        const Interval& chunk = _chunks[i];
 
-      for ( ; ichunk != _chunks.end() ; ++ichunk, ++ichunknext ) {
-
-        if (ichunknext != _chunks.end()) {
-          if ((*ichunk).intersect(*ichunknext))
+        if (i+1 < _chunks.size()) {
+          if (chunk.intersect(_chunks[i+1]))
             cerr << Error( "Overlaping consecutive chunks in %s %s Rail @%s:\n"
                            "  %s"
                          , getString(layer->getName()).c_str()
@@ -679,15 +628,15 @@ namespace {
                          ) << endl;
         }
         
-        ltrace(300) << "  chunk: [" << DbU::getValueString((*ichunk).getVMin())
-                    << ":" << DbU::getValueString((*ichunk).getVMax()) << "]" << endl;
+        ltrace(300) << "  chunk: [" << DbU::getValueString(chunk.getVMin())
+                    << ":" << DbU::getValueString(chunk.getVMax()) << "]" << endl;
 
         segment = Horizontal::create ( net
                                      , layer
                                      , _axis
                                      , _width
-                                     , (*ichunk).getVMin()+extension
-                                     , (*ichunk).getVMax()-extension
+                                     , chunk.getVMin()+extension
+                                     , chunk.getVMax()-extension
                                      );
         if ( segment and net->isExternal() )
           NetExternalComponents::setExternal ( segment );
@@ -706,17 +655,16 @@ namespace {
         }
       }
     } else {
-      list<Interval>::iterator ichunk = _chunks.begin();
-      for ( ; ichunk != _chunks.end() ; ichunk++ ) {
-        ltrace(300) << "  chunk: [" << DbU::getValueString((*ichunk).getVMin())
-                    << ":" << DbU::getValueString((*ichunk).getVMax()) << "]" << endl;
+      for ( const Interval& chunk : _chunks ) {
+        ltrace(300) << "  chunk: [" << DbU::getValueString(chunk.getVMin())
+                    << ":" << DbU::getValueString(chunk.getVMax()) << "]" << endl;
 
         segment = Vertical::create ( net
                                    , layer
                                    , _axis
                                    , _width
-                                   , (*ichunk).getVMin()+extension
-                                   , (*ichunk).getVMax()-extension
+                                   , chunk.getVMin()+extension
+                                   , chunk.getVMax()-extension
                                    );
         if ( segment and net->isExternal() )
           NetExternalComponents::setExternal ( segment );
@@ -748,39 +696,38 @@ namespace {
     os << "<Rail " << ((getDirection()==KbHorizontal) ? "Horizontal" : "Vertical")
        << " @"  << DbU::getValueString(_axis)  << " "
        << " w:" << DbU::getValueString(_width) << " ";
-    list<Interval>::const_iterator ichunk = _chunks.begin();
-    for ( ; ichunk != _chunks.end() ; ++ichunk ) {
-      if (ichunk != _chunks.begin()) os << " ";
-      os << "[" << DbU::getValueString((*ichunk).getVMin())
-         << " " << DbU::getValueString((*ichunk).getVMax()) << "]";
+    for ( size_t i=0 ; i<_chunks.size() ; ++i ) {
+      if (i) os << " ";
+      os << "[" << DbU::getValueString(_chunks[i].getVMin())
+         << " " << DbU::getValueString(_chunks[i].getVMax()) << "]";
     }
     os << ">";
     return os.str();
   }
 
 
-  inline bool  PowerRailsPlanes::RailCompare::operator() ( const Rail* lhs, const Rail* rhs )
-  {
-    if ( lhs->getAxis () < rhs->getAxis () ) return true;
-    if ( lhs->getWidth() < rhs->getWidth() ) return true;
-    return false;
-  }
-
-
-  inline  PowerRailsPlanes::RailMatch::RailMatch ( DbU::Unit axis, DbU::Unit width )
-    : _axis(axis)
-    , _width(width)
+  inline  PowerRailsPlanes::Fragment::Fragment ( DbU::Unit axis, DbU::Unit width, DbU::Unit source, DbU::Unit target )
+    : _axis  (axis)
+    , _width (width)
+    , _source(source)
+    , _target(target)
   { }
 
 
-  inline bool  PowerRailsPlanes::RailMatch::operator() ( const Rail* rail )
-  { return (rail->getAxis() == _axis) and (rail->getWidth() == _width); }
+  inline bool  PowerRailsPlanes::Fragment::operator< ( const Fragment& other ) const
+  {
+    if (_axis   != other._axis  ) return _axis   < other._axis;
+    if (_width  != other._width ) return _width  < other._width;
+    if (_source != other._source) return _source < other._source;
+    return _target < other._target;
+  }
 
 
   PowerRailsPlanes::Rails::Rails ( PowerRailsPlanes::Plane* plane , unsigned int direction , Net* net )
     : _plane         (plane)
     , _direction     (direction)
     , _net           (net)
+    , _fragments     ()
     , _rails         ()
   {
     ltrace(300) << "  new Rails @"
@@ -792,10 +739,7 @@ namespace {
 
   PowerRailsPlanes::Rails::~Rails ()
   {
-    while ( not _rails.empty() ) {
-      delete (*_rails.begin());
-      _rails.erase ( _rails.begin() );
-    }
+    for ( Rail* rail : _rails ) delete rail;
   }
 
 
@@ -824,18 +768,30 @@ namespace {
       targetU = bb.getYMax();
     }
 
-    vector<Rail*>::iterator irail = find_if ( _rails.begin(), _rails.end(), RailMatch(axis,width) );
+    _fragments.push_back( Fragment(axis,width,sourceU,targetU) );
+  }
+
+
+// Sort the fragments by (axis, width, source): each rail is then a run of
+// consecutive fragments, and its chunks are built in a single pass.
+// Does not touch the database and so can be run concurrently on
+// different Rails.
+  void  PowerRailsPlanes::Rails::sweep ()
+  {
+    sort( _fragments.begin(), _fragments.end() );
 
     Rail* rail = NULL;
-    if ( irail == _rails.end() ) {
-      rail = new Rail(this,axis,width);
-      _rails.push_back ( rail );
-      stable_sort ( _rails.begin(), _rails.end(), RailCompare() );
-    } else {
-      rail = *irail;
+    for ( const Fragment& fragment : _fragments ) {
+      if (   (rail == NULL)
+          or (rail->getAxis () != fragment._axis)
+          or (rail->getWidth() != fragment._width) ) {
+        rail = new Rail( this, fragment._axis, fragment._width );
+        _rails.push_back( rail );
+      }
+      rail->merge( fragment._source, fragment._target );
     }
 
-    rail->merge ( sourceU, targetU );
+    vector<Fragment>().swap( _fragments );
   }
 
 
@@ -916,6 +872,13 @@ namespace {
   }
 
 
+  void  PowerRailsPlanes::Plane::getRails ( vector<Rails*>& rails )
+  {
+    for ( auto irails : _horizontalRails ) rails.push_back( irails.second );
+    for ( auto irails : _verticalRails   ) rails.push_back( irails.second );
+  }
+
+
   void  PowerRailsPlanes::Plane::doLayout ()
   {
     ltrace(300) << "Doing layout of plane: " << _layer->getName() << endl;
@@ -1030,8 +993,22 @@ namespace {
   }
 
 
+  void  PowerRailsPlanes::sweep ()
+  {
+    vector<Rails*> rails;
+    for ( auto iplane : _planes ) iplane.second->getRails( rails );
+
+  // Planes (and nets) are independent: merge all of them in parallel.
+#pragma omp parallel for schedule(dynamic,1)
+    for ( int i=0 ; i<(int)rails.size() ; ++i )
+      rails[i]->sweep();
+  }
+
+
   void  PowerRailsPlanes::doLayout ()
   {
+    sweep();
+
     PlanesMap::iterator iplane = _planes.begin();
     for ( ; iplane != _planes.end() ; iplane++ )
       iplane->second->doLayout ();
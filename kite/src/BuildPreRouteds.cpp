@@ -209,6 +209,9 @@ namespace Kite {
          
           if (element->getNet() == NULL) continue;
           element->setRouted();
+        // Routed but not fixed segments can still be ripped up, their
+        // DataNegociate (terminals, ripup count, state) is kept.
+          if (element->isFixed()) element->releaseDataNegociate();
         }
       }
     }
@@ -47,6 +47,7 @@ namespace Kite {
     , _ripupLimits         ()
     , _ripupCost           (Cfg::getParamInt("kite.ripupCost"           ,      3)->asInt())
     , _eventsLimit         (Cfg::getParamInt("kite.eventsLimit"         ,4000000)->asInt())
+    , _concurrentCostsThreshold(Cfg::getParamInt("kite.concurrentCostsThreshold",64)->asInt())
     , _flags               (0)
   {
     _ripupLimits[StrapRipupLimit]      = Cfg::getParamInt("kite.strapRipupLimit"      ,16)->asInt();
@@ -54,6 +55,8 @@ namespace Kite {
     _ripupLimits[GlobalRipupLimit]     = Cfg::getParamInt("kite.globalRipupLimit"     , 5)->asInt();
     _ripupLimits[LongGlobalRipupLimit] = Cfg::getParamInt("kite.longGlobalRipupLimit" , 5)->asInt();
 
+    if (Cfg::getParamBool("kite.conflictGraph",false)->asBool()) _flags |= ConflictGraph;
+
     // for ( size_t i=0 ; i<MaxMetalDepth ; ++i ) {
     //   ostringstream paramName;
     //   paramName << "kite.metal" << (i+1) << "MinBreak";
@@ -84,6 +87,8 @@ namespace Kite {
     , _ripupLimits         ()
     , _ripupCost           (other._ripupCost)
     , _eventsLimit         (other._eventsLimit)
+    , _concurrentCostsThreshold(other._concurrentCostsThreshold)
+    , _flags               (other._flags)
   {
     if ( _base == NULL ) _base = other._base->clone();
 
@@ -282,6 +287,7 @@ namespace Kite {
     cout << Dots::asUInt ("     - Ripup limit, locals"                ,_ripupLimits[LocalRipupLimit]) << endl;
     cout << Dots::asUInt ("     - Ripup limit, globals"               ,_ripupLimits[GlobalRipupLimit]) << endl;
     cout << Dots::asUInt ("     - Ripup limit, long globals"          ,_ripupLimits[LongGlobalRipupLimit]) << endl;
+    cout << Dots::asBool ("     - Net conflict graph"                 ,useConflictGraph()) << endl;
 
     _base->print ( cell );
   }
@@ -310,6 +316,7 @@ namespace Kite {
       record->add ( getSlot("_vTracksReservedLocal" ,_vTracksReservedLocal ) );
       record->add ( getSlot("_ripupCost"            ,_ripupCost            ) );
       record->add ( getSlot("_eventsLimit"          ,_eventsLimit          ) );
+      record->add ( getSlot("_concurrentCostsThreshold",_concurrentCostsThreshold) );
 
       record->add ( getSlot("_ripupLimits[StrapRipupLimit]"     ,_ripupLimits[StrapRipupLimit]     ) );
       record->add ( getSlot("_ripupLimits[LocalRipupLimit]"     ,_ripupLimits[LocalRipupLimit]     ) );
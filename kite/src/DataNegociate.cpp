@@ -21,6 +21,7 @@
 #include "katabatic/AutoSegment.h"
 #include "kite/DataNegociate.h"
 #include "kite/RoutingEvent.h"
+#include "kite/NetConflictGraph.h"
 
 
 namespace Kite {
@@ -49,11 +50,11 @@ namespace Kite {
     : _trackSegment     (trackSegment)
     , _childSegment     (NULL)
     , _routingEvent     (NULL)
-    , _net              (trackSegment->getNet())
     , _state            (RipupPerpandiculars)
     , _stateCount       (1)
     , _terminals        (0)
     , _ripupCount       (0)
+    , _netColor         (NetConflictGraph::NoColor)
     , _leftMinExtend    (DbU::Max)
     , _rightMinExtend   (DbU::Min)
     , _attractors       ()
@@ -223,9 +224,9 @@ namespace Kite {
     record->add( getSlot          ( "_childSegment"  ,  _childSegment   ) );
     record->add( getSlot          ( "_terminals"     ,  _terminals      ) );
     record->add( getSlot          ( "_ripupCount"    ,  _ripupCount     ) );
+    record->add( getSlot          ( "_netColor"      ,  _netColor       ) );
     record->add( DbU::getValueSlot( "_leftMinExtend" , &_leftMinExtend  ) );
     record->add( DbU::getValueSlot( "_rightMinExtend", &_rightMinExtend ) );
-    record->add( getSlot          ( "_net"           ,  _net            ) );
                                      
     return record;
   }
@@ -33,6 +33,7 @@
 #include "hurricane/Instance.h"
 #include "hurricane/Vertical.h"
 #include "hurricane/Horizontal.h"
+#include "hurricane/Pin.h"
 #include "hurricane/viewer/Script.h"
 #include "crlcore/Measures.h"
 #include "knik/Vertex.h"
@@ -46,6 +47,7 @@
 #include "kite/Session.h"
 #include "kite/TrackSegment.h"
 #include "kite/NegociateWindow.h"
+#include "kite/RoutingEventTrace.h"
 #include "kite/KiteEngine.h"
 #include "kite/PyKiteEngine.h"
 
@@ -81,6 +83,8 @@ namespace Kite {
   using Hurricane::Layer;
   using Hurricane::Horizontal;
   using Hurricane::Vertical;
+  using Hurricane::Contact;
+  using Hurricane::Pin;
   using Hurricane::NetRoutingExtension;
   using Hurricane::Cell;
   using CRL::System;
@@ -98,6 +102,34 @@ namespace Kite {
     "    Cell %s do not have any KiteEngine (or not yet created).\n";
 
 
+  void  wipeoutNetRouting ( Net* net )
+  {
+  // First pass: destroy the contacts (but not the external pins)
+    std::vector<Contact*> contacts;
+    for ( Component* component : net->getComponents() ) {
+      if (dynamic_cast<Pin*>(component)) continue;
+
+      Contact* contact = dynamic_cast<Contact*>(component);
+      if (contact and not contact->getAnchorHook()->isAttached())
+        contacts.push_back( contact );
+    }
+    for ( Contact* contact : contacts )
+      contact->destroy();
+
+  // Second pass: destroy unconnected segments added by Knik as blockages
+    std::vector<Component*> segments;
+    for ( Component* component : net->getComponents() ) {
+      Horizontal* horizontal = dynamic_cast<Horizontal*>(component);
+      if (horizontal) segments.push_back( horizontal );
+
+      Vertical* vertical = dynamic_cast<Vertical*>(component);
+      if (vertical) segments.push_back( vertical );
+    }
+    for ( Component* segment : segments )
+      segment->destroy();
+  }
+
+
 // -------------------------------------------------------------------
 // Class  :  "Kite::KiteEngine".
 
@@ -120,6 +152,8 @@ namespace Kite {
     , _configuration   (new Configuration(getKatabaticConfiguration()))
     , _routingPlanes   ()
     , _negociateWindow (NULL)
+    , _eventTrace      (NULL)
+    , _ecoNets         ()
     , _minimumWL       (0.0)
     , _toolSuccess     (false)
   { }
@@ -193,6 +227,11 @@ namespace Kite {
     if (getState() < Katabatic::EngineGutted)
       setState( Katabatic::EnginePreDestroying );
 
+    if (_eventTrace and not _eventTrace->isReplaying()) {
+      _eventTrace->destroy();
+      _eventTrace = NULL;
+    }
+
     _gutKite();
     KatabaticEngine::_preDestroy();
 
@@ -224,31 +263,103 @@ namespace Kite {
 
     for ( Net* net : cell->getNets() ) {
       if (NetRoutingExtension::isManualGlobalRoute(net)) continue;
+      wipeoutNetRouting( net );
+    }
+
+    UpdateSession::close();
+  }
 
-    // First pass: destroy the contacts
-      std::vector<Contact*> contacts;
-      for ( Component* component : net->getComponents() ) {
-        Contact* contact = dynamic_cast<Contact*>(component);
-        if (contact and not contact->getAnchorHook()->isAttached())
-          contacts.push_back( contact );
+
+  Box  KiteEngine::ripupEcoNets ( Cell* cell, vector<Net*>& nets )
+  {
+    if ( (KiteEngine::get(cell) != NULL) or (KatabaticEngine::get(cell) != NULL) )
+      throw Error( "KiteEngine::ripupEcoNets(): KiteEngine still active on %s"
+                 , getString(cell->getName()).c_str() );
+
+    cmess1 << "  o  ECO rip-up of <" << cell->getName() << ">." << endl;
+
+    Box     region;
+    NetSet  rippeds;
+
+    UpdateSession::open();
+
+  // Once its wiring is removed, the bounding box of a changed net is the one
+  // of its terminals, which is also the area Knik searches for its new route.
+    for ( Net* net : nets ) {
+      if (net->isSupply()) {
+        cerr << Warning( "KiteEngine::ripupEcoNets(): Supply net <%s> is not re-routed."
+                       , getString(net->getName()).c_str() ) << endl;
+        continue;
       }
-      for ( Contact* contact : contacts )
-        contact->destroy();
+      wipeoutNetRouting( net );
+      region.merge( net->getBoundingBox() );
+      rippeds.insert( net );
+    }
 
-    // Second pass: destroy unconnected segments added by Knik as blockages
-      std::vector<Component*> segments;
-      for ( Component* component : net->getComponents() ) {
-        Horizontal* horizontal = dynamic_cast<Horizontal*>(component);
-        if (horizontal) segments.push_back( horizontal );
+  // Nets already routed through that area are ripped up too, so the new
+  // global routes are not walled in by the previous detailed routing.
+    if (not region.isEmpty()) {
+      vector<Net*> overlappings;
+
+      for ( Net* net : cell->getNets() ) {
+        if (net->isSupply()) continue;
+        if (rippeds.find(net) != rippeds.end()) continue;
+        if (NetRoutingExtension::isManualGlobalRoute(net)) continue;
+
+        for ( Component* component : net->getComponents() ) {
+          if (   not dynamic_cast<Horizontal*>(component)
+             and not dynamic_cast<Vertical*>  (component)
+             and (not dynamic_cast<Contact*>(component) or dynamic_cast<Pin*>(component)) )
+            continue;
+
+          if (component->getBoundingBox().intersect(region)) {
+            overlappings.push_back( net );
+            break;
+          }
+        }
+      }
 
-        Vertical* vertical = dynamic_cast<Vertical*>(component);
-        if (vertical) segments.push_back( vertical );
+      for ( Net* net : overlappings ) {
+        wipeoutNetRouting( net );
+        region.merge( net->getBoundingBox() );
+        rippeds.insert( net );
       }
-      for ( Component* segment : segments )
-        segment->destroy();
     }
 
     UpdateSession::close();
+
+    cmess1 << Dots::asSizet( "     - Changed nets"  , nets.size()    ) << endl;
+    cmess1 << Dots::asSizet( "     - Ripped up nets", rippeds.size() ) << endl;
+    cmess1 << Dots::asString( "     - ECO region"   , getString(region) ) << endl;
+
+    nets.assign( rippeds.begin(), rippeds.end() );
+    return region;
+  }
+
+
+  void  KiteEngine::setEcoNets ( const vector<Net*>& nets )
+  {
+    _ecoNets.clear();
+    _ecoNets.insert( nets.begin(), nets.end() );
+  }
+
+
+  void  KiteEngine::_getEcoGCells ( Katabatic::GCellVector& gcells ) const
+  {
+    Katabatic::GCell::SetIndex ecoGCells;
+    Katabatic::GCellVector     segmentGCells;
+
+    const AutoSegmentLut&          lut  = _getAutoSegmentLut();
+    AutoSegmentLut::const_iterator ilut = lut.begin();
+    for ( ; ilut != lut.end() ; ++ilut ) {
+      if (not isEcoNet(ilut->second->getNet())) continue;
+
+      segmentGCells.clear();
+      ilut->second->getGCells( segmentGCells );
+      ecoGCells.insert( segmentGCells.begin(), segmentGCells.end() );
+    }
+
+    gcells.assign( ecoGCells.begin(), ecoGCells.end() );
   }
 
 
@@ -425,6 +536,25 @@ namespace Kite {
   }
 
 
+  void  KiteEngine::recordEventTrace ( const string& path )
+  {
+  // The replay rebuilds the Katabatic state from the saved global routing.
+    saveGlobalSolution();
+
+    if (_eventTrace and not _eventTrace->isReplaying()) _eventTrace->destroy();
+    _eventTrace = RoutingEventTrace::createRecorder( path );
+  }
+
+
+  void  KiteEngine::saveCongestionMap ( const string& fileName )
+  {
+    if (getState() < Katabatic::EngineGlobalLoaded)
+      throw Error ("KiteEngine::saveCongestionMap(): Global routing not present yet.");
+
+    _knik->saveCongestionMap( fileName );
+  }
+
+
   void  KiteEngine::annotateGlobalGraph ()
   {
     cmess1 << "  o  Back annotate global routing graph." << endl;
@@ -624,12 +754,29 @@ namespace Kite {
     Session::open( this );
 
     _negociateWindow = NegociateWindow::create( this );
-    _negociateWindow->setGCells( *(getGCellGrid()->getGCellVector()) );
+    if (not _ecoNets.empty() and not (flags & KtPreRoutedStage)) {
+    // The routing kept from the previous run has been loaded and fixed by
+    // the pre-routed stage, only the GCells crossed by the ECO nets remains.
+      Katabatic::GCellVector ecoGCells;
+      _getEcoGCells( ecoGCells );
+
+      cmess1 << "  o  ECO negociation on " << ecoGCells.size() << " GCells ("
+             << _ecoNets.size() << " nets)." << endl;
+      _negociateWindow->setGCells( ecoGCells );
+    } else
+      _negociateWindow->setGCells( *(getGCellGrid()->getGCellVector()) );
     _computeCagedConstraints();
     _negociateWindow->run( flags );
     _negociateWindow->destroy();
     _negociateWindow = NULL;
 
+    if (_eventTrace and not _eventTrace->isReplaying() and not (flags & KtPreRoutedStage)) {
+      if (not _eventTrace->save())
+        cerr << Warning( "Unable to save routing events trace <%s>.", _eventTrace->getPath().c_str() ) << endl;
+      _eventTrace->destroy();
+      _eventTrace = NULL;
+    }
+
     Session::close();
     stopMeasures();
   //if ( _editor ) _editor->refresh ();
@@ -733,6 +880,7 @@ namespace Kite {
     }
 
     addMeasure<size_t>            ( getCell(), "Segs"   , routeds+unrouteds.size() );
+    addMeasure<size_t>            ( getCell(), "uSegs"  , unrouteds.size() );
     addMeasure<unsigned long long>( getCell(), "DWL(l)" , totalWireLength                  , 12 );
     addMeasure<unsigned long long>( getCell(), "fWL(l)" , totalWireLength-routedWireLength , 12 );
     addMeasure<double>            ( getCell(), "WLER(%)", (expandRatio-1.0)*100.0 );
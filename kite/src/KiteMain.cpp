@@ -24,6 +24,7 @@ namespace bopts = boost::program_options;
 #include "hurricane/DebugSession.h"
 #include "hurricane/DataBase.h"
 #include "hurricane/Cell.h"
+#include "hurricane/Error.h"
 #include "hurricane/Warning.h"
 using namespace Hurricane;
 
@@ -101,6 +102,15 @@ int main ( int argc, char *argv[] )
                          , "The name of the cell to load, without extension." )
       ( "save-design,s"  , bopts::value<string>()
                          , "Save the routed design under the given name.")
+      ( "record-trace"   , bopts::value<string>()
+                         , "Record the routing events in the given trace file, for kite-replay "
+                           "(implies --save-global).")
+      ( "congestion-map" , bopts::value<string>()
+                         , "Save the global routing congestion map in the given file, "
+                           "as a PNG image if its name ends with \".png\", in binary otherwise.")
+      ( "eco"            , bopts::value< vector<string> >()->multitoken()
+                         , "Incremental re-route of the given nets (and of the nets routed "
+                           "across them), the routing of all the others is kept.")
       ( "destroy-db"     , bopts::bool_switch(&destroyDatabase)->default_value(false)
                          , "Perform a complete deletion of the database (may be buggy).");
 
@@ -145,11 +155,40 @@ int main ( int argc, char *argv[] )
     unsigned int globalFlags = (loadGlobal) ? Kite::KtLoadGlobalRouting
                                             : Kite::KtBuildGlobalRouting;
 
+    bool recordTrace = arguments.count("record-trace");
+    if (recordTrace) saveGlobal = false;
+
+    vector<Net*> ecoNets;
+    if (arguments.count("eco")) {
+      if (not cell)
+        throw Error( "--eco requires the cell to be given with --cell." );
+      if (recordTrace)
+        throw Error( "--record-trace cannot be used with an ECO re-route." );
+
+      for ( const string& name : arguments["eco"].as< vector<string> >() ) {
+        Net* net = cell->getNet( name );
+        if (not net)
+          throw Error( "No net <%s> in cell <%s>.", name.c_str(), getString(cell->getName()).c_str() );
+        ecoNets.push_back( net );
+      }
+      KiteEngine::ripupEcoNets( cell, ecoNets );
+      globalFlags = Kite::KtBuildGlobalRouting;
+      saveGlobal  = false;
+    }
+
     KiteEngine* kite = KiteEngine::create( cell );
     if (showConf) kite->printConfiguration();
 
+    if (not ecoNets.empty()) {
+      kite->setEcoNets  ( ecoNets );
+      kite->runNegociate( Kite::KtPreRoutedStage );
+    }
+
     kite->runGlobalRouter( globalFlags );
     if (saveGlobal) kite->saveGlobalSolution ();
+    if (recordTrace) kite->recordEventTrace( arguments["record-trace"].as<string>() );
+    if (arguments.count("congestion-map"))
+      kite->saveCongestionMap( arguments["congestion-map"].as<string>() );
 
     kite->loadGlobalRouting   ( Katabatic::EngineLoadGrByNet );
     kite->balanceGlobalDensity();
@@ -0,0 +1,147 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./KiteReplay.cpp"                         |
+// +-----------------------------------------------------------------+
+
+
+#include <memory>
+using namespace std;
+
+#include <boost/program_options.hpp>
+namespace bopts = boost::program_options;
+
+#include "vlsisapd/configuration/Configuration.h"
+#include "hurricane/DataBase.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Warning.h"
+using namespace Hurricane;
+
+#include "crlcore/Utilities.h"
+#include "crlcore/Banner.h"
+#include "crlcore/AllianceFramework.h"
+using namespace CRL;
+
+#include "kite/RoutingEventTrace.h"
+#include "kite/KiteEngine.h"
+using namespace Kite;
+
+
+// -------------------------------------------------------------------
+// Function  :  "main()".
+//
+// Headless replay of a detailed routing recorded with
+// "kite.bin --record-trace". The global routing saved at recording
+// time is reloaded, so the negociation restarts from the very same
+// Katabatic state (checked against the trace) and its events are
+// timed then compared to the recorded ones.
+
+int main ( int argc, char *argv[] )
+{
+  int   returnCode = 0;
+
+  try {
+    Banner banner( "Kite Replay"
+                 , "1.0b"
+                 , "Coriolis Router Events Replay"
+                 , "2026"
+                 , "agent"
+                 , ""
+                 );
+
+    bool  verbose1;
+    bool  verbose2;
+    bool  logMode;
+
+    bopts::options_description options ("Command line arguments & options");
+    options.add_options()
+      ( "help,h"         , "Print this help." )
+      ( "verbose,v"      , bopts::bool_switch(&verbose1)->default_value(false)
+                         , "First level of verbosity.")
+      ( "very-verbose,V" , bopts::bool_switch(&verbose2)->default_value(false)
+                         , "Second level of verbosity.")
+      ( "log-mode,L"     , bopts::bool_switch(&logMode)->default_value(false)
+                         , "Disable ANSI escape sequences displaying.")
+      ( "cell,c"         , bopts::value<string>()
+                         , "The name of the cell to load, without extension." )
+      ( "trace,t"        , bopts::value<string>()
+                         , "The routing events trace to replay." );
+
+    bopts::variables_map arguments;
+    bopts::store  ( bopts::parse_command_line(argc,argv,options), arguments );
+    bopts::notify ( arguments );
+
+    if ( arguments.count("help") or not arguments.count("cell") or not arguments.count("trace") ) {
+      cout << banner << endl;
+      cout << options << endl;
+      exit ( 0 );
+    }
+
+    Cfg::Configuration::pushDefaultPriority( Cfg::Parameter::CommandLine );
+    if (arguments["verbose"     ].as<bool>()) Cfg::getParamBool("misc.verboseLevel1")->setBool( true  );
+    if (arguments["very-verbose"].as<bool>()) Cfg::getParamBool("misc.verboseLevel2")->setBool( true  );
+    if (arguments["log-mode"    ].as<bool>()) Cfg::getParamBool("misc.logMode"      )->setBool( true  );
+    Cfg::Configuration::popDefaultPriority();
+
+    cmess1 << banner << endl;
+
+    dbo_ptr<DataBase>          db ( DataBase::create() );
+    dbo_ptr<AllianceFramework> af ( AllianceFramework::create() );
+
+    Cell* cell = af->getCell( arguments["cell"].as<string>().c_str(), Catalog::State::Views );
+    if (not cell) {
+      cerr << "[ERROR] Cell not found: " << arguments["cell"].as<string>() << endl;
+      exit ( 2 );
+    }
+
+    RoutingEventTrace* eventTrace = RoutingEventTrace::load( arguments["trace"].as<string>() );
+    KiteEngine*        kite       = KiteEngine::create( cell );
+    kite->setEventTrace( eventTrace );
+
+    kite->runGlobalRouter     ( Kite::KtLoadGlobalRouting );
+    kite->loadGlobalRouting   ( Katabatic::EngineLoadGrByNet );
+    kite->balanceGlobalDensity();
+    kite->layerAssign         ( Katabatic::EngineNoNetLayerAssign );
+    kite->runNegociate        ();
+    kite->finalizeLayout      ();
+
+    if (eventTrace->getDivergences())
+      cerr << Warning( "Replay of <%s> diverged from the recorded events."
+                     , eventTrace->getPath().c_str() ) << endl;
+
+    returnCode = (eventTrace->getDivergences() or not kite->getToolSuccess()) ? 1 : 0;
+
+    kite->setEventTrace( NULL );
+    kite->destroy();
+    eventTrace->destroy();
+
+    exit( returnCode );
+  }
+  catch ( bopts::error& e ) {
+    cerr << "[ERROR] " << e.what() << endl;
+    exit ( 1 );
+  }
+  catch ( Error& e ) {
+    cerr << e.what() << endl;
+    exit ( 1 );
+  }
+  catch ( exception& e ) {
+    cerr << "[ERROR] " << e.what() << endl;
+    exit ( 1 );
+  }
+  catch ( ... ) {
+    cout << "[ERROR] Abnormal termination: unmanaged exception.\n" << endl;
+    exit ( 2 );
+  }
+
+  return returnCode;
+}
@@ -38,6 +38,7 @@
 #include "kite/RoutingEventQueue.h"
 #include "kite/RoutingEventHistory.h"
 #include "kite/RoutingEventLoop.h"
+#include "kite/RoutingEventTrace.h"
 #include "kite/NegociateWindow.h"
 #include "kite/KiteEngine.h"
 
@@ -76,21 +77,25 @@ namespace {
       cost.setGlobalEnclosed();
     }
 
-    DataNegociate* data = segment->getDataNegociate();
-    if (not data) return;
-
-    cost.mergeRipupCount( data->getRipupCount() );
-    if ( segment->isLocal() ) {
-      cost.mergeDataState( data->getState() );
-      if (data->getState() >=  DataNegociate::LocalVsGlobal) {
-        ltrace(200) << "MaximumSlack/LocalVsGlobal for " << segment << endl;
+  // Must not allocate the DataNegociate: costs are computed concurrently
+  // (see SegmentFsm). A segment without one has never been negociated,
+  // its state and counters are still the initial ones.
+    DataNegociate* data = segment->getDataNegociate( KtDataSelf|KtDataNoCreate );
+
+    if (data) {
+      cost.mergeRipupCount( data->getRipupCount() );
+      if ( segment->isLocal() ) {
+        cost.mergeDataState( data->getState() );
+        if (data->getState() >=  DataNegociate::LocalVsGlobal) {
+          ltrace(200) << "MaximumSlack/LocalVsGlobal for " << segment << endl;
+        }
       }
     }
 
     if (segment->isGlobal()) {
       cost.setOverlapGlobal();
       if (   (cost.getFlags() & TrackCost::LocalAndTopDepth)
-         and (data->getState() >= DataNegociate::MoveUp) ) {
+         and data and (data->getState() >= DataNegociate::MoveUp) ) {
         cost.setInfinite   ();
         cost.setOverlap    ();
         cost.setHardOverlap();
@@ -101,8 +106,8 @@ namespace {
     cost.setOverlap();
     if ( segment->isLocal()
        or (cost.isForGlobal() and (Session::getRoutingGauge()->getLayerDepth(segment->getLayer()) < 3)) ) {
-      ltrace(500) << "Deter|     incTerminals() " << boolalpha << cost.isForGlobal() << " " << (data->getTerminals()*100) << endl;
-      cost.incTerminals( data->getTerminals()*100 );
+      ltrace(500) << "Deter|     incTerminals() " << boolalpha << cost.isForGlobal() << " " << ((data) ? data->getTerminals()*100 : 0) << endl;
+      if (data) cost.incTerminals( data->getTerminals()*100 );
     } else {
       ltrace(500) << "Deter|     isForGlobal() " << boolalpha << cost.isForGlobal() << endl;
     }
@@ -171,6 +176,8 @@ namespace Kite {
     , _eventQueue  ()
     , _eventHistory()
     , _eventLoop   (10,50)
+    , _statistics  ()
+    , _conflictGraph()
   { }
 
 
@@ -205,7 +212,7 @@ namespace Kite {
     AutoSegmentLut::iterator it  = lut.begin ();
     for ( ; it != lut.end() ; it++ ) {
       segment = Session::lookup( it->second );
-      if (segment) segment->getDataNegociate()->update();
+      if (segment and not segment->isFixed()) segment->getDataNegociate()->update();
     }
 
     _statistics.setGCellsCount( _gcells.size() );
@@ -383,7 +390,8 @@ namespace Kite {
 
     cmess1 << "     o  Negociation Stage." << endl;
 
-    unsigned long limit = _kite->getEventsLimit();
+    unsigned long      limit      = _kite->getEventsLimit();
+    RoutingEventTrace* eventTrace = _kite->getEventTrace();
 
     _eventHistory.clear();
     _eventQueue.load( _segments );
@@ -411,7 +419,9 @@ namespace Kite {
         cmess2.flush();
       }
 
+      if (eventTrace) eventTrace->startEvent( event );
       event->process( _eventQueue, _eventHistory, _eventLoop );
+      if (eventTrace) eventTrace->endEvent();
 
       count++;
       if (RoutingEvent::getProcesseds() >= limit) setInterrupt( true );
@@ -455,7 +465,9 @@ namespace Kite {
         cmess2.flush();
       }
 
+      if (eventTrace) eventTrace->startEvent( event );
       event->process( _eventQueue, _eventHistory, _eventLoop );
+      if (eventTrace) eventTrace->endEvent();
 
       count++;
       if (RoutingEvent::getProcesseds() >= limit ) setInterrupt( true );
@@ -489,6 +501,9 @@ namespace Kite {
     TrackElement::setOverlapCostCB( NegociateOverlapCost );
     RoutingEvent::resetProcesseds();
 
+    RoutingEventTrace* eventTrace = _kite->getEventTrace();
+    if (eventTrace) eventTrace->snapshot( _kite );
+
     for ( size_t igcell=0 ; igcell<_gcells.size() ; ++igcell ) {
       _createRouting( _gcells[igcell] );
     }
@@ -501,6 +516,16 @@ namespace Kite {
 
     _kite->setMinimumWL( computeWirelength() );
 
+    if (_kite->getKiteConfiguration()->useConflictGraph()) {
+      _conflictGraph.build( _kite );
+      _conflictGraph.printStatistics();
+
+      for ( TrackElement* segment : _segments ) {
+        DataNegociate* data = segment->getDataNegociate();
+        if (data) data->setNetColor( _conflictGraph.getNetColor(segment->getNet()) );
+      }
+    }
+
 #if defined(CHECK_DATABASE)
     unsigned int overlaps = 0;
     Session::getKiteEngine()->_check( overlaps, "after _createRouting(GCell*)" );
@@ -509,6 +534,7 @@ namespace Kite {
     _flags |= flags;
     _negociate();
     printStatistics();
+    if (eventTrace) eventTrace->printStatistics();
 
     if (flags & KtPreRoutedStage) {
       _kite->setFixedPreRouted();
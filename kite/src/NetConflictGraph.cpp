@@ -0,0 +1,189 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./NetConflictGraph.cpp"                   |
+// +-----------------------------------------------------------------+
+
+
+#include <map>
+#include <algorithm>
+#include "hurricane/Net.h"
+#include "crlcore/Utilities.h"
+#include "katabatic/AutoSegment.h"
+#include "katabatic/GCell.h"
+#include "katabatic/GCellGrid.h"
+#include "kite/NetConflictGraph.h"
+#include "kite/KiteEngine.h"
+
+
+namespace {
+
+  using namespace std;
+
+
+  class CompareByDecreasingSize {
+    public:
+      inline CompareByDecreasingSize ( const vector< vector<size_t> >& keys ) : _keys(keys) { }
+      inline bool  operator() ( size_t lhs, size_t rhs ) const
+      {
+        if (_keys[lhs].size() != _keys[rhs].size()) return _keys[lhs].size() > _keys[rhs].size();
+        return lhs < rhs;
+      }
+    private:
+      const vector< vector<size_t> >& _keys;
+  };
+
+
+}  // Anonymous namespace.
+
+
+namespace Kite {
+
+  using std::endl;
+  using std::map;
+  using std::vector;
+  using std::sort;
+  using std::unique;
+  using std::lower_bound;
+  using Hurricane::Entity;
+  using Katabatic::GCell;
+  using Katabatic::GCellVector;
+  using Katabatic::AutoSegment;
+  using Katabatic::AutoSegmentLut;
+
+
+// -------------------------------------------------------------------
+// Class  :  "NetConflictGraph".
+
+
+  NetConflictGraph::NetConflictGraph ()
+    : _nets          ()
+    , _colors        ()
+    , _colorsCount   (0)
+    , _conflictsCount(0)
+  { }
+
+
+  void  NetConflictGraph::clear ()
+  {
+    _nets  .clear();
+    _colors.clear();
+    _colorsCount    = 0;
+    _conflictsCount = 0;
+  }
+
+
+  void  NetConflictGraph::build ( KiteEngine* kite )
+  {
+    clear();
+
+    map< Net*, vector<AutoSegment*>, Entity::CompareById >  netSegments;
+
+    const AutoSegmentLut&          lut  = kite->_getAutoSegmentLut();
+    AutoSegmentLut::const_iterator ilut = lut.begin();
+    for ( ; ilut != lut.end() ; ++ilut ) {
+      if (not ilut->second->isCanonical()) continue;
+      netSegments[ ilut->second->getNet() ].push_back( ilut->second );
+    }
+
+    vector< vector<AutoSegment*> > segments;
+    for ( auto inet : netSegments ) {
+      _nets   .push_back( inet.first );
+      segments.push_back( inet.second );
+    }
+
+  // A slot is a GCell on a given layer: the key is (GCell index, depth).
+  // Collecting the slots of a net only reads Katabatic.
+    size_t                    depths = kite->getRoutingGauge()->getDepth();
+    size_t                    slots  = kite->getGCellGrid()->getGCellVector()->size() * depths;
+    vector< vector<size_t> >  keys   ( _nets.size() );
+
+#pragma omp parallel for schedule(dynamic,16)
+    for ( int i=0 ; i<(int)_nets.size() ; ++i ) {
+      GCellVector gcells;
+      for ( AutoSegment* segment : segments[i] ) {
+        size_t depth = kite->getRoutingGauge()->getLayerDepth( segment->getLayer() );
+        segment->getGCells( gcells );
+        for ( GCell* gcell : gcells )
+          keys[i].push_back( gcell->getIndex()*depths + depth );
+      }
+      sort( keys[i].begin(), keys[i].end() );
+      keys[i].erase( unique(keys[i].begin(),keys[i].end()), keys[i].end() );
+    }
+
+  // Greedy coloring, nets using the most slots first: a net takes the
+  // smallest color not used by the nets already colored in its slots.
+    vector<size_t> order ( _nets.size() );
+    for ( size_t i=0 ; i<order.size() ; ++i ) order[i] = i;
+    sort( order.begin(), order.end(), CompareByDecreasingSize(keys) );
+
+    vector< vector<unsigned int> > slotNets    ( slots );
+    vector<size_t>                 colorStamps;
+
+    _colors.resize( _nets.size(), 0 );
+    for ( size_t i=0 ; i<order.size() ; ++i ) {
+      size_t inet = order[i];
+
+      for ( size_t key : keys[inet] ) {
+        for ( unsigned int other : slotNets[key] )
+          colorStamps[ _colors[other] ] = i+1;
+      }
+
+      unsigned int color = 0;
+      while ( (color < colorStamps.size()) and (colorStamps[color] == i+1) ) ++color;
+      if (color == colorStamps.size()) colorStamps.push_back( 0 );
+
+      _colors[inet] = color;
+      for ( size_t key : keys[inet] ) slotNets[key].push_back( inet );
+    }
+
+    _colorsCount = colorStamps.size();
+    for ( auto& slotNet : slotNets ) {
+      if (slotNet.size() > 1) ++_conflictsCount;
+    }
+  }
+
+
+  unsigned int  NetConflictGraph::getNetColor ( const Net* net ) const
+  {
+    vector<Net*>::const_iterator inet
+      = lower_bound( _nets.begin(), _nets.end(), const_cast<Net*>(net), Entity::CompareById() );
+    if ( (inet == _nets.end()) or (*inet != net) ) return NoColor;
+    return _colors[ inet - _nets.begin() ];
+  }
+
+
+  vector< vector<Net*> >  NetConflictGraph::getIndependentSets () const
+  {
+    vector< vector<Net*> > sets ( _colorsCount );
+    for ( size_t i=0 ; i<_nets.size() ; ++i )
+      sets[ _colors[i] ].push_back( _nets[i] );
+    return sets;
+  }
+
+
+  void  NetConflictGraph::printStatistics () const
+  {
+    size_t largest = 0;
+    for ( auto& independentSet : getIndependentSets() ) largest = std::max( largest, independentSet.size() );
+
+    cmess1 << "  o  Net conflict graph." << endl;
+    cmess1 << Dots::asSizet ( "     - Nets"                      , _nets.size()    ) << endl;
+    cmess1 << Dots::asSizet ( "     - Shared GCell/layer slots"  , _conflictsCount ) << endl;
+    cmess1 << Dots::asSizet ( "     - Independent sets"          , _colorsCount    ) << endl;
+    cmess1 << Dots::asSizet ( "     - Largest set"               , largest         ) << endl;
+    cmess1 << Dots::asDouble( "     - Average set size"
+                            , (_colorsCount) ? (double)_nets.size()/(double)_colorsCount : 0.0 ) << endl;
+  }
+
+
+}  // Kite namespace.
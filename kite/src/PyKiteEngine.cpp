@@ -47,6 +47,7 @@ namespace  Kite {
   using Isobar::ParseOneArg;
   using Isobar::ParseTwoArg;
   using Isobar::PyCell;
+  using Isobar::PyTypeCell;
   using Isobar::PyCell_Link;
   using Isobar::PyCellViewer;
   using Isobar::PyTypeCellViewer;
@@ -99,6 +100,70 @@ extern "C" {
   }
 
 
+  static bool  getNetsFromNames ( const char* function, Cell* cell, PyObject* pyNetNames, vector<Net*>& nets )
+  {
+    if (not PyIter_Check(pyNetNames) and not PySequence_Check(pyNetNames)) {
+      PyErr_Format( ConstructorError, "%s: Net names argument do not support iterator protocol.", function );
+      return false;
+    }
+
+    PyObject* iterator  = PyObject_GetIter(pyNetNames);
+    PyObject* pyNetName = NULL;
+    if (not iterator) return false;
+
+    while( (pyNetName = PyIter_Next(iterator)) ) {
+      if (not PyString_Check(pyNetName)) {
+        Py_DECREF(pyNetName);
+        Py_DECREF(iterator);
+        PyErr_Format( ConstructorError, "%s: Net names argument must be a container of strings.", function );
+        return false;
+      }
+      Net* net = cell->getNet( Name(PyString_AsString(pyNetName)) );
+      if (not net) {
+        PyErr_Format( ConstructorError, "%s: No net <%s> in cell <%s>."
+                    , function, PyString_AsString(pyNetName), getString(cell->getName()).c_str() );
+        Py_DECREF(pyNetName);
+        Py_DECREF(iterator);
+        return false;
+      }
+      nets.push_back( net );
+      Py_DECREF(pyNetName);
+    }
+    Py_DECREF(iterator);
+
+    return true;
+  }
+
+
+  static PyObject* PyKiteEngine_ripupEcoNets ( PyObject*, PyObject* args )
+  {
+    trace << "PyKiteEngine_ripupEcoNets()" << endl;
+
+    PyObject* pyRippeds = NULL;
+
+    HTRY
+      PyObject* arg0       = NULL;
+      PyObject* pyNetNames = NULL;
+      if (not PyArg_ParseTuple(args,"OO:Kite.ripupEcoNets", &arg0, &pyNetNames) or not IsPyCell(arg0)) {
+        PyErr_SetString( ConstructorError, "Bad parameters given to Kite.ripupEcoNets()." );
+        return NULL;
+      }
+
+      Cell*        cell = PYCELL_O(arg0);
+      vector<Net*> nets;
+      if (not getNetsFromNames("Kite.ripupEcoNets()",cell,pyNetNames,nets)) return NULL;
+
+      KiteEngine::ripupEcoNets( cell, nets );
+
+      pyRippeds = PyList_New( nets.size() );
+      for ( size_t i=0 ; i<nets.size() ; ++i )
+        PyList_SetItem( pyRippeds, i, PyString_FromString(getString(nets[i]->getName()).c_str()) );
+    HCATCH
+
+    return pyRippeds;
+  }
+
+
   static PyObject* PyKiteEngine_get ( PyObject*, PyObject* args )
   {
     trace << "PyKiteEngine_get()" << endl;
@@ -272,6 +337,65 @@ extern "C" {
   }
 
 
+  PyObject* PyKiteEngine_saveCongestionMap ( PyKiteEngine* self, PyObject* args )
+  {
+    trace << "PyKiteEngine_saveCongestionMap()" << endl;
+
+    HTRY
+    METHOD_HEAD("KiteEngine.saveCongestionMap()")
+    char* fileName = NULL;
+    if (PyArg_ParseTuple(args,"s:KiteEngine.saveCongestionMap", &fileName)) {
+      kite->saveCongestionMap( fileName );
+    } else {
+      PyErr_SetString(ConstructorError, "KiteEngine.saveCongestionMap(): Invalid number/bad type of parameter.");
+      return NULL;
+    }
+    HCATCH
+
+    Py_RETURN_NONE;
+  }
+
+
+  PyObject* PyKiteEngine_setEcoNets ( PyKiteEngine* self, PyObject* args )
+  {
+    trace << "PyKiteEngine_setEcoNets()" << endl;
+
+    HTRY
+    METHOD_HEAD("KiteEngine.setEcoNets()")
+    PyObject* pyNetNames = NULL;
+    if (PyArg_ParseTuple(args,"O:KiteEngine.setEcoNets", &pyNetNames)) {
+      vector<Net*> nets;
+      if (not getNetsFromNames("KiteEngine.setEcoNets()",kite->getCell(),pyNetNames,nets)) return NULL;
+      kite->setEcoNets( nets );
+    } else {
+      PyErr_SetString(ConstructorError, "KiteEngine.setEcoNets(): Invalid number/bad type of parameter.");
+      return NULL;
+    }
+    HCATCH
+
+    Py_RETURN_NONE;
+  }
+
+
+  PyObject* PyKiteEngine_recordEventTrace ( PyKiteEngine* self, PyObject* args )
+  {
+    trace << "PyKiteEngine_recordEventTrace()" << endl;
+
+    HTRY
+    METHOD_HEAD("KiteEngine.recordEventTrace()")
+    char* path = NULL;
+    if (PyArg_ParseTuple(args,"s:KiteEngine.recordEventTrace", &path)) {
+      kite->recordEventTrace( path );
+    } else {
+      PyErr_SetString(ConstructorError, "KiteEngine.recordEventTrace(): Invalid number/bad type of parameter.");
+      return NULL;
+    }
+    HCATCH
+
+    Py_RETURN_NONE;
+  }
+
+
   static PyObject* PyKiteEngine_runNegociatePreRouted ( PyKiteEngine* self )
   {
     trace << "PyKiteEngine_runNegociatePreRouted()" << endl;
@@ -322,6 +446,8 @@ extern "C" {
   PyMethodDef PyKiteEngine_Methods[] =
     { { "wipeoutRouting"       , (PyCFunction)PyKiteEngine_wipeoutRouting       , METH_VARARGS|METH_STATIC
                                , "Remove any previous routing." }
+    , { "ripupEcoNets"         , (PyCFunction)PyKiteEngine_ripupEcoNets         , METH_VARARGS|METH_STATIC
+                               , "Rip up the changed nets and the nets routed across them, returns the names of all the ripped up nets." }
     , { "get"                  , (PyCFunction)PyKiteEngine_get                  , METH_VARARGS|METH_STATIC
                                , "Returns the Kite engine attached to the Cell, None if there isnt't." }
     , { "create"               , (PyCFunction)PyKiteEngine_create               , METH_VARARGS|METH_STATIC
@@ -332,6 +458,12 @@ extern "C" {
                                , "Display on the console the configuration of Kite." }
     , { "saveGlobalSolution"   , (PyCFunction)PyKiteEngine_saveGlobalSolution   , METH_NOARGS
                                , "Save the global routing solution on disk." }
+    , { "saveCongestionMap"    , (PyCFunction)PyKiteEngine_saveCongestionMap    , METH_VARARGS
+                               , "Save the global routing congestion map (binary, or PNG if the name ends with .png)." }
+    , { "setEcoNets"           , (PyCFunction)PyKiteEngine_setEcoNets           , METH_VARARGS
+                               , "Restrict the next negociation to the GCells crossed by the given (ripped up) nets." }
+    , { "recordEventTrace"     , (PyCFunction)PyKiteEngine_recordEventTrace     , METH_VARARGS
+                               , "Save the global routing and record the next negociation in a trace, for kite-replay." }
     , { "getToolSuccess"       , (PyCFunction)PyKiteEngine_getToolSuccess       , METH_NOARGS
                                , "Returns True if the detailed routing has been successful." }
     , { "loadGlobalRouting"    , (PyCFunction)PyKiteEngine_loadGlobalRouting    , METH_VARARGS
@@ -24,6 +24,7 @@
 #include "hurricane/Breakpoint.h"
 #include "hurricane/Net.h"
 #include "hurricane/Layer.h"
+#include "crlcore/Probes.h"
 #include "katabatic/AutoContact.h"
 #include "kite/DataNegociate.h"
 #include "kite/TrackSegment.h"
@@ -57,6 +58,8 @@ namespace Kite {
   using Hurricane::Error;
   using Hurricane::ForEachIterator;
   using Hurricane::Net;
+  using CRL::Probes;
+  using CRL::ScopedProbe;
   using Hurricane::Layer;
   using Katabatic::GCell;
   using Katabatic::KbPropagate;
@@ -362,6 +365,9 @@ namespace Kite {
                               , RoutingEventLoop&    loop
                               )
   {
+    static unsigned int probe = Probes::registerProbe( "Kite::RoutingEvent::process()", Probes::Timer );
+    ScopedProbe         scope ( probe );
+
     loop.update( _segment->getId() );
     if (loop.isLooping()) {
         loop.erase( _segment->getId() );
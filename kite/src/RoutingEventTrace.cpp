@@ -0,0 +1,318 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./RoutingEventTrace.cpp"                  |
+// +-----------------------------------------------------------------+
+
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include "hurricane/Error.h"
+#include "hurricane/Cell.h"
+#include "crlcore/Utilities.h"
+#include "katabatic/AutoSegment.h"
+#include "kite/RoutingEvent.h"
+#include "kite/RoutingEventTrace.h"
+#include "kite/KiteEngine.h"
+
+
+namespace {
+
+  using namespace std;
+  using Kite::RoutingEventTrace;
+
+
+  const char      Magic[8] = { 'K', 'I', 'T', 'E', 'T', 'R', 'C', 'E' };
+  const uint32_t  Version  = 1;
+
+
+  template< typename T >
+  inline bool  writeRaw ( FILE* file, const T* data, size_t count )
+  { return fwrite( data, sizeof(T), count, file ) == count; }
+
+
+  template< typename T >
+  inline bool  readRaw ( FILE* file, T* data, size_t count )
+  { return fread( data, sizeof(T), count, file ) == count; }
+
+
+  template< typename T >
+  bool  writeVector ( FILE* file, const vector<T>& records )
+  {
+    uint64_t size = records.size();
+    return writeRaw( file, &size, 1 ) and writeRaw( file, records.data(), records.size() );
+  }
+
+
+  template< typename T >
+  bool  readVector ( FILE* file, vector<T>& records )
+  {
+    uint64_t size = 0;
+    if (not readRaw(file,&size,1)) return false;
+    records.resize( size );
+    return readRaw( file, records.data(), records.size() );
+  }
+
+
+  class CompareSegmentRecord {
+    public:
+      inline bool  operator() ( const RoutingEventTrace::SegmentRecord& lhs, const RoutingEventTrace::SegmentRecord& rhs ) const
+      { return lhs._id < rhs._id; }
+  };
+
+
+}  // Anonymous namespace.
+
+
+namespace Kite {
+
+  using std::endl;
+  using std::string;
+  using std::vector;
+  using std::ostringstream;
+  using std::setprecision;
+  using std::fixed;
+  using Hurricane::Error;
+  using Hurricane::DbU;
+  using Katabatic::AutoSegment;
+  using Katabatic::AutoSegmentLut;
+
+
+// -------------------------------------------------------------------
+// Class  :  "RoutingEventTrace".
+
+
+  bool  RoutingEventTrace::SegmentRecord::operator== ( const SegmentRecord& other ) const
+  {
+    return (_id      == other._id     )
+       and (_axis    == other._axis   )
+       and (_sourceU == other._sourceU)
+       and (_targetU == other._targetU)
+       and (_depth   == other._depth  )
+       and (_flags   == other._flags  );
+  }
+
+
+  RoutingEventTrace::RoutingEventTrace ( const string& path, Mode mode )
+    : _path           (path)
+    , _mode           (mode)
+    , _cellName       ()
+    , _segments       ()
+    , _events         ()
+    , _current        (0)
+    , _divergences    (0)
+    , _firstDivergence(0)
+    , _currentMode    (0)
+    , _eventStart     ()
+    , _totalTime      (0.0)
+  {
+    for ( size_t i=0 ; i<4 ; ++i ) { _modeTimes[i] = 0.0; _modeCounts[i] = 0; }
+  }
+
+
+  RoutingEventTrace::~RoutingEventTrace ()
+  { }
+
+
+  RoutingEventTrace* RoutingEventTrace::createRecorder ( const string& path )
+  { return new RoutingEventTrace ( path, Recording ); }
+
+
+  RoutingEventTrace* RoutingEventTrace::load ( const string& path )
+  {
+    FILE* file = fopen( path.c_str(), "rb" );
+    if (not file)
+      throw Error( "RoutingEventTrace::load(): Unable to open trace file <%s>.", path.c_str() );
+
+    RoutingEventTrace* loaded = new RoutingEventTrace ( path, Replaying );
+    char               magic[8];
+    uint32_t           header[2];
+    bool               success = readRaw( file, magic, sizeof(magic) )
+                             and (memcmp(magic,Magic,sizeof(Magic)) == 0)
+                             and readRaw( file, header, 2 )
+                             and (header[0] == Version);
+    if (success) {
+      vector<char> name ( header[1] );
+      success = readRaw( file, name.data(), name.size() )
+            and readVector( file, loaded->_segments )
+            and readVector( file, loaded->_events );
+      loaded->_cellName.assign( name.begin(), name.end() );
+    }
+    fclose( file );
+
+    if (not success) {
+      loaded->destroy();
+      throw Error( "RoutingEventTrace::load(): <%s> is not a valid Kite event trace.", path.c_str() );
+    }
+    return loaded;
+  }
+
+
+  void  RoutingEventTrace::destroy ()
+  { delete this; }
+
+
+  void  RoutingEventTrace::snapshot ( KiteEngine* kite )
+  {
+    vector<SegmentRecord>     segments;
+    const AutoSegmentLut&     lut = kite->_getAutoSegmentLut();
+    AutoSegmentLut::const_iterator ilut = lut.begin();
+
+    segments.reserve( lut.size() );
+    for ( ; ilut != lut.end() ; ++ilut ) {
+      AutoSegment*  segment = ilut->second;
+      SegmentRecord record;
+
+      record._id      = segment->getId();
+      record._axis    = segment->getAxis();
+      record._sourceU = segment->getSourceU();
+      record._targetU = segment->getTargetU();
+      record._depth   = kite->getRoutingGauge()->getLayerDepth( segment->getLayer() );
+      record._flags   = (segment->isHorizontal() ? 1 : 0)
+                      | (segment->isGlobal    () ? 2 : 0)
+                      | (segment->isFixed     () ? 4 : 0);
+      segments.push_back( record );
+    }
+  // The look-up table is sorted by Segment address, which changes from run to run.
+    sort( segments.begin(), segments.end(), CompareSegmentRecord() );
+
+    string cellName = getString( kite->getCell()->getName() );
+    if (_mode == Recording) {
+      _cellName = cellName;
+      _segments.swap( segments );
+      _events  .clear();
+    } else {
+      if (cellName != _cellName)
+        throw Error( "RoutingEventTrace::snapshot(): Trace <%s> has been recorded on <%s>, not <%s>."
+                   , _path.c_str(), _cellName.c_str(), cellName.c_str() );
+      if (segments.size() != _segments.size())
+        throw Error( "RoutingEventTrace::snapshot(): Katabatic state differs from trace <%s>,\n"
+                     "        %u segments instead of %u."
+                   , _path.c_str(), (unsigned int)segments.size(), (unsigned int)_segments.size() );
+      for ( size_t i=0 ; i<segments.size() ; ++i ) {
+        if (not (segments[i] == _segments[i]))
+          throw Error( "RoutingEventTrace::snapshot(): Katabatic state differs from trace <%s>,\n"
+                       "        first difference on segment id:%lu."
+                     , _path.c_str(), (unsigned long)_segments[i]._id );
+      }
+    }
+
+    _current     = 0;
+    _divergences = 0;
+    _totalTime   = 0.0;
+    for ( size_t i=0 ; i<4 ; ++i ) { _modeTimes[i] = 0.0; _modeCounts[i] = 0; }
+  }
+
+
+  void  RoutingEventTrace::startEvent ( const RoutingEvent* event )
+  {
+    EventRecord record;
+    record._segmentId = event->getSegment()->getId();
+    record._mode      = event->getMode();
+    record._level     = event->getEventLevel();
+    record._priority  = event->getPriority();
+    record._padding   = 0;
+
+    if (_mode == Recording) {
+      _events.push_back( record );
+    } else {
+      bool matches = (_current < _events.size())
+                 and (record._segmentId == _events[_current]._segmentId)
+                 and (record._mode      == _events[_current]._mode     )
+                 and (record._level     == _events[_current]._level    )
+                 and (record._priority  == _events[_current]._priority );
+      if (not matches) {
+        if (not _divergences) _firstDivergence = _current;
+        ++_divergences;
+      }
+      ++_current;
+    }
+
+    _currentMode = record._mode & 0x3;
+    _eventStart  = Clock::now();
+  }
+
+
+  void  RoutingEventTrace::endEvent ()
+  {
+    double elapsed = std::chrono::duration<double>( Clock::now() - _eventStart ).count();
+    _totalTime                += elapsed;
+    _modeTimes [_currentMode] += elapsed;
+    _modeCounts[_currentMode] += 1;
+  }
+
+
+  bool  RoutingEventTrace::save () const
+  {
+    if (_mode != Recording) return false;
+
+  // Written aside then renamed, as the Etesian checkpoints.
+    string  tmpPath = _path + ".tmp";
+    FILE*   file    = fopen( tmpPath.c_str(), "wb" );
+    if (not file) return false;
+
+    uint32_t header[2] = { Version, (uint32_t)_cellName.size() };
+    bool     success   = writeRaw( file, Magic, sizeof(Magic) )
+                     and writeRaw( file, header, 2 )
+                     and writeRaw( file, _cellName.data(), _cellName.size() )
+                     and writeVector( file, _segments )
+                     and writeVector( file, _events );
+
+    success = (fclose(file) == 0) and success;
+    if (success) success = (rename(tmpPath.c_str(),_path.c_str()) == 0);
+    if (not success) remove( tmpPath.c_str() );
+    return success;
+  }
+
+
+  void  RoutingEventTrace::printStatistics () const
+  {
+    static const char* modeNames[4] = { "     - Unknown events"
+                                      , "     - Negociate events"
+                                      , "     - Pack events"
+                                      , "     - Repair events"
+                                      };
+
+    size_t count = getEventsCount();
+
+    cmess1 << "  o  Routing events trace (" << ((_mode == Replaying) ? "replay" : "record")
+           << "): <" << _path << ">" << endl;
+    cmess1 << Dots::asSizet ( "     - Katabatic segments", _segments.size() ) << endl;
+    cmess1 << Dots::asSizet ( "     - Events", count ) << endl;
+    cmess1 << Dots::asDouble( "     - Events processing time (s)", _totalTime ) << endl;
+    cmess1 << Dots::asDouble( "     - Events/s", (_totalTime > 0.0) ? (double)count/_totalTime : 0.0 ) << endl;
+
+    for ( size_t i=0 ; i<4 ; ++i ) {
+      if (not _modeCounts[i]) continue;
+
+      ostringstream os;
+      os << _modeCounts[i] << " in " << fixed << setprecision(3) << _modeTimes[i] << "s ("
+         << setprecision(2) << (_modeTimes[i]*1e6/_modeCounts[i]) << "us/event)";
+      cmess1 << Dots::asString( modeNames[i], os.str() ) << endl;
+    }
+
+    if (_mode == Replaying) {
+      cmess1 << Dots::asSizet( "     - Recorded events", _events.size() ) << endl;
+      if (_divergences) {
+        ostringstream os;
+        os << _divergences << " (first at event " << _firstDivergence << ")";
+        cmess1 << Dots::asString( "     - Divergences", os.str() ) << endl;
+      } else
+        cmess1 << Dots::asSizet( "     - Divergences", 0 ) << endl;
+    }
+  }
+
+
+}  // Kite namespace.
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include "hurricane/Bug.h"
 #include "hurricane/DebugSession.h"
+#include "crlcore/Probes.h"
 #include "kite/TrackElement.h"
 #include "kite/Tracks.h"
 #include "kite/RoutingPlane.h"
@@ -36,6 +37,32 @@ namespace {
   using namespace Kite;
 
 
+// Read-only prediction of Manipulator::insertInTrack(): it fails as soon
+// as the segment overlaps, in the Track, a blockage, a fixed segment or
+// a segment already at MaximumSlack, whatever the other overlaps are.
+  bool  isInsertBlocked ( TrackElement* segment, const TrackCost& cost )
+  {
+    if (cost.getBegin() == Track::npos) return false;
+
+    Track*   track    = cost.getTrack();
+    Net*     ownerNet = segment->getNet();
+    Interval toFree   ( segment->getCanonicalInterval() );
+
+    for ( size_t i=cost.getBegin() ; i<cost.getEnd() ; ++i ) {
+      TrackElement* other = track->getSegment( i );
+
+      if (other->getNet() == ownerNet) continue;
+      if (not toFree.intersect(other->getCanonicalInterval())) continue;
+      if (other->isBlockage() or other->isFixed()) return true;
+
+    // Called concurrently: must not allocate a missing DataNegociate.
+      DataNegociate* data = other->getDataNegociate( KtDataSelf|KtDataNoCreate );
+      if (data and (data->getState() == DataNegociate::MaximumSlack)) return true;
+    }
+    return false;
+  }
+
+
 // -------------------------------------------------------------------
 // Class  :  "Cs1Candidate".
 
@@ -344,6 +371,8 @@ namespace Kite {
   using Hurricane::Bug;
   using Hurricane::ForEachIterator;
   using Katabatic::KbHalfSlacken;
+  using CRL::Probes;
+  using CRL::ScopedProbe;
 
 
 // -------------------------------------------------------------------
@@ -454,12 +483,17 @@ namespace Kite {
     , _actions    ()
     , _fullBlocked(true)
   {
+    static unsigned int probe       = Probes::registerProbe( "Kite::SegmentFsm::SegmentFsm()", Probes::Timer );
+    static unsigned int missingData = Probes::registerProbe( "Kite::SegmentFsm::MissingData" , Probes::Counter );
+    ScopedProbe         scope ( probe );
+
     TrackElement* segment = _event->getSegment();
     unsigned int  depth   = Session::getRoutingGauge()->getLayerDepth(segment->getLayer());
     _event->setTracksFree( 0 );
 
     _data = segment->getDataNegociate();
     if (not _data) {
+      Probes::count( missingData );
       _state = MissingData;
       return;
     }
@@ -503,35 +537,56 @@ namespace Kite {
     bool isOneLocalTrack = (segment->isLocal())
       and (segment->base()->getAutoSource()->getGCell()->getGlobalsCount(depth) >= 9.0);
 
-    RoutingPlane* plane = Session::getKiteEngine()->getRoutingPlaneByLayer(segment->getLayer());
+    RoutingPlane*  plane     = Session::getKiteEngine()->getRoutingPlaneByLayer(segment->getLayer());
+    unsigned int   costflags = (segment->isLocal() and (depth >= 3)) ? TrackCost::LocalAndTopDepth : 0;
+    vector<Track*> tracks;
+
     for ( Track* track : Tracks_Range::get(plane,_constraint) ) {
-      unsigned int costflags = 0;
-      costflags |= (segment->isLocal() and (depth >= 3)) ? TrackCost::LocalAndTopDepth : 0;
-
-      if (not segment->isReduced())
-        _costs.push_back( track->getOverlapCost(segment,costflags) );
-      else
-        _costs.push_back( TrackCost(track,segment->getNet()) );
-      _costs.back().setAxisWeight  ( _event->getAxisWeight(track->getAxis()) );
-      _costs.back().incDeltaPerpand( _data->getWiringDelta(track->getAxis()) );
+      tracks.push_back( track );
+      _costs.push_back( TrackCost(track,segment->getNet()) );
+    }
+
+  // Computing the overlap cost, and speculating on whether the insertion
+  // strategy can succeed, only reads the Tracks and the DataNegociate of
+  // the segments they hold: both are evaluated in the same pass, possibly
+  // concurrently, then the costs are adjusted sequentially in Track order.
+    if (not segment->isReduced()) {
+    // Below "kite.concurrentCostsThreshold" candidate Tracks, the cost of
+    // forking a thread team for each event is not worth paying.
+      size_t threshold  = Session::getKiteEngine()->getKiteConfiguration()->getConcurrentCostsThreshold();
+      bool   concurrent = (tracks.size() >= threshold) and not inltrace(148);
+
+#pragma omp parallel for schedule(static) if(concurrent)
+      for ( int i=0 ; i<(int)tracks.size() ; ++i ) {
+        _costs[i] = tracks[i]->getOverlapCost( segment, costflags );
+        if (isInsertBlocked(segment,_costs[i])) _costs[i].setInsertBlocked();
+      }
+    }
+
+    for ( size_t i=0 ; i<_costs.size() ; ++i ) {
+      TrackCost& cost  = _costs[i];
+      Track*     track = tracks[i];
+
+      cost.setAxisWeight  ( _event->getAxisWeight(track->getAxis()) );
+      cost.incDeltaPerpand( _data->getWiringDelta(track->getAxis()) );
       if (segment->isGlobal()) {
         ltrace(500) << "Deter| setForGlobal() on " << track << endl;
-        _costs.back().setForGlobal();
+        cost.setForGlobal();
       }
 
-      if ( inLocalDepth and (_costs.back().getDataState() == DataNegociate::MaximumSlack) )
-        _costs.back().setInfinite();
+      if ( inLocalDepth and (cost.getDataState() == DataNegociate::MaximumSlack) )
+        cost.setInfinite();
 
       if ( isOneLocalTrack
-         and  _costs.back().isOverlapGlobal()
-         and (_costs.back().getDataState() >= DataNegociate::ConflictSolveByHistory) )
-        _costs.back().setInfinite();
+         and  cost.isOverlapGlobal()
+         and (cost.getDataState() >= DataNegociate::ConflictSolveByHistory) )
+        cost.setInfinite();
 
-      _costs.back().consolidate();
-      if ( _fullBlocked and (not _costs.back().isBlockage() and not _costs.back().isFixed()) ) 
+      cost.consolidate();
+      if ( _fullBlocked and (not cost.isBlockage() and not cost.isFixed()) ) 
         _fullBlocked = false;
 
-      ltrace(149) << "| " << _costs.back() << ((_fullBlocked)?" FB ": " -- ") << track << endl;
+      ltrace(149) << "| " << cost << ((_fullBlocked)?" FB ": " -- ") << track << endl;
     }
     ltraceout(148);
 
@@ -618,10 +673,18 @@ namespace Kite {
     ltrace(200) << "SegmentFsm::insertInTrack() istate:" << _event->getInsertState()
                 << " track:" << i << endl;
 
+    static unsigned int skipped = Probes::registerProbe( "Kite::SegmentFsm::InsertBlocked", Probes::Counter );
+
+  // The strategies are tried from the least to the most disruptive. The one
+  // known to fail from the cost evaluation is skipped, with the same effect
+  // (its actions are cleared).
     _event->incInsertState();
     switch ( _event->getInsertState() ) {
       case 1:
-        if ( Manipulator(_event->getSegment(),*this).insertInTrack(i) ) return true;
+        if (_costs[i].isInsertBlocked()) {
+          Probes::count( skipped );
+          clearActions();
+        } else if ( Manipulator(_event->getSegment(),*this).insertInTrack(i) ) return true;
         _event->incInsertState();
       case 2:
         if ( Manipulator(_event->getSegment(),*this).shrinkToTrack(i) ) return true;
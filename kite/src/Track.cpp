@@ -22,6 +22,7 @@
 #include "hurricane/Bug.h"
 #include "hurricane/Layer.h"
 #include "hurricane/Net.h"
+#include "crlcore/Probes.h"
 #include "kite/RoutingPlane.h"
 #include "kite/Track.h"
 #include "kite/TrackMarker.h"
@@ -61,6 +62,8 @@ namespace Kite {
   using Hurricane::Bug;
   using Hurricane::Layer;
   using Hurricane::Net;
+  using CRL::Probes;
+  using CRL::ScopedProbe;
 
 
 // -------------------------------------------------------------------
@@ -284,6 +287,9 @@ namespace Kite {
                                    , size_t       end
                                    , unsigned int flags ) const
   {
+    static unsigned int probe = Probes::registerProbe( "Kite::Track::getOverlapCost()", Probes::Timer );
+    ScopedProbe         scope ( probe );
+
     TrackCost  cost ( const_cast<Track*>(this), interval, begin, end, net, flags );
 
     ltrace(190) << "getOverlapCost() @" << DbU::getValueString(_axis)
@@ -47,6 +47,7 @@ namespace Kite {
     , _rightOverlap   (false)
     , _overlapGlobal  (false)
     , _globalEnclosed (false)
+    , _insertBlocked  (false)
     , _terminals      (0)
     , _delta          (0)
     , _deltaShared    (0)
@@ -81,6 +82,7 @@ namespace Kite {
     , _rightOverlap   (false)
     , _overlapGlobal  (false)
     , _globalEnclosed (false)
+    , _insertBlocked  (false)
     , _terminals      (0)
     , _delta          (-interval.getSize())
     , _deltaShared    (0)
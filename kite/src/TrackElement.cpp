@@ -128,6 +128,7 @@ namespace Kite {
 
 
   SegmentOverlapCostCB* TrackElement::_overlapCostCallback = dummyOverlapCost;
+  const uint32_t        TrackElement::NoIndex;
 
 
   SegmentOverlapCostCB* TrackElement::setOverlapCostCB ( SegmentOverlapCostCB* cb )
@@ -179,6 +180,7 @@ namespace Kite {
   void           TrackElement::setTrack             ( Track* track ) { _track = track; }
   void           TrackElement::updateFreedomDegree  () { }
   void           TrackElement::setDoglegLevel       ( unsigned int ) { }
+  void           TrackElement::releaseDataNegociate () { }
   void           TrackElement::swapTrack            ( TrackElement* ) { }
   void           TrackElement::reschedule           ( unsigned int ) { }
   void           TrackElement::detach               () { }
@@ -201,8 +203,8 @@ namespace Kite {
 
   TrackElement::TrackElement ( Track* track )
     : _flags   (0)
+    , _index   (NoIndex)
     , _track   (track)
-    , _index   ((size_t)-1)
     , _sourceU (0)
     , _targetU (0)
     , _observer(this)
@@ -230,14 +232,14 @@ namespace Kite {
 
   TrackElement* TrackElement::getNext () const
   {
-    size_t dummy = _index;
+    size_t dummy = getIndex();
     return _track->getNext( dummy, getNet() );
   }
 
 
   TrackElement* TrackElement::getPrevious () const
   {
-    size_t dummy = _index;
+    size_t dummy = getIndex();
     return _track->getPrevious( dummy, getNet() );
   }
 
@@ -246,8 +248,8 @@ namespace Kite {
   {
     if (not _track) return Interval(false);
 
-    size_t  begin = _index;
-    size_t  end   = _index;
+    size_t  begin = getIndex();
+    size_t  end   = getIndex();
     return _track->expandFreeInterval( begin, end, Track::InsideElement, getNet() );
   }
 
@@ -213,14 +213,14 @@ namespace Kite {
 
   TrackElement* TrackFixedSegment::getNext () const
   {
-    size_t dummy = _index;
+    size_t dummy = getIndex();
     return _track->getNext( dummy, getNet() );
   }
 
 
   TrackElement* TrackFixedSegment::getPrevious () const
   {
-    size_t dummy = _index;
+    size_t dummy = getIndex();
     return _track->getPrevious( dummy, getNet() );
   }
 
@@ -72,7 +72,6 @@ namespace Kite {
 
     setFlags( TElemCreated|TElemLocked );
     if (segment) {
-      _data = new DataNegociate( this );
       _base->getCanonical( _sourceU, _targetU );
       updateFreedomDegree();
       updatePPitch();
@@ -164,7 +163,13 @@ namespace Kite {
 
   DataNegociate* TrackSegment::getDataNegociate ( unsigned int flags ) const
   {
-    if (flags & KtDataSelf) return _data;
+  // Allocated on first use. Only the fixed pre-routed segments, which
+  // never enter the negociation, end up without one.
+    if (flags & KtDataSelf) {
+      if (not _data and _base and not (flags & KtDataNoCreate))
+        _data = new DataNegociate( const_cast<TrackSegment*>(this) );
+      return _data;
+    }
 
     TrackElement* parent = getParent();
     return (parent) ? parent->getDataNegociate() : NULL;
@@ -173,14 +178,14 @@ namespace Kite {
 
   TrackElement* TrackSegment::getNext () const
   {
-    size_t dummy = _index;
+    size_t dummy = getIndex();
     return _track->getNext( dummy, getNet() );
   }
 
 
   TrackElement* TrackSegment::getPrevious () const
   {
-    size_t dummy = _index;
+    size_t dummy = getIndex();
     return _track->getPrevious( dummy, getNet() );
   }
 
@@ -199,8 +204,8 @@ namespace Kite {
   {
     if (not _track) return Interval(false);
 
-    size_t  begin = _index;
-    size_t  end   = _index;
+    size_t  begin = getIndex();
+    size_t  end   = getIndex();
 
     return _track->expandFreeInterval( begin, end, Track::InsideElement, getNet() );
   }
@@ -287,6 +292,15 @@ namespace Kite {
   }
 
 
+  void  TrackSegment::releaseDataNegociate ()
+  {
+    if (not _data or _data->hasRoutingEvent()) return;
+
+    delete _data;
+    _data = NULL;
+  }
+
+
   void  TrackSegment::updateFreedomDegree ()
   { _freedomDegree = _base->getSlack(); }
 
@@ -355,7 +369,7 @@ namespace Kite {
 
     setTrack( otherTrack );
     setIndex( otherIndex );
-    if (_track) _track->setSegment( this, _index );
+    if (_track) _track->setSegment( this, getIndex() );
 
 #if defined(CHECK_DATABASE_DISABLED)
     if      (_track)            _track->_check();
@@ -772,6 +786,7 @@ namespace Kite {
         segments.push_back( Session::getNegociateWindow()->createTrackSegment(doglegs[i+1],0) );
         segments[i+1]->setFlags( TElemSourceDogleg|TElemTargetDogleg  );
         segments[i+1]->setDoglegLevel( doglegLevel + 1 );
+        segments[i+1]->getDataNegociate()->setNetColor( segments[i+0]->getDataNegociate()->getNetColor() );
 
         ltrace(200) << "Looking up new parallel: " << doglegs[i+2] << endl;
         segments.push_back( Session::getNegociateWindow()->createTrackSegment(doglegs[i+2],0) );
@@ -779,6 +794,7 @@ namespace Kite {
         segments[i+2]->getDataNegociate()->resetStateCount();
         segments[i+2]->getDataNegociate()->setState( segments[i+0]->getDataNegociate()->getState() );
         segments[i+2]->setDoglegLevel( doglegLevel + (segments[i]->isLocal()?1:0) );
+        segments[i+2]->getDataNegociate()->setNetColor( segments[i+0]->getDataNegociate()->getNetColor() );
 
         segments[i+0]->getDataNegociate()->setChildSegment( segments[i+2] );
 
@@ -49,7 +49,7 @@ namespace Kite {
                        , RipupLimitsTableSize=4
                        };
       enum Constants   { MaxMetalDepth=20 };
-      enum Flag        { UseClockTree=0x0001 };
+      enum Flag        { UseClockTree=0x0001, ConflictGraph=0x0002 };
     public:
     // Constructor & Destructor.
       virtual Configuration*             clone                   () const;
@@ -60,6 +60,7 @@ namespace Kite {
       virtual bool                       isGMetal                ( const Layer* ) const;
       virtual bool                       isGContact              ( const Layer* ) const;
       inline  bool                       useClockTree            () const;
+      inline  bool                       useConflictGraph        () const;
       virtual size_t                     getDepth                () const;
       virtual size_t                     getAllowedDepth         () const;
       virtual DbU::Unit                  getSliceHeight          () const;
@@ -95,11 +96,13 @@ namespace Kite {
       inline  PostEventCb_t&             getPostEventCb          ();
       inline  unsigned long              getEventsLimit          () const;
       inline  unsigned int               getRipupCost            () const;
+      inline  size_t                     getConcurrentCostsThreshold () const;
               unsigned int               getRipupLimit           ( unsigned int type ) const;
       inline  size_t                     getHTracksReservedLocal () const;
       inline  size_t                     getVTracksReservedLocal () const;
       inline  void                       setEventsLimit          ( unsigned long );
       inline  void                       setRipupCost            ( unsigned int );
+      inline  void                       setConcurrentCostsThreshold ( size_t );
               void                       setRipupLimit           ( unsigned int limit, unsigned int type );
       inline  void                       setPostEventCb          ( PostEventCb_t );
               void                       setHTracksReservedLocal ( size_t );
@@ -118,6 +121,7 @@ namespace Kite {
              unsigned int                _ripupLimits         [RipupLimitsTableSize];
              unsigned int                _ripupCost;
              unsigned long               _eventsLimit;
+             size_t                      _concurrentCostsThreshold;
              unsigned int                _flags;
     private:
                      Configuration ( const Configuration& other, Katabatic::Configuration* base=NULL );
@@ -133,9 +137,12 @@ namespace Kite {
   inline size_t                        Configuration::getHTracksReservedLocal () const { return _hTracksReservedLocal; }
   inline size_t                        Configuration::getVTracksReservedLocal () const { return _vTracksReservedLocal; }
   inline void                          Configuration::setRipupCost            ( unsigned int cost ) { _ripupCost = cost; }
+  inline size_t                        Configuration::getConcurrentCostsThreshold () const { return _concurrentCostsThreshold; }
+  inline void                          Configuration::setConcurrentCostsThreshold ( size_t threshold ) { _concurrentCostsThreshold = threshold; }
   inline void                          Configuration::setPostEventCb          ( PostEventCb_t cb ) { _postEventCb = cb; }
   inline void                          Configuration::setEventsLimit          ( unsigned long limit ) { _eventsLimit = limit; }
   inline bool                          Configuration::useClockTree            () const { return _flags & UseClockTree; }
+  inline bool                          Configuration::useConflictGraph        () const { return _flags & ConflictGraph; }
   inline void                          Configuration::setFlags                ( unsigned int flags ) { _flags |=  flags; }
   inline void                          Configuration::unsetFlags              ( unsigned int flags ) { _flags &= ~flags; }
 
@@ -48,6 +48,7 @@ namespace Kite {
                      , KtLoadingStage       = 0x00000800
                      , KtSlowMotion         = 0x00001000
                      , KtPreRoutedStage     = 0x00002000
+                     , KtDataNoCreate       = 0x00004000
                      , };
 
 } // Kite namespace.
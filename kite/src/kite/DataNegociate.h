@@ -77,6 +77,7 @@ namespace Kite {
       inline unsigned int                 getStateCount         () const;
       inline unsigned int                 getRipupCount         () const;
       inline unsigned int                 getStateAndRipupCount () const;
+      inline unsigned int                 getNetColor           () const;
              DbU::Unit                    getWiringDelta        ( DbU::Unit axis ) const;
       inline const vector<TrackElement*>& getPerpandiculars     () const;
       inline const Interval&              getPerpandicularFree  () const;
@@ -84,6 +85,7 @@ namespace Kite {
       inline void                         setRoutingEvent       ( RoutingEvent* );
       inline void                         setChildSegment       ( TrackElement* );
       inline void                         setRipupCount         ( unsigned int );
+      inline void                         setNetColor           ( unsigned int );
       inline void                         incRipupCount         ();
       inline void                         decRipupCount         ();
       inline void                         resetRipupCount       ();
@@ -98,11 +100,11 @@ namespace Kite {
       TrackElement*         _trackSegment;
       TrackElement*         _childSegment;
       RoutingEvent*         _routingEvent;
-      Net*                  _net;
       unsigned int          _state      :  5;
       unsigned int          _stateCount :  5;
       unsigned int          _terminals  :  5;
       unsigned int          _ripupCount : 16;
+      unsigned int          _netColor;
       DbU::Unit             _leftMinExtend;
       DbU::Unit             _rightMinExtend;
       vector<DbU::Unit>     _attractors;
@@ -125,10 +127,12 @@ namespace Kite {
   inline unsigned int                 DataNegociate::getRipupCount        () const { return _ripupCount; }
   inline DbU::Unit                    DataNegociate::getLeftMinExtend     () const { return _leftMinExtend; }
   inline DbU::Unit                    DataNegociate::getRightMinExtend    () const { return _rightMinExtend; }
-  inline Net*                         DataNegociate::getNet               () const { return _net; }
+  inline Net*                         DataNegociate::getNet               () const { return _trackSegment->getNet(); }
   inline const vector<TrackElement*>& DataNegociate::getPerpandiculars    () const { return _perpandiculars; }
   inline const Interval&              DataNegociate::getPerpandicularFree () const { return _perpandicularFree; }
   inline unsigned int                 DataNegociate::getStateCount        () const { return _stateCount; }
+  inline unsigned int                 DataNegociate::getNetColor          () const { return _netColor; }
+  inline void                         DataNegociate::setNetColor          ( unsigned int color ) { _netColor = color; }
   inline void                         DataNegociate::resetStateCount      () { _stateCount=0; }
   inline void                         DataNegociate::setRoutingEvent      ( RoutingEvent* event ) { _routingEvent = event; }
   inline void                         DataNegociate::setChildSegment      ( TrackElement* child ) { _childSegment = child; }
@@ -42,6 +42,7 @@ namespace Knik {
 namespace Kite {
 
   using Hurricane::Name;
+  using Hurricane::Box;
   using Hurricane::Layer;
   using Hurricane::Net;
   using Hurricane::Cell;
@@ -52,6 +53,7 @@ namespace Kite {
   class Track;
   class RoutingPlane;
   class NegociateWindow;
+  class RoutingEventTrace;
 
 
 // -------------------------------------------------------------------
@@ -64,6 +66,7 @@ namespace Kite {
       static  KiteEngine*             create                     ( Cell* );
       static  KiteEngine*             get                        ( const Cell* );
       static  void                    wipeoutRouting             ( Cell* );
+      static  Box                     ripupEcoNets               ( Cell*, vector<Net*>& );
     public:                                                      
       inline  bool                    useClockTree               () const;
       inline  CellViewer*             getViewer                  () const;
@@ -82,6 +85,9 @@ namespace Kite {
       inline  Configuration::PostEventCb_t&
                                       getPostEventCb             ();
       inline  NegociateWindow*        getNegociateWindow         ();
+      inline  RoutingEventTrace*      getEventTrace              () const;
+      inline  const NetSet&           getEcoNets                 () const;
+      inline  bool                    isEcoNet                   ( Net* ) const;
       inline  size_t                  getRoutingPlanesSize       () const;
               RoutingPlane*           getRoutingPlaneByIndex     ( size_t index ) const;
               RoutingPlane*           getRoutingPlaneByLayer     ( const Layer* ) const;
@@ -93,6 +99,8 @@ namespace Kite {
       inline  void                    setViewer                  ( CellViewer* );
       inline  void                    setPostEventCb             ( Configuration::PostEventCb_t );
       inline  void                    setEventLimit              ( unsigned long );
+      inline  void                    setEventTrace              ( RoutingEventTrace* );
+              void                    setEcoNets                 ( const vector<Net*>& );
       inline  void                    setMinimumWL               ( double );
       inline  void                    setRipupLimit              ( unsigned int type, unsigned int );
       inline  void                    setRipupCost               ( unsigned int );
@@ -106,6 +114,8 @@ namespace Kite {
               void                    createGlobalGraph          ( unsigned int mode );
       virtual void                    createDetailedGrid         ();
               void                    saveGlobalSolution         ();
+              void                    recordEventTrace           ( const string& path );
+              void                    saveCongestionMap          ( const string& fileName );
               void                    annotateGlobalGraph        ();
               void                    setFixedPreRouted          ();
               void                    runNegociate               ( unsigned int flags=KtNoFlags );
@@ -115,6 +125,7 @@ namespace Kite {
               void                    _runKiteInit               ();
               void                    _gutKite                   ();
               void                    _computeCagedConstraints   ();
+              void                    _getEcoGCells              ( Katabatic::GCellVector& ) const;
               TrackElement*           _lookup                    ( Segment* ) const;
       inline  TrackElement*           _lookup                    ( AutoSegment* ) const;
               bool                    _check                     ( unsigned int& overlap, const char* message=NULL ) const;
@@ -133,6 +144,8 @@ namespace Kite {
              Configuration*           _configuration;
              vector<RoutingPlane*>    _routingPlanes;
              NegociateWindow*         _negociateWindow;
+             RoutingEventTrace*       _eventTrace;
+             NetSet                   _ecoNets;
              double                   _minimumWL;
              mutable bool             _toolSuccess;
 
@@ -163,9 +176,13 @@ namespace Kite {
   inline  size_t                        KiteEngine::getVTracksReservedLocal () const { return _configuration->getVTracksReservedLocal(); }
   inline  unsigned int                  KiteEngine::getRipupLimit           ( unsigned int type ) const { return _configuration->getRipupLimit(type); }
   inline  NegociateWindow*              KiteEngine::getNegociateWindow      () { return _negociateWindow; }
+  inline  RoutingEventTrace*            KiteEngine::getEventTrace           () const { return _eventTrace; }
+  inline  const KiteEngine::NetSet&     KiteEngine::getEcoNets              () const { return _ecoNets; }
+  inline  bool                          KiteEngine::isEcoNet                ( Net* net ) const { return _ecoNets.find(net) != _ecoNets.end(); }
   inline  size_t                        KiteEngine::getRoutingPlanesSize    () const { return _routingPlanes.size(); }
   inline  void                          KiteEngine::setViewer               ( CellViewer* viewer ) { _viewer=viewer; }
   inline  void                          KiteEngine::setEventLimit           ( unsigned long limit ) { _configuration->setEventsLimit(limit); }
+  inline  void                          KiteEngine::setEventTrace           ( RoutingEventTrace* eventTrace ) { _eventTrace = eventTrace; }
   inline  void                          KiteEngine::setRipupLimit           ( unsigned int type, unsigned int limit ) { _configuration->setRipupLimit(limit,type); }
   inline  void                          KiteEngine::setRipupCost            ( unsigned int cost ) { _configuration->setRipupCost(cost); }
   inline  void                          KiteEngine::setHTracksReservedLocal ( size_t reserved ) { _configuration->setHTracksReservedLocal(reserved); }
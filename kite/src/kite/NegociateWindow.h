@@ -29,6 +29,7 @@ namespace Hurricane {
 #include "kite/RoutingEventQueue.h"
 #include "kite/RoutingEventHistory.h"
 #include "kite/RoutingEventLoop.h"
+#include "kite/NetConflictGraph.h"
 
 
 namespace Kite {
@@ -105,6 +106,7 @@ namespace Kite {
       inline RoutingEventQueue&            getEventQueue      ();
       inline RoutingEventHistory&          getEventHistory    ();
       inline RoutingEventLoop&             getEventLoop       ();
+      inline const NetConflictGraph&       getConflictGraph   () const;
       inline Stage                         getStage           () const;
              void                          setGCells          ( const Katabatic::GCellVector& );
       inline void                          setInterrupt       ( bool );
@@ -132,6 +134,7 @@ namespace Kite {
       RoutingEventHistory         _eventHistory;
       RoutingEventLoop            _eventLoop;
       Statistics                  _statistics;
+      NetConflictGraph            _conflictGraph;
 
     // Constructors.
     protected:
@@ -149,6 +152,7 @@ namespace Kite {
   inline const Katabatic::GCellVector& NegociateWindow::getGCells       () const { return _gcells; }
   inline RoutingEventQueue&            NegociateWindow::getEventQueue   () { return _eventQueue; }
   inline RoutingEventHistory&          NegociateWindow::getEventHistory () { return _eventHistory; }
+  inline const NetConflictGraph&       NegociateWindow::getConflictGraph() const { return _conflictGraph; }
   inline void                          NegociateWindow::setInterrupt    ( bool state ) { _interrupt = state; }
   inline void                          NegociateWindow::rescheduleEvent ( RoutingEvent* event, unsigned int level ) { event->reschedule(_eventQueue,level); }
   inline std::string                   NegociateWindow::_getTypeName    () const { return "NegociateWindow"; }
@@ -0,0 +1,87 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Header  :  "./kite/NetConflictGraph.h"                     |
+// +-----------------------------------------------------------------+
+
+
+#ifndef  KITE_NET_CONFLICT_GRAPH_H
+#define  KITE_NET_CONFLICT_GRAPH_H
+
+#include <vector>
+
+namespace Hurricane {
+  class Net;
+}
+
+
+namespace Kite {
+
+  using Hurricane::Net;
+
+  class KiteEngine;
+
+
+// -------------------------------------------------------------------
+// Class  :  "NetConflictGraph".
+//
+// Nets which global routes (Katabatic AutoSegments) never share a
+// GCell on the same layer cannot compete for the same Tracks. The
+// graph links the nets that do share one and is greedily colored,
+// largest nets first, into independent sets of nets. Both the build
+// and the coloring are deterministic (nets are ordered by id), so
+// the sets are stable from one run to another.
+//
+// The color of a net is recorded once in the DataNegociate of each of
+// its segments (doglegs inherit it from the segment they are cut from).
+// It does not change the order of the negociation yet: it is meant for
+// a schedule processing the sets concurrently. Nets absent from the
+// graph have the NoColor sentinel.
+
+  class NetConflictGraph {
+    public:
+      static const unsigned int  NoColor = 0xffffffff;
+    public:
+                                         NetConflictGraph ();
+             void                        build            ( KiteEngine* );
+             void                        clear            ();
+      inline size_t                      getNetsCount     () const;
+      inline size_t                      getColorsCount   () const;
+      inline size_t                      getConflictsCount() const;
+      inline Net*                        getNet           ( size_t ) const;
+      inline unsigned int                getColor         ( size_t ) const;
+             unsigned int                getNetColor      ( const Net* ) const;
+             std::vector< std::vector<Net*> >
+                                         getIndependentSets () const;
+             void                        printStatistics  () const;
+    private:
+                                         NetConflictGraph ( const NetConflictGraph& );
+             NetConflictGraph&           operator=        ( const NetConflictGraph& );
+    private:
+      std::vector<Net*>          _nets;
+      std::vector<unsigned int>  _colors;
+      size_t                     _colorsCount;
+      size_t                     _conflictsCount;
+  };
+
+
+  inline size_t        NetConflictGraph::getNetsCount      () const { return _nets.size(); }
+  inline size_t        NetConflictGraph::getColorsCount    () const { return _colorsCount; }
+  inline size_t        NetConflictGraph::getConflictsCount () const { return _conflictsCount; }
+  inline Net*          NetConflictGraph::getNet            ( size_t i ) const { return _nets[i]; }
+  inline unsigned int  NetConflictGraph::getColor          ( size_t i ) const { return _colors[i]; }
+
+
+}  // Kite namespace.
+
+
+#endif  // KITE_NET_CONFLICT_GRAPH_H
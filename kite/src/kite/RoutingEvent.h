@@ -115,7 +115,7 @@ namespace Kite {
       inline  bool                         isRipedByLocal        () const;
       inline  bool                         isOverConstrained     () const;
       inline  unsigned int                 getId                 () const;
-      inline  bool                         getMode               () const;
+      inline  unsigned int                 getMode               () const;
       inline  bool                         canMinimize           () const;
               unsigned int                 getState              () const;
       inline  const Key&                   getKey                () const;
@@ -205,7 +205,7 @@ namespace Kite {
   inline bool                          RoutingEvent::isRipedByLocal          () const { return _ripedByLocal; }
   inline bool                          RoutingEvent::isOverConstrained       () const { return _overConstrained; }
   inline unsigned int                  RoutingEvent::getId                   () const { return _id; }
-  inline bool                          RoutingEvent::getMode                 () const { return _mode; }
+  inline unsigned int                  RoutingEvent::getMode                 () const { return _mode; }
   inline bool                          RoutingEvent::canMinimize             () const { return !_minimized; }
   inline const RoutingEvent::Key&      RoutingEvent::getKey                  () const { return _key; }
   inline TrackElement*                 RoutingEvent::getSegment              () const { return _segment; }
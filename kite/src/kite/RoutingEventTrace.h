@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Header  :  "./kite/RoutingEventTrace.h"                    |
+// +-----------------------------------------------------------------+
+
+
+#ifndef  KITE_ROUTING_EVENT_TRACE_H
+#define  KITE_ROUTING_EVENT_TRACE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+
+
+namespace Kite {
+
+  class RoutingEvent;
+  class KiteEngine;
+
+
+// -------------------------------------------------------------------
+// Class  :  "RoutingEventTrace".
+//
+// Binary trace of a negociation: a snapshot of the Katabatic segments
+// as they are when NegociateWindow::run() starts, followed by the
+// sequence of processed events. When recording, the trace is filled
+// then saved. When replaying, the state reached by the replay is
+// checked against the snapshot, each processed event is compared to
+// the recorded one and timed, so the trace serves as a reproducible
+// benchmark of the detailed router.
+//
+// Recorders are created through KiteEngine::recordEventTrace(), which
+// owns them and saves them at the end of the next negociation. Replayed
+// traces are attached with KiteEngine::setEventTrace() and stay owned
+// by the caller.
+
+  class RoutingEventTrace {
+    public:
+      enum Mode { Recording=1, Replaying=2 };
+    public:
+      class SegmentRecord {
+        public:
+          bool      operator== ( const SegmentRecord& ) const;
+        public:
+          uint64_t  _id;
+          int64_t   _axis;
+          int64_t   _sourceU;
+          int64_t   _targetU;
+          uint32_t  _depth;
+          uint32_t  _flags;
+      };
+      class EventRecord {
+        public:
+          uint64_t  _segmentId;
+          uint32_t  _mode;
+          uint32_t  _level;
+          float     _priority;
+          uint32_t  _padding;
+      };
+    public:
+      static RoutingEventTrace*  createRecorder   ( const std::string& path );
+      static RoutingEventTrace*  load             ( const std::string& path );
+             void                destroy          ();
+      inline bool                isReplaying      () const;
+      inline const std::string&  getPath          () const;
+      inline size_t              getEventsCount   () const;
+      inline size_t              getDivergences   () const;
+             void                snapshot         ( KiteEngine* );
+             void                startEvent       ( const RoutingEvent* );
+             void                endEvent         ();
+             bool                save             () const;
+             void                printStatistics  () const;
+    private:
+                                 RoutingEventTrace ( const std::string& path, Mode );
+                                ~RoutingEventTrace ();
+                                 RoutingEventTrace ( const RoutingEventTrace& );
+             RoutingEventTrace&  operator=         ( const RoutingEventTrace& );
+    private:
+      typedef std::chrono::steady_clock  Clock;
+    private:
+      std::string                 _path;
+      Mode                        _mode;
+      std::string                 _cellName;
+      std::vector<SegmentRecord>  _segments;
+      std::vector<EventRecord>    _events;
+      size_t                      _current;
+      size_t                      _divergences;
+      size_t                      _firstDivergence;
+      uint32_t                    _currentMode;
+      Clock::time_point           _eventStart;
+      double                      _totalTime;
+      double                      _modeTimes  [4];
+      size_t                      _modeCounts [4];
+  };
+
+
+  inline bool                RoutingEventTrace::isReplaying    () const { return _mode == Replaying; }
+  inline const std::string&  RoutingEventTrace::getPath        () const { return _path; }
+  inline size_t              RoutingEventTrace::getEventsCount () const { return (_mode == Replaying) ? _current : _events.size(); }
+  inline size_t              RoutingEventTrace::getDivergences () const { return _divergences; }
+
+
+}  // Kite namespace.
+
+
+#endif  // KITE_ROUTING_EVENT_TRACE_H
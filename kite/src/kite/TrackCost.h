@@ -82,6 +82,7 @@ namespace Kite {
       inline       bool          isHardOverlap      () const;
       inline       bool          isOverlapGlobal    () const;
       inline       bool          isGlobalEnclosed   () const;
+      inline       bool          isInsertBlocked    () const;
                    bool          isFree             () const;
       inline       unsigned int  getFlags           () const;
       inline       Track*        getTrack           () const;
@@ -105,6 +106,7 @@ namespace Kite {
       inline       void          setHardOverlap     ();
       inline       void          setOverlapGlobal   ();
       inline       void          setGlobalEnclosed  ();
+      inline       void          setInsertBlocked   ();
       inline       void          incTerminals       ( unsigned int );
       inline       void          incDelta           ( DbU::Unit );
       inline       void          incDeltaPerpand    ( DbU::Unit );
@@ -136,6 +138,7 @@ namespace Kite {
       bool          _rightOverlap;
       bool          _overlapGlobal;
       bool          _globalEnclosed;
+      bool          _insertBlocked;
       unsigned int  _terminals;
       DbU::Unit     _delta;
       DbU::Unit     _deltaShared;
@@ -160,6 +163,7 @@ namespace Kite {
   inline       bool          TrackCost::isHardOverlap      () const { return _hardOverlap; }
   inline       bool          TrackCost::isOverlapGlobal    () const { return _overlapGlobal; }
   inline       bool          TrackCost::isGlobalEnclosed   () const { return _globalEnclosed; }
+  inline       bool          TrackCost::isInsertBlocked    () const { return _insertBlocked; }
   inline       unsigned int  TrackCost::getFlags           () const { return _flags; }
   inline       Track*        TrackCost::getTrack           () const { return _track; }
   inline       size_t        TrackCost::getBegin           () const { return _begin; }
@@ -181,6 +185,7 @@ namespace Kite {
   inline       void          TrackCost::setHardOverlap     () { _hardOverlap = true; }
   inline       void          TrackCost::setOverlapGlobal   () { _overlapGlobal = true; }
   inline       void          TrackCost::setGlobalEnclosed  () { _globalEnclosed = true; }
+  inline       void          TrackCost::setInsertBlocked   () { _insertBlocked = true; }
   inline       void          TrackCost::incTerminals       ( unsigned int terminals ) { _terminals += terminals; }
   inline       void          TrackCost::incDelta           ( DbU::Unit delta ) { _delta        += delta; }
   inline       void          TrackCost::incDeltaPerpand    ( DbU::Unit delta ) { _deltaPerpand += delta; }
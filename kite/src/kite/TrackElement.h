@@ -19,6 +19,7 @@
 
 #include  <string>
 #include  <map>
+#include  <cstdint>
 
 #include  "hurricane/Interval.h"
 namespace Hurricane {
@@ -173,6 +174,7 @@ namespace Kite {
       inline  void                   setIndex             ( size_t );
       virtual void                   updateFreedomDegree  ();
       virtual void                   setDoglegLevel       ( unsigned int );
+      virtual void                   releaseDataNegociate ();
       virtual void                   swapTrack            ( TrackElement* );
       virtual void                   reschedule           ( unsigned int level );
       virtual void                   detach               ();
@@ -201,10 +203,12 @@ namespace Kite {
     protected:
     // Static Attributes.
       static SegmentOverlapCostCB*   _overlapCostCallback;
+    // Index stored on 32 bits, Track::npos is mapped onto it.
+      static const uint32_t          NoIndex = 0xffffffff;
     // Attributes.                   
              unsigned int     _flags;
+             uint32_t         _index;
              Track*           _track;
-             size_t           _index;
              DbU::Unit        _sourceU;
              DbU::Unit        _targetU;
              SegmentObserver  _observer;
@@ -235,12 +239,12 @@ namespace Kite {
   inline bool             TrackElement::hasTargetDogleg      () const { return _flags & TElemTargetDogleg; }
   inline bool             TrackElement::canRipple            () const { return _flags & TElemRipple; }
   inline Track*           TrackElement::getTrack             () const { return _track; }
-  inline size_t           TrackElement::getIndex             () const { return _index; }
+  inline size_t           TrackElement::getIndex             () const { return (_index != NoIndex) ? _index : (size_t)-1; }
   inline DbU::Unit        TrackElement::getLength            () const { return getTargetU() - getSourceU(); }
   inline DbU::Unit        TrackElement::getSourceU           () const { return _sourceU; }
   inline DbU::Unit        TrackElement::getTargetU           () const { return _targetU; }
   inline Interval         TrackElement::getCanonicalInterval () const { return Interval(getSourceU(),getTargetU()); }
-  inline void             TrackElement::setIndex             ( size_t index ) { _index=index; }
+  inline void             TrackElement::setIndex             ( size_t index ) { _index=(index != (size_t)-1) ? index : NoIndex; }
 
   inline void  TrackElement::setRouted()
   {
@@ -104,6 +104,7 @@ namespace Kite {
       virtual void                  setTrack               ( Track* );
       virtual void                  updateFreedomDegree    ();
       virtual void                  setDoglegLevel         ( unsigned int );
+      virtual void                  releaseDataNegociate   ();
       virtual void                  swapTrack              ( TrackElement* );
       virtual void                  reschedule             ( unsigned int level );
       virtual void                  detach                 ();
@@ -133,7 +134,7 @@ namespace Kite {
              AutoSegment*   _base;
              unsigned long  _freedomDegree;
              DbU::Unit      _ppitch;
-             DataNegociate* _data;
+    mutable  DataNegociate* _data;
              unsigned int   _dogLegLevel:4;
 
     protected:
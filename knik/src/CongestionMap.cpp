@@ -0,0 +1,267 @@
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <algorithm>
+
+#include "crlcore/Utilities.h"
+
+#include "knik/GridGraph.h"
+#include "knik/CongestionMap.h"
+
+namespace {
+
+  using namespace std;
+
+  const char      Magic[8] = { 'K', 'N', 'I', 'K', 'C', 'M', 'A', 'P' };
+  const uint32_t  Version  = 1;
+
+  inline uint16_t clamp16 ( unsigned value ) { return (value > 0xffff) ? 0xffff : (uint16_t)value; }
+
+  template< typename T >
+  inline bool writeRaw ( FILE* file, const T* data, size_t count )
+  { return fwrite( data, sizeof(T), count, file ) == count; }
+
+  inline void pushU32 ( vector<uint8_t>& buffer, uint32_t value )
+  {
+    buffer.push_back( (value >> 24) & 0xff );
+    buffer.push_back( (value >> 16) & 0xff );
+    buffer.push_back( (value >>  8) & 0xff );
+    buffer.push_back(  value        & 0xff );
+  }
+
+  class CrcTable {
+    public:
+      CrcTable ()
+      {
+        for ( uint32_t n = 0 ; n < 256 ; n++ ) {
+          uint32_t c = n;
+          for ( int k = 0 ; k < 8 ; k++ ) c = (c & 1) ? 0xedb88320 ^ (c >> 1) : (c >> 1);
+          _table[n] = c;
+        }
+      }
+      uint32_t operator[] ( size_t i ) const { return _table[i]; }
+    private:
+      uint32_t _table[256];
+  };
+
+  uint32_t crc32 ( const uint8_t* data, size_t size )
+  {
+    static const CrcTable table;
+
+    uint32_t crc = 0xffffffff;
+    for ( size_t i = 0 ; i < size ; i++ ) crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+  }
+
+  bool writePngChunk ( FILE* file, const char* type, const vector<uint8_t>& data )
+  {
+    vector<uint8_t> chunk;
+    pushU32( chunk, data.size() );
+    chunk.insert( chunk.end(), type, type+4 );
+    chunk.insert( chunk.end(), data.begin(), data.end() );
+    pushU32( chunk, crc32(&chunk[4],chunk.size()-4) );
+    return writeRaw( file, &chunk[0], chunk.size() );
+  }
+
+  // Zlib stream made of uncompressed (stored) deflate blocks.
+  void zlibStore ( const vector<uint8_t>& raw, vector<uint8_t>& stream )
+  {
+    const size_t blockSize = 0xffff;
+
+    stream.clear();
+    stream.push_back( 0x78 );
+    stream.push_back( 0x01 );
+
+    size_t offset = 0;
+    do {
+      size_t   length = min( blockSize, raw.size()-offset );
+      uint16_t nlength = ~(uint16_t)length;
+      stream.push_back( (offset+length == raw.size()) ? 1 : 0 );
+      stream.push_back(  length        & 0xff );
+      stream.push_back( (length  >> 8) & 0xff );
+      stream.push_back(  nlength       & 0xff );
+      stream.push_back( (nlength >> 8) & 0xff );
+      stream.insert( stream.end(), raw.begin()+offset, raw.begin()+offset+length );
+      offset += length;
+    } while ( offset < raw.size() );
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for ( size_t i = 0 ; i < raw.size() ; i++ ) {
+      a = (a + raw[i]) % 65521;
+      b = (b + a)      % 65521;
+    }
+    pushU32( stream, (b << 16) | a );
+  }
+
+  void heatColor ( unsigned occupancy, unsigned capacity, uint8_t* rgb )
+  {
+    if ( !capacity && !occupancy ) { rgb[0] = rgb[1] = rgb[2] = 48; return; }
+    if ( occupancy > capacity )    { rgb[0] = rgb[1] = rgb[2] = 255; return; }
+
+    float ratio = (float)occupancy / (float)capacity;
+    if ( ratio < 0.5 ) {
+      rgb[0] = 0;
+      rgb[1] = (uint8_t)(255 * ratio * 2);
+      rgb[2] = (uint8_t)(255 * (1.0 - ratio * 2));
+    } else {
+      rgb[0] = (uint8_t)(255 * (ratio - 0.5) * 2);
+      rgb[1] = (uint8_t)(255 * (1.0 - (ratio - 0.5) * 2));
+      rgb[2] = 0;
+    }
+  }
+
+} // Anonymous namespace.
+
+
+namespace Knik {
+
+  using std::endl;
+  using std::ostringstream;
+
+CongestionMap::CongestionMap ()
+// ****************************
+    : _xSize (0)
+    , _ySize (0)
+{
+    for ( size_t d = 0 ; d < 2 ; d++ ) {
+        _overflowedEdges[d] = 0;
+        _maxRatio       [d] = 0.0;
+    }
+}
+
+void CongestionMap::build ( const GridGraph* grid )
+// ************************************************
+{
+    _xSize = grid->getXSize();
+    _ySize = grid->getYSize();
+
+    size_t size = (size_t)_xSize * _ySize;
+    for ( size_t d = 0 ; d < 2 ; d++ ) {
+        _occupancies[d].assign ( size, 0 );
+        _capacities [d].assign ( size, 0 );
+    }
+
+    // Lines are independant, the statistics are reduced per thread.
+    unsigned hOverflowed = 0;
+    unsigned vOverflowed = 0;
+    float    hMaxRatio   = 0.0;
+    float    vMaxRatio   = 0.0;
+#pragma omp parallel for schedule(static) reduction(+:hOverflowed,vOverflowed) reduction(max:hMaxRatio,vMaxRatio)
+    for ( int line = 0 ; line < (int)_ySize ; line++ ) {
+        for ( unsigned column = 0 ; column < _xSize ; column++ ) {
+            size_t cell = (size_t)line*_xSize + column;
+            if ( column+1 < _xSize ) {
+                size_t   index     = grid->getHEdgeIndex ( column, line );
+                unsigned occupancy = grid->getOccupancy ( index );
+                unsigned capacity  = grid->getCapacity  ( index );
+                _occupancies[Horizontal][cell] = clamp16 ( occupancy );
+                _capacities [Horizontal][cell] = clamp16 ( capacity );
+                if ( occupancy > capacity ) hOverflowed++;
+                if ( capacity ) hMaxRatio = std::max ( hMaxRatio, (float)occupancy / (float)capacity );
+            }
+            if ( (unsigned)line+1 < _ySize ) {
+                size_t   index     = grid->getVEdgeIndex ( column, line );
+                unsigned occupancy = grid->getOccupancy ( index );
+                unsigned capacity  = grid->getCapacity  ( index );
+                _occupancies[Vertical][cell] = clamp16 ( occupancy );
+                _capacities [Vertical][cell] = clamp16 ( capacity );
+                if ( occupancy > capacity ) vOverflowed++;
+                if ( capacity ) vMaxRatio = std::max ( vMaxRatio, (float)occupancy / (float)capacity );
+            }
+        }
+    }
+
+    _overflowedEdges[Horizontal] = hOverflowed;
+    _overflowedEdges[Vertical  ] = vOverflowed;
+    _maxRatio       [Horizontal] = hMaxRatio;
+    _maxRatio       [Vertical  ] = vMaxRatio;
+}
+
+bool CongestionMap::save ( const string& fileName ) const
+// ******************************************************
+{
+    if ( (fileName.size() > 4) && (fileName.compare(fileName.size()-4,4,".png") == 0) )
+        return savePng ( fileName );
+    return saveBinary ( fileName );
+}
+
+bool CongestionMap::saveBinary ( const string& fileName ) const
+// ************************************************************
+{
+    FILE* file = fopen ( fileName.c_str(), "wb" );
+    if ( !file ) return false;
+
+    uint32_t header[3] = { Version, _xSize, _ySize };
+    bool     success   = writeRaw ( file, Magic, sizeof(Magic) )
+                      && writeRaw ( file, header, 3 );
+    for ( size_t d = 0 ; success && (d < 2) ; d++ ) {
+        success = writeRaw ( file, _occupancies[d].data(), _occupancies[d].size() )
+               && writeRaw ( file, _capacities [d].data(), _capacities [d].size() );
+    }
+
+    return (fclose(file) == 0) && success;
+}
+
+bool CongestionMap::savePng ( const string& fileName ) const
+// *********************************************************
+{
+    if ( !_xSize || !_ySize ) return false;
+
+    // Horizontal map on the left, vertical on the right, one black column
+    // in between. The top line of the image is the top line of the grid.
+    uint32_t        width  = 2*_xSize + 1;
+    uint32_t        height = _ySize;
+    size_t          stride = 1 + 3*(size_t)width;
+    vector<uint8_t> raw ( stride*height, 0 );
+
+#pragma omp parallel for schedule(static)
+    for ( int row = 0 ; row < (int)height ; row++ ) {
+        unsigned line   = height - 1 - row;
+        uint8_t* pixels = &raw[row*stride + 1]; // filter byte left to 0 (none).
+        for ( unsigned column = 0 ; column < _xSize ; column++ ) {
+            size_t cell = (size_t)line*_xSize + column;
+            heatColor ( _occupancies[Horizontal][cell], _capacities[Horizontal][cell], pixels + 3*column );
+            heatColor ( _occupancies[Vertical  ][cell], _capacities[Vertical  ][cell], pixels + 3*(_xSize+1+column) );
+        }
+    }
+
+    vector<uint8_t> ihdr;
+    pushU32 ( ihdr, width );
+    pushU32 ( ihdr, height );
+    ihdr.push_back ( 8 ); // bit depth.
+    ihdr.push_back ( 2 ); // truecolor.
+    ihdr.push_back ( 0 );
+    ihdr.push_back ( 0 );
+    ihdr.push_back ( 0 );
+
+    vector<uint8_t> idat;
+    zlibStore ( raw, idat );
+
+    FILE* file = fopen ( fileName.c_str(), "wb" );
+    if ( !file ) return false;
+
+    const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    bool success = writeRaw      ( file, signature, sizeof(signature) )
+                && writePngChunk ( file, "IHDR", ihdr )
+                && writePngChunk ( file, "IDAT", idat )
+                && writePngChunk ( file, "IEND", vector<uint8_t>() );
+
+    return (fclose(file) == 0) && success;
+}
+
+void CongestionMap::printStatistics () const
+// *****************************************
+{
+    ostringstream grid;
+    grid << _xSize << "x" << _ySize;
+
+    cmess1 << "  o  Congestion map." << endl;
+    cmess1 << Dots::asString  ( "     - Grid"                     , grid.str() ) << endl;
+    cmess1 << Dots::asUInt    ( "     - Overflowed H edges"       , _overflowedEdges[Horizontal] ) << endl;
+    cmess1 << Dots::asUInt    ( "     - Overflowed V edges"       , _overflowedEdges[Vertical  ] ) << endl;
+    cmess1 << Dots::asDouble  ( "     - Max H occupancy/capacity" , _maxRatio[Horizontal] ) << endl;
+    cmess1 << Dots::asDouble  ( "     - Max V occupancy/capacity" , _maxRatio[Vertical  ] ) << endl;
+}
+
+} // namespace Knik
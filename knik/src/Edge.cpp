@@ -18,50 +18,22 @@ extern float __edge_cost__;
 
 const Name  Edge::_extensionName = "Knik::Edge";
 
-Edge::Edge ( Vertex* from, Vertex* to )
-// ************************************
+Edge::Edge ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity )
+// ************************************************************************************
     : Inherit (from->getCell())
+    , _grid (grid)
     , _from (from)
-    , _nextFrom (NULL)
     , _to (to)
-    , _nextTo (NULL)
-    , _connexID (-1)
-    , _cost (0.0)
-    , _capacity (0)
-    , _realOccupancy (0)
-    , _estimateOccupancy (0.0)
-    , _netStamp (0)
-    , _segments()
+    , _index (index)
+    , _hasBeenCongested (false)
 {
-    /*_cost = v1->getGCell()->getCenter().ManhattanDistance (v2->getGCell()->getCenter());*/
-}
-
-Edge::Edge ( Vertex* from, Vertex* to, unsigned capacity )
-// *******************************************************
-    : Inherit (from->getCell())
-    , _boundingBox()
-    , _from (from)
-    , _nextFrom (NULL)
-    , _to (to)
-    , _nextTo (NULL)
-    , _connexID (-1)
-    , _cost (0.0)
-    , _capacity (capacity)
-    , _realOccupancy (0)
-    , _estimateOccupancy (0.0)
-    , _netStamp (0)
-    , _isCongested (false)
-    , _segments()
-{
-//cerr << "    Edge::Edge() capacity:" << _capacity << endl;
+    _grid->setEdge ( _index, this, capacity );
 }
 
 void Edge::_postCreate ()
 // **********************
 {
     Inherit::_postCreate();
-
-    _segments.reserve(_capacity);
 }
 
 Edge::~Edge()
@@ -82,64 +54,34 @@ void Edge::_preDestroy()
     Inherit::_preDestroy();
 }
 
-void Edge::setCapacity ( unsigned int capacity )
-// *****************************************
-{
-  _capacity = capacity;
-//cerr << "Setting capacity to " << _capacity << " on " << this << endl;
-}
-
 void Edge::increaseCapacity ( int capacity )
 // *****************************************
 {
-  if ( (int)_capacity + capacity < 0 ) _capacity = 0;
+  unsigned& edgeCapacity = _grid->_capacities[_index];
+  if ( (int)edgeCapacity + capacity < 0 ) edgeCapacity = 0;
   else
-    _capacity += capacity;
+    edgeCapacity += capacity;
 
-//if ( _capacity < 2 ) _capacity = 0;
+//if ( edgeCapacity < 2 ) edgeCapacity = 0;
 
   // cerr << "Increase Edge Capacity " << _from->getPosition()
-  //      << " to " << _to->getPosition() << ":" << _capacity << endl;
+  //      << " to " << _to->getPosition() << ":" << edgeCapacity << endl;
 
-//cerr << "Increasing capacity to " << _capacity << " on " << this << endl;
+//cerr << "Increasing capacity to " << edgeCapacity << " on " << this << endl;
 
-  if ( _capacity == 0 )
+  if ( edgeCapacity == 0 )
     ltrace(300) << Warning("%s has reached NULL capacity.",getString(this).c_str()) << endl;
 }
 
-void Edge::incOccupancy ()
-// ***********************
-{
-    _realOccupancy++;
-    if ( !_isCongested ) {
-        if ( _realOccupancy > _capacity ) {
-            _boundingBox = computeBoundingBox();
-            _isCongested = true;
-            // reste a mettre les segments traversant l'edge dans la pile ou s'ils y sont deja a les mettre a jour
-        }
-    }
-
-}
-
- void Edge::decOccupancy ()
-// ************************
-{
-    if ( _realOccupancy > 0 )
-        _realOccupancy--;
-    if ( _isCongested && (_realOccupancy <= _capacity) ) {
-        _boundingBox = computeBoundingBox();
-        _isCongested = false;
-    }
-}
-
 void Edge::removeSegment ( Segment* segment )
 // ******************************************
 {
     assert(segment);
     decOccupancy();
-    vector<Segment*>::iterator vsit = find(_segments.begin(),_segments.end(),segment);
-    if ( vsit != _segments.end() )
-        _segments.erase ( vsit );
+    vector<Segment*>& segments = _grid->_segments[_index];
+    vector<Segment*>::iterator vsit = find(segments.begin(),segments.end(),segment);
+    if ( vsit != segments.end() )
+        segments.erase ( vsit );
     else {
         cerr << segment << "  " << this << endl;
         Breakpoint::stop(0, "Shootdown -h now");
@@ -151,9 +93,9 @@ void Edge::addSubEstimateOccupancy ( float increment, bool add )
 // *************************************************************
 {
     if ( add )
-        _estimateOccupancy += increment;
+        _grid->_estimates[_index] += increment;
     else
-        _estimateOccupancy -= increment;
+        _grid->_estimates[_index] -= increment;
 
     return;
 }
@@ -198,9 +140,12 @@ Cell* Edge::getCell() const
 float Edge::getCost ( Edge* arrivalEdge )
 // **************************************
 {
+    unsigned capacity = getCapacity();
+    float&   cost     = _grid->_costs[_index];
+
 // 20/10/2010: Check for null capacity, which may occurs after back-annotation
 // by Kite.
-  if ( _capacity == 0.0 ) return (float)(HUGE_VAL);
+  if ( capacity == 0.0 ) return (float)(HUGE_VAL);
 
 //#ifdef __USE_CONGESTION__
     if ( __congestion__ ) {
@@ -215,56 +160,47 @@ float Edge::getCost ( Edge* arrivalEdge )
         if ( !__ripupMode__ ) {
             //#if defined ( __USE_STATIC_PRECONGESTION__ ) || defined ( __USE_DYNAMIC_PRECONGESTION__ )
             if ( __precongestion__ )
-                edge_occupancy = ((float)getRealOccupancy() + getEstimateOccupancy()) / (float)_capacity;
+                edge_occupancy = ((float)getRealOccupancy() + getEstimateOccupancy()) / (float)capacity;
             //#else
             else
-                edge_occupancy = (float)getRealOccupancy() / (float)_capacity;
+                edge_occupancy = (float)getRealOccupancy() / (float)capacity;
             //#endif
-            _cost = 1.0 + (9.0 / (1.0 + exp(-30.0 * (edge_occupancy - edge_capacity)))); // plutot que 1.0 on devrait avoir un getLength renvoyant la longueur de l'arete en unités normalisées (pas de grille)
+            cost = 1.0 + (9.0 / (1.0 + exp(-30.0 * (edge_occupancy - edge_capacity)))); // plutot que 1.0 on devrait avoir un getLength renvoyant la longueur de l'arete en unités normalisées (pas de grille)
         }
         else {
             // dans ce mode l'estimation de congestion est utilisé comme historique de congestion
-            edge_occupancy = (float)getRealOccupancy() / (float)_capacity;
+            edge_occupancy = (float)getRealOccupancy() / (float)capacity;
             float historicCost;
             if ( edge_occupancy < 1 )
                 historicCost = getEstimateOccupancy() * edge_occupancy;
             else
                 historicCost = getEstimateOccupancy() * exp(log(8)*(edge_occupancy - edge_capacity));
-            _cost = 1.0 + (19.0 / (1.0 + exp(-60.0 * (edge_occupancy - edge_capacity)))) + historicCost;
+            cost = 1.0 + (19.0 / (1.0 + exp(-60.0 * (edge_occupancy - edge_capacity)))) + historicCost;
         }
     }
 //#else
     else
-        _cost = 1.0;
+        cost = 1.0;
 //#endif
     // Prise en compte des vias !
     if ( arrivalEdge ) {
         if ( arrivalEdge->isVertical() && isHorizontal() )
-            _cost += __edge_cost__;
+            cost += __edge_cost__;
         if ( arrivalEdge->isHorizontal() && isVertical() )
-            _cost += __edge_cost__;
+            cost += __edge_cost__;
     }
 
     //if ( _from->getRoutingGraph()->getRipupMode() )
     //   if ( _isCongested ) 
-    //       _cost += 1000;
-
-    return _cost;
-}
-
-unsigned Edge::getRealOccupancy() const
-// ************************************
-{
-    // pour debug plus facile :   // Attention ce n'est plus vrai lorsque l'edge gère elle même son occupation!
-    //assert ( _realOccupancy == _fence->getOccupancy() );
+    //       cost += 1000;
 
-    return _realOccupancy;
+    return cost;
 }
 
 Segment* Edge::getSegmentFor ( Net* net )
 // **************************************
 {
-   for_each_segment ( segment, getCollection ( _segments ) ) {
+   for_each_segment ( segment, getCollection ( _grid->_segments[_index] ) ) {
         if ( segment->getNet() == net )
             return segment;
         end_for;
@@ -275,7 +211,7 @@ Segment* Edge::getSegmentFor ( Net* net )
 bool Edge::hasInfo() const
 // ***********************
 {
-   return (_netStamp == _from->getRoutingGraph()->getNetStamp())&&(_connexID != -1);
+   return (getNetStamp() == _from->getRoutingGraph()->getNetStamp())&&(getConnexID() != -1);
 }
 
 // void Edge::_Draw ( View* view, BasicLayer* basicLayer, const Box& updateArea, const Transformation& transformation )
@@ -373,10 +309,10 @@ string Edge::_getString() const
 // ****************************
 {
     return "<" + _TName ( "Edge" )
-         + " id:" + getString( _connexID )
-         + " s:"  + getString( _netStamp )
-         + " "    + getString( _realOccupancy )
-         + "/"    + getString( _capacity )
+         + " id:" + getString( getConnexID() )
+         + " s:"  + getString( getNetStamp() )
+         + " "    + getString( getRealOccupancy() )
+         + "/"    + getString( getCapacity() )
          + " "    + getString( _from )
          + " "    + getString( _to ) + ">";
 }
@@ -391,15 +327,14 @@ Record* Edge::_getRecord() const
 
     record->add ( getSlot ( "from"     , _from      ) );
     record->add ( getSlot ( "to"       , _to        ) );
-    record->add ( getSlot ( "nextFrom" , _nextFrom  ) );
-    record->add ( getSlot ( "nextTo"   , _nextTo    ) );
-    record->add ( getSlot ( "connexID" , _connexID  ) );
-    record->add ( getSlot ( "cost"     , _cost      ) );
-    record->add ( getSlot ( "netStamp" , _netStamp  ) );
-    record->add ( getSlot ( "capacity" , _capacity  ) );
-    record->add ( getSlot ( "occupancy", _realOccupancy ) );
-    record->add ( getSlot ( "estimate occupancy", _estimateOccupancy ) );
-    record->add ( getSlot ( "segments" , &_segments ) );
+    record->add ( getSlot ( "index"    , _index     ) );
+    record->add ( getSlot ( "connexID" , getConnexID() ) );
+    record->add ( getSlot ( "cost"     , getConstCost() ) );
+    record->add ( getSlot ( "netStamp" , getNetStamp() ) );
+    record->add ( getSlot ( "capacity" , getCapacity() ) );
+    record->add ( getSlot ( "occupancy", getRealOccupancy() ) );
+    record->add ( getSlot ( "estimate occupancy", getEstimateOccupancy() ) );
+    record->add ( getSlot ( "segments" , &_grid->_segments[_index] ) );
 
     return record;
 }
@@ -21,6 +21,7 @@
 #include "hurricane/Breakpoint.h"
 
 #include "crlcore/Utilities.h"
+#include "crlcore/Probes.h"
 #include "crlcore/AllianceFramework.h"
 #include "crlcore/RoutingGauge.h"
 #include "crlcore/RoutingLayerGauge.h"
@@ -48,11 +49,19 @@ namespace Knik {
   using Hurricane::ltraceout;
   using Hurricane::tab;
   using Hurricane::ForEachIterator;
+  using CRL::Probes;
+  using CRL::ScopedProbe;
 
 int  depthMaterialize;
 unsigned countDijkstra    = 0;
 unsigned countMonotonic   = 0;
 unsigned countMaterialize = 0;
+unsigned countPatternNets      = 0;
+unsigned countPatternBranches  = 0;
+unsigned countPatternFallbacks = 0;
+// Above this bounding box area (in GCells), a connexion is not pattern routed
+// but left to Dijkstra(): the prefix sums would cost more than the maze search.
+const size_t PatternRouteMaxArea = 64*64;
 bool debugging;
 Name debugName = Name("");
 
@@ -61,12 +70,22 @@ bool __ripupMode__;
 extern float __edge_capacity_percent__;
 extern unsigned __congestion__;
 extern unsigned __precongestion__;
+extern float __edge_cost__;
 
 using namespace CRL;
 
 STuple::STuplePQIter STuple::_stuplePQEnd;
 Name STuple::CostProperty::_name = "Knik::CostProperty";
 
+struct PatternShape {
+    float    _cost;
+    bool     _vhv;   // false: horizontal-vertical-horizontal, true: vertical-horizontal-vertical.
+    unsigned _pivot; // column (HVH) or line (VHV) of the middle leg, relative to the bounding box.
+
+    PatternShape(float cost, bool vhv, unsigned pivot) { _cost=cost; _vhv=vhv; _pivot=pivot; };
+    bool operator<(const PatternShape& other) const { return _cost < other._cost; };
+};
+
 struct segmentStat {
     unsigned nbDep;
     unsigned nbTot;
@@ -79,6 +98,7 @@ struct segmentStat {
     void incNbDep() { nbDep++; };
     void incNbTot() { nbTot++; };
     void incSumOv ( unsigned inc ) { sumOv+=inc; };
+    void merge ( const segmentStat& other ) { nbDep+=other.nbDep; nbTot+=other.nbTot; sumOv+=other.sumOv; };
 
     unsigned getNbDep() const { return nbDep; };
     unsigned getNbTot() const { return nbTot; };
@@ -115,6 +135,7 @@ Graph::Graph ( KnikEngine* engine, RoutingGrid* routingGrid, bool benchMode, boo
     , _maxYOccupancy ( 0 )
     , _hEdgeNormalisedLength ( 1.0 ) // au cas ou
     , _vEdgeNormalisedLength ( 1.0 ) // au cas ou
+    , _fluteScratch ( flute_scratch_create() )
 {
     __ripupMode__ = false;
 }
@@ -246,10 +267,7 @@ void Graph::_postCreate()
 //    }
 //    cmess2 << "           - Parcours des gcells puis des fences pour créer les edges terminé" << endl;
 
-    for ( unsigned i = 0 ; i < _all_vertexes.size() ; i++ ) {
-        _all_vertexes[i]->sortEdges();
-    }
-    cmess2 << "     - Edge sorting completed." << endl;
+    cmess2 << "     - Grid graph memory: " << (getGridGraph()->getMemorySize() >> 10) << " Kb." << endl;
 
     STuple::setSTuplePQEnd ( _stuplePriorityQueue.end() );
 
@@ -322,6 +340,8 @@ void Graph::_preDestroy()
     #ifdef __USE_SLICINGTREE__
         _slicingTree->destroy();
     #endif
+
+    flute_scratch_destroy ( _fluteScratch );
 }
 
 Vertex* Graph::getPredecessor ( const Vertex* vertex )
@@ -525,9 +545,13 @@ Vertex* Graph::createVertex ( Point position, DbU::Unit halfWidth, DbU::Unit hal
     return vertex;
 }
 
-  void Graph::createHEdge ( Vertex* from, Vertex* to, size_t reserved )
-// ********************************************************************
+void Graph::createHEdge ( unsigned column, unsigned line, size_t reserved )
+// *************************************************************************
 {
+    GridGraph* grid = getGridGraph();
+    Vertex*    from = grid->getVertex ( column  , line );
+    Vertex*    to   = grid->getVertex ( column+1, line );
+
     size_t capacity = 0;
     if ( _routingGrid ) {
         capacity = _routingGrid->getHCapacity();
@@ -546,26 +570,23 @@ Vertex* Graph::createVertex ( Point position, DbU::Unit halfWidth, DbU::Unit hal
         }
       //cerr << "createHEdge capacity:" << capacity << " reserved:" << reserved << endl;
     }
-    Edge* newEdge = HEdge::create ( from, to, capacity-reserved );
+    Edge* newEdge = HEdge::create ( grid, grid->getHEdgeIndex(column,line), from, to, capacity-reserved );
 
     _all_edges.push_back ( newEdge );
 
     newEdge->setCost(1);
 
-    Edge* previousEdge = from->getHEdgeOut();
-    if ( previousEdge )
-        newEdge->setNextFrom ( previousEdge );
     from->setHEdgeOut ( newEdge );
-
-    previousEdge = to->getHEdgeIn();
-    if ( previousEdge )
-        newEdge->setNextTo ( previousEdge );
     to->setHEdgeIn ( newEdge );
 }
 
-void Graph::createVEdge ( Vertex* from, Vertex* to, size_t reserved )
-// ******************************************************************
+void Graph::createVEdge ( unsigned column, unsigned line, size_t reserved )
+// *************************************************************************
 {
+    GridGraph* grid = getGridGraph();
+    Vertex*    from = grid->getVertex ( column, line   );
+    Vertex*    to   = grid->getVertex ( column, line+1 );
+
     size_t capacity = 0;
     if ( _routingGrid )
         capacity = _routingGrid->getVCapacity();
@@ -583,20 +604,13 @@ void Graph::createVEdge ( Vertex* from, Vertex* to, size_t reserved )
         }
       //cerr << "createVEdge capacity:" << capacity << " reserved:" << reserved << endl;
     }
-    Edge* newEdge = VEdge::create ( from, to, capacity-reserved );
+    Edge* newEdge = VEdge::create ( grid, grid->getVEdgeIndex(column,line), from, to, capacity-reserved );
 
     _all_edges.push_back ( newEdge );
 
     newEdge->setCost(1);
 
-    Edge* previousEdge = from->getVEdgeOut();
-    if ( previousEdge )
-        newEdge->setNextFrom ( previousEdge );
     from->setVEdgeOut ( newEdge );
-
-    previousEdge = to->getVEdgeIn();
-    if ( previousEdge )
-        newEdge->setNextTo ( previousEdge );
     to->setVEdgeIn ( newEdge );
 }
 
@@ -1116,10 +1130,14 @@ int Graph::initRouting ( Net* net )
     return _vertexes_to_route.size();
 }
 
-void Graph::Dijkstra()
-// *******************
+void Graph::Dijkstra ( bool updateEstimate )
+// *****************************************
 {
 //checkEmptyPriorityQueue();
+  static unsigned int probe     = Probes::registerProbe( "Knik::Graph::Dijkstra()"       , Probes::Timer );
+  static unsigned int terminals = Probes::registerProbe( "Knik::Graph::Dijkstra() terms.", Probes::Histogram );
+  ScopedProbe         scope ( probe );
+  Probes::sample( terminals, _vertexes_to_route.size() );
 
   countDijkstra++;
 
@@ -1135,7 +1153,7 @@ void Graph::Dijkstra()
 //set<Vertex*,VertexPositionComp> copy_vertex = _vertexes_to_route; // This is no more useful
 
 //#if defined ( __USE_DYNAMIC_PRECONGESTION__ )
-  if ( !__ripupMode__ &&  (__precongestion__ == 2) )
+  if ( updateEstimate && !__ripupMode__ &&  (__precongestion__ == 2) )
     UpdateEstimateCongestion();
 //#endif
 
@@ -1521,14 +1539,269 @@ void Graph::Monotonic()
     //#endif
 }
 
-FTree* Graph::createFluteTree()
-// ****************************
+void Graph::relabelConnexComp ( Vertex* vertex, Edge* arrivalEdge, int connexID )
+// ******************************************************************************
+{
+    // Same walk as initConnexComp() but without touching the priority queue:
+    // used by the pattern router to merge two connex components.
+    int vertexConnex = vertex->getConnexID();
+    vertex->setConnexID ( connexID );
+    for ( unsigned i = 0 ; i < 4 ; i++ ) {
+        Edge* edge = vertex->getFirstEdges ( i );
+        if ( !edge || (edge == arrivalEdge) )
+            continue;
+        if ( (edge->getNetStamp() == _netStamp) && (edge->getConnexID() == vertexConnex) ) {
+            edge->setConnexID ( connexID );
+            relabelConnexComp ( edge->getOpposite(vertex), edge, connexID );
+        }
+    }
+}
+
+bool Graph::PatternRoute()
+// ***********************
+{
+    // Pattern routing fast path, tried before Dijkstra() by the initial routing.
+    //
+    // The net is decomposed in two pins connexions by FLUTE. Each connexion is
+    // routed with the cheapest L or Z shape lying inside its bounding box, the
+    // costs of the shapes being computed in constant time from prefix sums of
+    // the edges costs along the rows & columns of the box. A shape is rejected
+    // as soon as one of its edges would overflow. The routed connexions merge
+    // the connex components of _vertexes_to_route exactly like Dijkstra() does,
+    // so the connexions that could not be pattern routed (or whose bounding box
+    // exceeds PatternRouteMaxArea) are left to the maze router. Returns true if
+    // the whole net has been routed (and materialized).
+    static unsigned int probe = Probes::registerProbe( "Knik::Graph::PatternRoute()", Probes::Timer );
+    ScopedProbe         scope ( probe );
+
+    assert ( _vertexes_to_route.size() > 1 );
+
+    // Done once for the whole net: the caller must not do it again in Dijkstra().
+    if ( !__ripupMode__ && (__precongestion__ == 2) )
+        UpdateEstimateCongestion();
+
+    GridGraph* grid = getGridGraph();
+    FTree      flutetree = createFluteTree();
+
+    vector< pair<Vertex*,Vertex*> > branches;
+    for ( int i = 0 ; i < 2*flutetree.deg-2 ; i++ ) {
+        Vertex* source = getVertex ( flutetree.branch[i].x                     , flutetree.branch[i].y );
+        Vertex* target = getVertex ( flutetree.branch[flutetree.branch[i].n].x, flutetree.branch[flutetree.branch[i].n].y );
+        if ( source != target )
+            branches.push_back ( pair<Vertex*,Vertex*>(source,target) );
+    }
+
+    unsigned routed = 0;
+    unsigned failed = 0;
+    bool     progress = true;
+    while ( progress && !branches.empty() ) {
+        progress = false;
+        for ( size_t ibranch = 0 ; ibranch < branches.size() ; ) {
+            Vertex* source = branches[ibranch].first;
+            Vertex* target = branches[ibranch].second;
+            bool sourceMarked = (source->getNetStamp() == _netStamp) && (source->getConnexID() != -1);
+            bool targetMarked = (target->getNetStamp() == _netStamp) && (target->getConnexID() != -1);
+
+            // A branch is only routed from an already connected vertex, so the
+            // components always hold a routing pad (or a pre-existing contact).
+            if ( !sourceMarked && !targetMarked ) {
+                ibranch++;
+                continue;
+            }
+            if ( !sourceMarked ) {
+                std::swap ( source, target );
+                std::swap ( sourceMarked, targetMarked );
+            }
+            branches[ibranch] = branches.back();
+            branches.pop_back();
+            progress = true;
+
+            int sourceID = source->getConnexID();
+            if ( targetMarked && (target->getConnexID() == sourceID) )
+                continue;
+
+            if ( patternRouteBranch ( grid, source, target ) ) {
+                routed++;
+                if ( targetMarked ) {
+                    // The target component is absorbed: forget its representative.
+                    int      targetID = target->getConnexID();
+                    Vertex*  toErase  = NULL;
+                    for ( VertexSetIter vsit = _vertexes_to_route.begin() ; vsit != _vertexes_to_route.end() ; vsit++ ) {
+                        if ( (*vsit)->getConnexID() == targetID )
+                            toErase = (*vsit);
+                    }
+                    assert ( toErase );
+                    _vertexes_to_route.erase ( toErase );
+                    relabelConnexComp ( target, NULL, sourceID );
+                }
+            }
+            else
+                failed++;
+        }
+    }
+    failed += branches.size();
+
+    countPatternBranches  += routed;
+    countPatternFallbacks += failed;
+
+    if ( _vertexes_to_route.size() > 1 )
+        return false;
+
+    countPatternNets++;
+    MaterializeRouting ( *(_vertexes_to_route.begin()) );
+    return true;
+}
+
+bool Graph::patternRouteBranch ( GridGraph* grid, Vertex* source, Vertex* target )
+// *******************************************************************************
+{
+    // Routes source -> target with the cheapest non overflowing L or Z shape.
+    // On success, the path edges and the newly crossed vertexes take the
+    // source connexID, so does the target if it was not yet connected (if
+    // it was, merging its component is left to the caller).
+    unsigned sCol  = _matrixVertex->getColumnIndex ( source->getX() );
+    unsigned sLine = _matrixVertex->getLineIndex   ( source->getY() );
+    unsigned tCol  = _matrixVertex->getColumnIndex ( target->getX() );
+    unsigned tLine = _matrixVertex->getLineIndex   ( target->getY() );
+
+    unsigned col0  = (sCol  < tCol ) ? sCol  : tCol;
+    unsigned line0 = (sLine < tLine) ? sLine : tLine;
+    unsigned w     = ((sCol  < tCol ) ? tCol  : sCol ) - col0;
+    unsigned h     = ((sLine < tLine) ? tLine : sLine) - line0;
+    unsigned sx    = sCol  - col0;
+    unsigned sy    = sLine - line0;
+    unsigned tx    = tCol  - col0;
+    unsigned ty    = tLine - line0;
+
+    if ( (size_t)(w+1)*(h+1) > PatternRouteMaxArea ) return false;
+
+    // Prefix sums along the rows (hCosts, hFull) and the columns (vCosts, vFull)
+    // of the bounding box. Full edges (no room for one more wire) are counted
+    // apart and contribute no cost, so an infinite cost never enters the sums.
+    vector<float>    hCosts ( (size_t)(h+1)*(w+1), 0.0 );
+    vector<unsigned> hFull  ( (size_t)(h+1)*(w+1), 0   );
+    vector<float>    vCosts ( (size_t)(w+1)*(h+1), 0.0 );
+    vector<unsigned> vFull  ( (size_t)(w+1)*(h+1), 0   );
+    for ( unsigned j = 0 ; j <= h ; j++ ) {
+        for ( unsigned i = 0 ; i < w ; i++ ) {
+            Edge*  edge = grid->getHEdge ( col0+i, line0+j );
+            size_t k    = (size_t)j*(w+1) + i;
+            bool   full = !edge || (edge->getRealOccupancy() >= edge->getCapacity());
+            hCosts[k+1] = hCosts[k] + ( full ? 0.0 : edge->getCost(NULL) );
+            hFull [k+1] = hFull [k] + ( full ? 1   : 0 );
+        }
+    }
+    for ( unsigned i = 0 ; i <= w ; i++ ) {
+        for ( unsigned j = 0 ; j < h ; j++ ) {
+            Edge*  edge = grid->getVEdge ( col0+i, line0+j );
+            size_t k    = (size_t)i*(h+1) + j;
+            bool   full = !edge || (edge->getRealOccupancy() >= edge->getCapacity());
+            vCosts[k+1] = vCosts[k] + ( full ? 0.0 : edge->getCost(NULL) );
+            vFull [k+1] = vFull [k] + ( full ? 1   : 0 );
+        }
+    }
+
+    // Candidates: HVH shapes pivoting on a column, VHV shapes pivoting on a
+    // line. The pivots on the source or target column/line are the L shapes.
+    vector<PatternShape> shapes;
+    for ( unsigned c = 0 ; c <= w ; c++ ) {
+        size_t a  = (size_t)sy*(w+1), b = (size_t)ty*(w+1), v = (size_t)c*(h+1);
+        unsigned full = (hFull[a+((sx<c)?c:sx)] - hFull[a+((sx<c)?sx:c)])
+                      + (vFull[v+((sy<ty)?ty:sy)] - vFull[v+((sy<ty)?sy:ty)])
+                      + (hFull[b+((tx<c)?c:tx)] - hFull[b+((tx<c)?tx:c)]);
+        if ( !full ) {
+            float cost = (hCosts[a+((sx<c)?c:sx)] - hCosts[a+((sx<c)?sx:c)])
+                       + (vCosts[v+((sy<ty)?ty:sy)] - vCosts[v+((sy<ty)?sy:ty)])
+                       + (hCosts[b+((tx<c)?c:tx)] - hCosts[b+((tx<c)?tx:c)]);
+            unsigned bends = ( ((sx != c) && (sy != ty)) ? 1 : 0 ) + ( ((sy != ty) && (c != tx)) ? 1 : 0 );
+            shapes.push_back ( PatternShape(cost + bends*__edge_cost__, false, c) );
+        }
+        if ( sy == ty ) break; // Straight line: all the pivots give the same path.
+    }
+    for ( unsigned r = 0 ; r <= h ; r++ ) {
+        if ( sx == tx ) break; // Straight line: already done by the HVH loop.
+        size_t a  = (size_t)sx*(h+1), b = (size_t)tx*(h+1), l = (size_t)r*(w+1);
+        unsigned full = (vFull[a+((sy<r)?r:sy)] - vFull[a+((sy<r)?sy:r)])
+                      + (hFull[l+((sx<tx)?tx:sx)] - hFull[l+((sx<tx)?sx:tx)])
+                      + (vFull[b+((ty<r)?r:ty)] - vFull[b+((ty<r)?ty:r)]);
+        if ( full ) continue;
+        float cost = (vCosts[a+((sy<r)?r:sy)] - vCosts[a+((sy<r)?sy:r)])
+                   + (hCosts[l+((sx<tx)?tx:sx)] - hCosts[l+((sx<tx)?sx:tx)])
+                   + (vCosts[b+((ty<r)?r:ty)] - vCosts[b+((ty<r)?ty:r)]);
+        unsigned bends = ( ((sy != r) && (sx != tx)) ? 1 : 0 ) + ( ((sx != tx) && (r != ty)) ? 1 : 0 );
+        shapes.push_back ( PatternShape(cost + bends*__edge_cost__, true, r) );
+    }
+    sort ( shapes.begin(), shapes.end() );
+
+    // The cheapest shape which only crosses free vertexes is kept: going
+    // through a vertex already connected for this net would create a loop.
+    vector<Edge*> path;
+    for ( size_t ishape = 0 ; ishape < shapes.size() ; ishape++ ) {
+        path.clear();
+        unsigned col   = sCol;
+        unsigned line  = sLine;
+        bool     vhv   = shapes[ishape]._vhv;
+        unsigned pivot = shapes[ishape]._pivot;
+        bool     horizontals[3] = { !vhv, vhv, !vhv };
+        unsigned stops      [3] = { vhv ? line0+pivot : col0+pivot
+                                  , vhv ? tCol        : tLine
+                                  , vhv ? tLine       : tCol };
+        for ( unsigned leg = 0 ; leg < 3 ; leg++ ) {
+            unsigned stop = stops[leg];
+            if ( horizontals[leg] ) {
+                while ( col  < stop ) { path.push_back ( grid->getHEdge(col  ,line) ); col++;  }
+                while ( col  > stop ) { path.push_back ( grid->getHEdge(col-1,line) ); col--;  }
+            }
+            else {
+                while ( line < stop ) { path.push_back ( grid->getVEdge(col,line  ) ); line++; }
+                while ( line > stop ) { path.push_back ( grid->getVEdge(col,line-1) ); line--; }
+            }
+        }
+        assert ( (col == tCol) && (line == tLine) );
+
+        bool    crossesNet = false;
+        Vertex* vertex     = source;
+        for ( size_t iedge = 0 ; iedge+1 < path.size() ; iedge++ ) {
+            vertex = path[iedge]->getOpposite ( vertex );
+            if ( (vertex->getNetStamp() == _netStamp) && (vertex->getConnexID() != -1) ) {
+                crossesNet = true;
+                break;
+            }
+        }
+        if ( crossesNet ) continue;
+
+        int sourceID = source->getConnexID();
+        vertex = source;
+        for ( size_t iedge = 0 ; iedge < path.size() ; iedge++ ) {
+            path[iedge]->setConnexID ( sourceID );
+            path[iedge]->setNetStamp ( _netStamp );
+            vertex = path[iedge]->getOpposite ( vertex );
+            if ( vertex == target ) break;
+            vertex->setContact     ( NULL );
+            vertex->setConnexID    ( sourceID );
+            vertex->setNetStamp    ( _netStamp );
+            vertex->setDistance    ( (float)(HUGE_VAL) );
+            vertex->setPredecessor ( NULL );
+        }
+        if ( (target->getNetStamp() != _netStamp) || (target->getConnexID() == -1) ) {
+            target->setContact     ( NULL );
+            target->setConnexID    ( sourceID );
+            target->setNetStamp    ( _netStamp );
+            target->setDistance    ( (float)(HUGE_VAL) );
+            target->setPredecessor ( NULL );
+        }
+        return true;
+    }
+    return false;
+}
+
+FTree Graph::createFluteTree()
+// ***************************
 { 
     int  accuracy = 3;                         // accuracy for flute (by default 3)
     int  d        = _vertexes_to_route.size(); // degre du net, ie nombre de routingPads
-    int *x = new int [d];                      // x coordinates of the vertexes
-    int *y = new int [d];                      // y coordinates of the vertexes
-    FTree* flutetree = new FTree;              // the flute Steiner Tree
+    vector<int> x ( d );                       // x coordinates of the vertexes
+    vector<int> y ( d );                       // y coordinates of the vertexes
 
     //cout << "Net : " << _working_net << endl;
     // scans _working_net to find x,y coordinates and fill x, y and d
@@ -1545,7 +1818,8 @@ FTree* Graph::createFluteTree()
 
     assert ( d == cpt );
 
-    *flutetree = flute ( d, x, y, accuracy );
+    // The branches of the tree belong to _fluteScratch: valid until the next call.
+    FTree flutetree = flute_r ( d, &x[0], &y[0], accuracy, _fluteScratch );
     //printtree ( flutetree );
     //plottree ( flutetree );
     //cout << endl;
@@ -1558,16 +1832,16 @@ void Graph::UpdateEstimateCongestion ( bool create )
     if ( _vertexes_to_route.size() < 2 )
        return;
     //cerr << "Running FLUTE for net : " << _working_net << endl;
-    auto_ptr<FTree> flutetree ( createFluteTree() );
+    FTree flutetree = createFluteTree();
 
     //parcours des branches du FTree pour créer la congestion estimée
-    for ( int i = 0 ; i < 2*flutetree->deg-2 ; i++ ) {
-//        int sourceX = flutetree->branch[i].x;
-//        int sourceY = flutetree->branch[i].y;
-//        int targetX = flutetree->branch[flutetree->branch[i].n].x;
-//        int targetY = flutetree->branch[flutetree->branch[i].n].y;
-        Vertex* source = getVertex ( flutetree->branch[i].x                     , flutetree->branch[i].y );
-        Vertex* target = getVertex ( flutetree->branch[flutetree->branch[i].n].x, flutetree->branch[flutetree->branch[i].n].y );
+    for ( int i = 0 ; i < 2*flutetree.deg-2 ; i++ ) {
+//        int sourceX = flutetree.branch[i].x;
+//        int sourceY = flutetree.branch[i].y;
+//        int targetX = flutetree.branch[flutetree.branch[i].n].x;
+//        int targetY = flutetree.branch[flutetree.branch[i].n].y;
+        Vertex* source = getVertex ( flutetree.branch[i].x                     , flutetree.branch[i].y );
+        Vertex* target = getVertex ( flutetree.branch[flutetree.branch[i].n].x, flutetree.branch[flutetree.branch[i].n].y );
         assert ( source );
         assert ( target );
         //Si source et target alignée -> ajoute 1 a toutes les edges sur le chemin
@@ -1678,95 +1952,80 @@ void Graph::UpdateEstimateCongestion ( bool create )
 void Graph::UpdateMaxEstimateCongestion()
 // **************************************
 {
-    Vertex* currentVertex = _lowerLeftVertex;
-    while ( currentVertex ) {
-        Vertex* firstLineVertex = currentVertex;
-        while ( currentVertex ) {
-            Edge* hEdgeOut = currentVertex->getHEdgeOut();
+    // Lines of the grid are independant, the maximums are reduced per thread.
+    GridGraph* grid     = getGridGraph();
+    unsigned   xSize    = grid->getXSize();
+    unsigned   ySize    = grid->getYSize();
+    unsigned   maxOcc   = _maxOccupancy;
+    unsigned   maxXOcc  = _maxXOccupancy;
+    unsigned   maxYOcc  = _maxYOccupancy;
+    float      maxEst   = _maxEstimateOccupancy;
+    float      maxXEst  = _maxXEstimateOccupancy;
+    float      maxYEst  = _maxYEstimateOccupancy;
+
+#pragma omp parallel for schedule(static) reduction(max:maxOcc,maxXOcc,maxYOcc,maxEst,maxXEst,maxYEst)
+    for ( int line = 0 ; line < (int)ySize ; line++ ) {
+        for ( unsigned column = 0 ; column < xSize ; column++ ) {
             unsigned max     = 0;
             float    maxEsti = 0.0;
-            if ( hEdgeOut ) {
-                unsigned maxX     = hEdgeOut->getRealOccupancy();
-                float    maxXEsti = hEdgeOut->getEstimateOccupancy();
+            if ( column+1 < xSize ) {
+                size_t   index    = grid->getHEdgeIndex ( column, line );
+                unsigned maxX     = grid->getOccupancy ( index );
+                float    maxXEsti = grid->getEstimate  ( index );
                 max     += maxX;
                 maxEsti += maxXEsti;
-                if ( maxX > _maxXOccupancy )
-                    _maxXOccupancy = maxX;
-                if ( maxXEsti > _maxXEstimateOccupancy )
-                    _maxXEstimateOccupancy = maxXEsti;
+                if ( maxX > maxXOcc )
+                    maxXOcc = maxX;
+                if ( maxXEsti > maxXEst )
+                    maxXEst = maxXEsti;
             }
-            Edge* vEdgeOut = currentVertex->getVEdgeOut();
-            if ( vEdgeOut ) {
-                unsigned maxY     = vEdgeOut->getRealOccupancy();
-                float    maxYEsti = vEdgeOut->getEstimateOccupancy();
+            if ( (unsigned)line+1 < ySize ) {
+                size_t   index    = grid->getVEdgeIndex ( column, line );
+                unsigned maxY     = grid->getOccupancy ( index );
+                float    maxYEsti = grid->getEstimate  ( index );
                 max     += maxY;
                 maxEsti += maxYEsti;
-                if ( maxY > _maxYOccupancy )
-                    _maxYOccupancy = maxY;
-                if ( maxYEsti > _maxYEstimateOccupancy )
-                    _maxYEstimateOccupancy = maxYEsti;
+                if ( maxY > maxYOcc )
+                    maxYOcc = maxY;
+                if ( maxYEsti > maxYEst )
+                    maxYEst = maxYEsti;
             }
-            if ( max > _maxOccupancy )
-                _maxOccupancy = max;
-            if ( maxEsti > _maxEstimateOccupancy )
-                _maxEstimateOccupancy = maxEsti;
-
-            if ( hEdgeOut )
-                currentVertex = hEdgeOut->getOpposite ( currentVertex );
-            else
-                break;
+            if ( max > maxOcc )
+                maxOcc = max;
+            if ( maxEsti > maxEst )
+                maxEst = maxEsti;
         }
-        Edge* vEdgeOut = firstLineVertex->getVEdgeOut();
-        if ( vEdgeOut )
-            currentVertex = vEdgeOut->getOpposite ( firstLineVertex );
-        else
-            break;
     }
+
+    _maxOccupancy          = maxOcc;
+    _maxXOccupancy         = maxXOcc;
+    _maxYOccupancy         = maxYOcc;
+    _maxEstimateOccupancy  = maxEst;
+    _maxXEstimateOccupancy = maxXEst;
+    _maxYEstimateOccupancy = maxYEst;
 }
 
 
 Edge* Graph::getEdge ( unsigned col1, unsigned row1, unsigned col2, unsigned row2 )
 // ********************************************************************************
 {
-  Edge* edge = NULL;
+  GridGraph* grid = getGridGraph();
 
   if ( col1 == col2 ) {
     if ( row1 == row2 ) 
       throw Error ( "Graph::UpdateEdgeCapacity(): the two specified vertices must be different." );
-
-    Vertex* bottomVertex = NULL;
-    Vertex* topVertex    = NULL;
-
-    if ( ( row1 < row2 ) && ( row2 == row1 + 1 ) ) {
-      bottomVertex = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col1, row1) );
-      topVertex    = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col1, row2) );
-    } else if ( row1 == row2 + 1 ) {
-      bottomVertex = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col1, row2) );
-      topVertex    = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col1, row1) );
-    } else
+    if ( (row2 != row1 + 1) and (row1 != row2 + 1) )
       throw Error ( "Graph::UpdateEdgeCapacity(): the two specified vertices must be contiguous." );
 
-    edge = bottomVertex->getVEdgeOut();
-    assert ( edge->getOpposite(bottomVertex) == topVertex );
+    return grid->getVEdge ( col1, (row1 < row2) ? row1 : row2 );
   } else if ( row1 == row2 ) {
-    Vertex* leftVertex  = NULL;
-    Vertex* rightVertex = NULL;
-
-    if ( ( col1 < col2 ) && ( col2 == col1 + 1 ) ) {
-      leftVertex  = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col1, row1) );
-      rightVertex = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col2, row1) );
-    } else if ( col1 == col2 + 1 ) {
-      leftVertex  = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col2, row1) );
-      rightVertex = _matrixVertex->getVertex ( pair<unsigned int, unsigned int>(col1, row1) );
-    } else
+    if ( (col2 != col1 + 1) and (col1 != col2 + 1) )
       throw Error ( "Graph::UpdateEdgeCapacity(): the two specified vertices must be contiguous." );
 
-    edge = leftVertex->getHEdgeOut();
-    assert ( edge->getOpposite(leftVertex) == rightVertex );
-  } else
-    throw Error ( "Graph::UpdateEdgeCapacity(): the two specified vertices must be vertically or horizontally aligned." );
+    return grid->getHEdge ( (col1 < col2) ? col1 : col2, row1 );
+  }
 
-  return edge;
+  throw Error ( "Graph::UpdateEdgeCapacity(): the two specified vertices must be vertically or horizontally aligned." );
 }
 
 
@@ -1964,33 +2223,46 @@ unsigned Graph::analyseRouting ( set<Segment*>& segmentsToUnroute )
     unsigned wirelength = 0;
     unsigned viaWirelength = 0;
     map<Segment*, segmentStat> segmentsMap;
-    for ( unsigned i = 0 ; i < _all_edges.size() ; i++ ) 
+    GridGraph* grid      = getGridGraph();
+    int        edgesSize = (int)grid->getEdgesSize();
+    // Edges are processed by blocks, each thread builds the records of the
+    // segments crossing its block, they are summed up afterwards.
+#pragma omp parallel reduction(+:nbEdgesTot,nbEdgesOv,overflow) reduction(max:maxOv)
     {
-        Edge* edge = _all_edges[i];
-        nbEdgesTot++;
-        if ( edge->isCongested() ) {
-            nbEdgesOv++;
-            unsigned edgeOv = 2*edge->getOverflow();
-            overflow += edgeOv;
-            maxOv = edgeOv > maxOv ? edgeOv : maxOv;
-            edge->addSubEstimateOccupancy ( HISTORIC_INC, true ); // add historic cost for each overflowed edge
-        }
-        forEach ( Segment*, segment, edge->getSegments() ) {
-            map<Segment*, segmentStat>::iterator it = segmentsMap.find(*segment);
-            if ( it != segmentsMap.end() ) {
-                (*it).second.incNbTot();
-                if ( edge->isCongested() ) {
-                    (*it).second.incNbDep();
-                    (*it).second.incSumOv(edge->getOverflow());
-                }
+        map<Segment*, segmentStat> blockMap;
+#pragma omp for schedule(static)
+        for ( int i = 0 ; i < edgesSize ; i++ ) {
+            if ( !grid->getEdge(i) ) continue;
+            nbEdgesTot++;
+            unsigned edgeOv = grid->getOverflow(i);
+            if ( edgeOv ) {
+                nbEdgesOv++;
+                overflow += 2*edgeOv;
+                maxOv = 2*edgeOv > maxOv ? 2*edgeOv : maxOv;
+                grid->addEstimate ( i, HISTORIC_INC ); // add historic cost for each overflowed edge
             }
-            else {
-                if ( edge->isCongested() )
-                    segmentsMap[*segment]=segmentStat(1,1,edge->getOverflow());
+            const vector<Segment*>& segments = grid->getSegments(i);
+            for ( size_t j = 0 ; j < segments.size() ; j++ ) {
+                map<Segment*, segmentStat>::iterator it = blockMap.find(segments[j]);
+                if ( it != blockMap.end() ) {
+                    (*it).second.incNbTot();
+                    if ( edgeOv ) {
+                        (*it).second.incNbDep();
+                        (*it).second.incSumOv(edgeOv);
+                    }
+                }
                 else
-                    segmentsMap[*segment]=segmentStat(0,1,0);
+                    blockMap[segments[j]] = segmentStat(edgeOv ? 1 : 0, 1, edgeOv);
             }
         }
+#pragma omp critical
+        for ( map<Segment*, segmentStat>::iterator it = blockMap.begin() ; it != blockMap.end() ; it++ ) {
+            map<Segment*, segmentStat>::iterator found = segmentsMap.find((*it).first);
+            if ( found != segmentsMap.end() )
+                (*found).second.merge((*it).second);
+            else
+                segmentsMap.insert(*it);
+        }
     }
 
     unsigned nbDep = 0;
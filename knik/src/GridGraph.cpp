@@ -0,0 +1,62 @@
+#include "knik/GridGraph.h"
+
+namespace Knik {
+
+GridGraph::GridGraph ( unsigned xSize, unsigned ySize )
+// ****************************************************
+    : _xSize       (xSize)
+    , _ySize       (ySize)
+    , _vertexes    ((size_t)xSize*ySize, NULL)
+    , _edges       ()
+    , _capacities  ()
+    , _occupancies ()
+    , _estimates   ()
+    , _costs       ()
+    , _connexIDs   ()
+    , _netStamps   ()
+    , _segments    ()
+{
+    size_t edgesSize = getHEdgesSize() + ((ySize) ? (size_t)xSize*(ySize-1) : 0);
+
+    _edges      .assign ( edgesSize, NULL );
+    _capacities .assign ( edgesSize, 0    );
+    _occupancies.assign ( edgesSize, 0    );
+    _estimates  .assign ( edgesSize, 0.0  );
+    _costs      .assign ( edgesSize, 0.0  );
+    _connexIDs  .assign ( edgesSize, -1   );
+    _netStamps  .assign ( edgesSize, 0    );
+    _segments   .resize ( edgesSize );
+}
+
+void GridGraph::setEdge ( size_t index, Edge* edge, unsigned capacity )
+// ********************************************************************
+{
+    _edges      [index] = edge;
+    _capacities [index] = capacity;
+    _occupancies[index] = 0;
+    _estimates  [index] = 0.0;
+    _costs      [index] = 0.0;
+    _connexIDs  [index] = -1;
+    _netStamps  [index] = 0;
+    _segments   [index].clear();
+}
+
+size_t GridGraph::getMemorySize () const
+// *************************************
+{
+    size_t size = sizeof(GridGraph)
+                + _vertexes   .capacity() * sizeof(Vertex*)
+                + _edges      .capacity() * sizeof(Edge*)
+                + _capacities .capacity() * sizeof(unsigned)
+                + _occupancies.capacity() * sizeof(unsigned)
+                + _estimates  .capacity() * sizeof(float)
+                + _costs      .capacity() * sizeof(float)
+                + _connexIDs  .capacity() * sizeof(int)
+                + _netStamps  .capacity() * sizeof(unsigned)
+                + _segments   .capacity() * sizeof(vector<Segment*>);
+    for ( size_t i = 0 ; i < _segments.size() ; i++ )
+        size += _segments[i].capacity() * sizeof(Segment*);
+    return size;
+}
+
+} // namespace Knik
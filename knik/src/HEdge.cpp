@@ -4,50 +4,19 @@
 
 namespace Knik {
 
-HEdge::HEdge ( Vertex* from, Vertex* to )
-// **************************************
-    : Inherit (from, to)
+HEdge::HEdge ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity )
+// ****************************************************************************************
+    : Inherit (grid, index, from, to, capacity)
 {
-  DbU::Unit thickness  = DbU::lambda( (_realOccupancy>_capacity)?5.0:2.5 );
-
-  Point fromPoint = getFrom()->getPosition();
-  Point toPoint = getTo()->getPosition();
-
-  _boundingBox = Box ( fromPoint.getX(), fromPoint.getY() - thickness, toPoint.getX(), toPoint.getY() + thickness );
-}
-
-HEdge::HEdge ( Vertex* from, Vertex* to, unsigned capacity )
-// *********************************************************
-    : Inherit (from, to, capacity)
-{
-  DbU::Unit thickness  = DbU::lambda( (_realOccupancy>_capacity)?5.0:2.5 );
-
-  Point fromPoint = getFrom()->getPosition();
-  Point toPoint = getTo()->getPosition();
-
-  _boundingBox = Box ( fromPoint.getX(), fromPoint.getY() - thickness, toPoint.getX(), toPoint.getY() + thickness );
-}
-
-HEdge* HEdge::create ( Vertex* from, Vertex* to )
-// **********************************************
-{
-    if ( !from || !to )
-        throw Error ("HEdge::create(): cannot create HEdge with NULL vertex.");
-
-    HEdge* hEdge = new HEdge ( from, to );
-
-    hEdge->_postCreate();
-
-    return hEdge;
 }
 
-HEdge* HEdge::create ( Vertex* from, Vertex* to, unsigned capacity )
-// *****************************************************************
+HEdge* HEdge::create ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity )
+// ************************************************************************************************
 {
     if ( !from || !to )
         throw Error ("HEdge::create(): cannot create HEdge with NULL vertex.");
 
-    HEdge* hEdge = new HEdge ( from, to, capacity );
+    HEdge* hEdge = new HEdge ( grid, index, from, to, capacity );
 
     hEdge->_postCreate();
 
@@ -68,7 +37,7 @@ HEdge::~HEdge()
 Box  HEdge::computeBoundingBox() const
 // ***********************************
 {
-  DbU::Unit thickness  = DbU::lambda( (_realOccupancy>_capacity)?2.5:2.5 );
+  DbU::Unit thickness  = DbU::lambda( 2.5 );
 
   Point fromPoint = getFrom()->getPosition();
   Point toPoint = getTo()->getPosition();
@@ -15,6 +15,7 @@
 
 
 #include <climits>
+#include <algorithm>
 #include "hurricane/Warning.h"
 #include "hurricane/Property.h"
 #include "hurricane/NetRoutingProperty.h"
@@ -37,6 +38,7 @@
 #include "knik/Edge.h"
 #include "knik/Vertex.h"
 #include "knik/Graph.h"
+#include "knik/CongestionMap.h"
 #include "knik/RoutingGrid.h"
 #include "knik/NetExtension.h"
 #include "knik/KnikEngine.h"
@@ -64,7 +66,11 @@ namespace Knik {
   float         __edge_cost__;
   bool          __initialized__;
   
-  extern bool   __ripupMode__;
+  extern bool      __ripupMode__;
+  extern unsigned  countDijkstra;
+  extern unsigned  countPatternNets;
+  extern unsigned  countPatternBranches;
+  extern unsigned  countPatternFallbacks;
 
   const Name KnikEngine::_toolName           = "Knik::KnikEngine";
   size_t     KnikEngine::_hEdgeReservedLocal = 0;
@@ -133,7 +139,8 @@ void KnikEngine::_postCreate()
 {
     Inherit::_postCreate();
 
-    // For Flute : readLUT to be able to use POWV9.dat & POST9.dat
+    // For Flute : readLUT to be able to use POWV9.dat & POST9.dat, when
+    // they are not compiled in.
     readLUT();
 
     return;
@@ -382,6 +389,23 @@ string KnikEngine::_getSolutionName() const
   return getString(_cell->getName()) + ".kgr";
 }
 
+void KnikEngine::saveCongestionMap ( const string& fileName )
+// **********************************************************
+{
+    if ( !_routingGraph || !_routingGraph->getGridGraph() )
+        throw Error ( "KnikEngine::saveCongestionMap(): No routing graph to save the congestion of." );
+
+    string saveFileName = fileName;
+    if ( saveFileName.empty() )
+      saveFileName = getString(_cell->getName()) + ".kcm";
+
+    CongestionMap congestionMap;
+    congestionMap.build ( _routingGraph->getGridGraph() );
+    congestionMap.printStatistics ();
+    if ( !congestionMap.save ( saveFileName ) )
+        throw Error ( "KnikEngine::saveCongestionMap(): Cannot write congestion map <%s>.", saveFileName.c_str() );
+}
+
 void KnikEngine::saveSolution ( const string& fileName )
 // *****************************************************
 {
@@ -602,7 +626,7 @@ void KnikEngine::unrouteOvSegments()
      UpdateSession::open();
      _timer.resume();
      do {
-         set<Contact*> contacts;
+         vector<Contact*> contacts;
          while ( !_segmentsToUnroute.empty() ) {  // on parcourt tous les segments a derouter
              Segment* segment = (*_segmentsToUnroute.begin());
              assert(segment);
@@ -611,8 +635,8 @@ void KnikEngine::unrouteOvSegments()
              if ( !dynamic_cast<Contact*>(segment->getTarget()) )
                  throw Error ( "unroute segment : segment's target is not a contact !" );
              // on insere les contacts source et target dans le set
-             contacts.insert ( static_cast<Contact*>(segment->getSource()) );
-             contacts.insert ( static_cast<Contact*>(segment->getTarget()) );
+             contacts.push_back ( static_cast<Contact*>(segment->getSource()) );
+             contacts.push_back ( static_cast<Contact*>(segment->getTarget()) );
              _segmentsToUnroute.erase ( segment );  // suppression du segment dans le set
              _routingGraph->removeSegment ( segment ); // il faut mettre a jour les occupations des edges dans le graph !
              countSegments++;
@@ -620,7 +644,10 @@ void KnikEngine::unrouteOvSegments()
              segment->getTargetHook()->detach();
              segment->destroy(); // delete du segment
          }
-         for ( set<Contact*>::iterator cit = contacts.begin(); cit != contacts.end() ; cit++ ) { // pour chacun des contacts du set
+         // sorted vector rather than a set: same visiting order, without a node per contact
+         sort ( contacts.begin(), contacts.end() );
+         contacts.erase ( unique ( contacts.begin(), contacts.end() ), contacts.end() );
+         for ( vector<Contact*>::iterator cit = contacts.begin(); cit != contacts.end() ; cit++ ) { // pour chacun des contacts du set
              Contact* contact = (*cit);
              Vertex* contactVertex = _routingGraph->getVertex(contact->getCenter());
              Hook* contactHook = contact->getBodyHook();
@@ -862,119 +889,48 @@ void KnikEngine::computeOverflow()
 // *******************************
 {
   //cmess1 << "     o  Computing Statistics" << endl;
-    Vertex* currentVertex = _routingGraph->getLowerLeftVertex();
-    int   nbEdgesTotal = 0;
-    int   nbEdgesOver  = 0;
+    GridGraph* grid         = _routingGraph->getGridGraph();
+    int        edgesSize    = (int)grid->getEdgesSize();
+    int        nbEdgesTotal = 0;
+    int        nbEdgesOver  = 0;
 
     unsigned overflow  = 0;
     unsigned maxOver   = 0;
     //float maxOver      = 0;
     //float averageOver  = 0;
-    while ( currentVertex ) {
-        Vertex* firstLineVertex = currentVertex;
-        while ( currentVertex ) {
-            Edge* hEdgeOut = currentVertex->getHEdgeOut();
-            if ( hEdgeOut ) {
-                nbEdgesTotal++;
-                int ov = 2*(hEdgeOut->getRealOccupancy() - hEdgeOut->getCapacity()); // 2 = minimum spacing + minimum width
-                if ( ov > 0 ) {
-                    nbEdgesOver++;
-                    overflow += ov;
-                    maxOver = (unsigned)ov > maxOver ? ov : maxOver;
-                }
-                for_each_segment ( segment, hEdgeOut->getSegments() ) {
-                    map<Segment*,SegRecord>::iterator ssit = _segmentOverEdges.find ( segment );
-                    SegRecord record;
-                    if ( ssit != _segmentOverEdges.end() )
-                        record = (*ssit).second;
-                    else
-                        record = SegRecord();
-
-                    record.incNbTotEdges();
-                    if ( ov > 0 ) {
-                        record.incNbOvEdges();
-                        record.incSumOv ( ov );
-                        record.UpdateMaxOv ( ov );
-                    }
-                    end_for;
-                }
-            }
-            if ( Edge* vEdgeOut = currentVertex->getVEdgeOut() ) {
-                nbEdgesTotal++;
-                int ov = 2*(vEdgeOut->getRealOccupancy() - vEdgeOut->getCapacity());
-                if ( ov > 0 ) {
-                    nbEdgesOver++;
-                    overflow += ov;
-                    maxOver = (unsigned)ov > maxOver ? ov : maxOver;
-                }
-                for_each_segment ( segment, vEdgeOut->getSegments() ) {
-                    map<Segment*,SegRecord>::iterator ssit = _segmentOverEdges.find ( segment );
-                    SegRecord record;
-                    if ( ssit != _segmentOverEdges.end() )
-                        record = (*ssit).second;
-                    else
-                        record = SegRecord();
-
-                    record.incNbTotEdges();
-                    if ( ov > 0 ) {
-                        record.incNbOvEdges();
-                        record.incSumOv ( ov );
-                        record.UpdateMaxOv ( ov );
-                    }
-                    end_for;
-                }
-            }
-
-            if ( hEdgeOut )
-                currentVertex = hEdgeOut->getOpposite ( currentVertex );
-            else
-                break;
+#pragma omp parallel for schedule(static) reduction(+:nbEdgesTotal,nbEdgesOver,overflow) reduction(max:maxOver)
+    for ( int i = 0 ; i < edgesSize ; i++ ) {
+        if ( !grid->getEdge(i) ) continue;
+        nbEdgesTotal++;
+        unsigned ov = 2*grid->getOverflow(i); // 2 = minimum spacing + minimum width
+        if ( ov ) {
+            nbEdgesOver++;
+            overflow += ov;
+            maxOver = ov > maxOver ? ov : maxOver;
         }
-        Edge* vEdgeOut = firstLineVertex->getVEdgeOut();
-        if ( vEdgeOut )
-            currentVertex = vEdgeOut->getOpposite ( firstLineVertex );
-        else
-            break;
     }
     //cmess2 << "        - first skimming through edges done (overflow computed)" << endl;
     //averageOver = nbEdgesOver == 0 ? 0 : averageOver / (float)nbEdgesOver;
     
     // Now we've got the max we can print more detailed statistics about edges overflow
     //    except if there is no overflow...
+    // Each thread fills its own histogram, they are summed up afterwards.
     vector<unsigned> ovEdgesStats;
     if ( maxOver ) {
-        Vertex* currentVertex = _routingGraph->getLowerLeftVertex();
         unsigned maxOvIdx = maxOver / (int)(10);
         ovEdgesStats.resize(maxOvIdx+1);
-        while ( currentVertex ) {
-            Vertex* firstLineVertex = currentVertex;
-            while ( currentVertex ) {
-                Edge* hEdgeOut = currentVertex->getHEdgeOut();
-                if ( hEdgeOut ) {
-                    int ov = 2*(hEdgeOut->getRealOccupancy() - hEdgeOut->getCapacity()); // 2 = minimum sapcing + minimum width
-                    if ( ov > 0 ) {
-                        unsigned ovIdx = ov / int(10);
-                        ovEdgesStats[ovIdx]++;
-                    }
-                }
-                if ( Edge* vEdgeOut = currentVertex->getVEdgeOut() ) {
-                    int ov = 2*(vEdgeOut->getRealOccupancy() - vEdgeOut->getCapacity());
-                    if ( ov > 0 ) {
-                        unsigned ovIdx = ov / int(10);
-                        ovEdgesStats[ovIdx]++;
-                    }
-                }
-
-                if ( hEdgeOut )
-                    currentVertex = hEdgeOut->getOpposite ( currentVertex );
-                else
-                    break;
+#pragma omp parallel
+        {
+            vector<unsigned> blockStats ( maxOvIdx+1, 0 );
+#pragma omp for schedule(static)
+            for ( int i = 0 ; i < edgesSize ; i++ ) {
+                unsigned ov = 2*grid->getOverflow(i);
+                if ( ov )
+                    blockStats[ov / 10]++;
             }
-            Edge* vEdgeOut = firstLineVertex->getVEdgeOut();
-            if ( vEdgeOut )
-                currentVertex = vEdgeOut->getOpposite ( firstLineVertex );
-            else
-                break;
+#pragma omp critical
+            for ( unsigned i = 0 ; i <= maxOvIdx ; i++ )
+                ovEdgesStats[i] += blockStats[i];
         }
       //cmess2 << "        - second skimming through edges done (overflow details)" << endl;
     }
@@ -1090,6 +1046,11 @@ void KnikEngine::Route( const map<Name,Net*>& excludedNets )
     //_routingGraph->setNetStamp(1); // Maybe NetStamp should not be initialized here !
     // Be aware that initializingthe NetStamp in the construction of the routingGraph, might be a bad idea, if a lotof rerouting processes are run, it may overpass the unsigne limit (really ?)
 
+    countDijkstra         = 0;
+    countPatternNets      = 0;
+    countPatternBranches  = 0;
+    countPatternFallbacks = 0;
+
     Name nameDebug ("ck_dpt");
     unsigned size = _nets_to_route.size(); 
     for ( unsigned i = 0 ; i < size ; i++ ) {
@@ -1106,7 +1067,10 @@ void KnikEngine::Route( const map<Name,Net*>& excludedNets )
                 //_routingGraph->Monotonic();
                 //break;
             default:
-                _routingGraph->Dijkstra();
+                // Pattern routing first, the maze router only completes
+                // the connexions it has left (estimate already updated).
+                if ( !_routingGraph->PatternRoute() )
+                    _routingGraph->Dijkstra ( false );
                 break;
         }
         
@@ -1119,6 +1083,10 @@ void KnikEngine::Route( const map<Name,Net*>& excludedNets )
     }
     _timer.suspend();
 
+    cmess2 << "                     Pattern routed nets:" << countPatternNets
+           << "  connexions:" << countPatternBranches
+           << "  left to maze:" << countPatternFallbacks
+           << "  Dijkstra calls:" << countDijkstra << endl;
     cmess2 << "                     Elapsed time: " << _timer.getCombTime() 
            << "  Memory: " << Timer::getStringMemory(_timer.getIncrease()) << endl;
 
@@ -1185,6 +1153,8 @@ bool KnikEngine::analyseRouting()
     //    cmess1 << _nets_to_route[i]._net->getName() << "|";
     //cmess1 << endl;
 
+    addMeasure<unsigned long long> ( getCell(), "knikOv", overflow, 10 );
+
     _timer.suspend();
     // cmess1 << "        + Done in " << _timer.getCombTime() 
     //        << "s [+" << Timer::getStringMemory(_timer.getIncrease()) << "]." << endl;
@@ -26,6 +26,7 @@ MatrixVertex::MatrixVertex ( Graph* routingGraph )
     , _tileHeight(0)
     , _boundingBox(0,0,1,1)
     , _routingGraph(routingGraph)
+    , _grid(NULL)
 {
 }
 
@@ -52,6 +53,7 @@ void MatrixVertex::destroy()
 void MatrixVertex::_preDestroy()
 // ****************************
 {
+    delete _grid;
 }
 
 //void MatrixVertex::createXRegular ( RoutingGrid* routingGrid )
@@ -104,36 +106,25 @@ Vertex* MatrixVertex::createRegularMatrix ( RoutingGrid* routingGrid )
     DbU::Unit halfWidth  = _tileWidth / 2;
     DbU::Unit halfHeight = _tileHeight / 2;
 
-    // On cree les vecteurs de vertex en meme temps que les vertex et aussi les edges !
+    // On cree les vertex en meme temps que les edges !
+    _grid = new GridGraph ( _nbXTiles, _nbYTiles );
     for ( unsigned j = 0 ; j < _nbYTiles ; j++ ) {
-        vector<Vertex*> vect;
         for ( unsigned i = 0 ; i < _nbXTiles ; i++ ) {
           Point position ( _boundingBox.getXMin()+(i*_tileWidth)+halfWidth, _boundingBox.getYMin()+(j*_tileHeight)+halfHeight );
             // on cree le vertex
             Vertex* vertex = _routingGraph->createVertex ( position, halfWidth, halfHeight );
             assert ( vertex );
             // on l'ajoute dans la matrice
-            vect.push_back ( vertex );
-            // si i > 0 alors on peut creer une edge horizontale entre matrix[i-1][j] et matrix[i][j] c'est a dire vect[i-1] et vect[i]
-            if ( i > 0 )  { 
-                Vertex* from = vect[i-1];
-                assert(from);
-                Vertex* to = vect[i];
-                assert(to);
-                _routingGraph->createHEdge ( from, to );
-            }
-            // si j > 0 alors on peut creer une edge verticale entre matrix[i][j-1] et matrix[i][j] c'est a dire _matrix[j-1][i] et vect[i]
-            if ( j > 0 ) { //  _matrix est un vecteur de vecteur represantant les lignes -> _matrix[ligne][colonne]
-                Vertex* from = _matrix[j-1][i];
-                assert(from);
-                Vertex* to = vect[i];
-                assert(to);
-                _routingGraph->createVEdge ( from, to );
-            }
+            _grid->setVertex ( i, j, vertex );
+            // si i > 0 alors on peut creer une edge horizontale entre (i-1,j) et (i,j)
+            if ( i > 0 )
+                _routingGraph->createHEdge ( i-1, j );
+            // si j > 0 alors on peut creer une edge verticale entre (i,j-1) et (i,j)
+            if ( j > 0 )
+                _routingGraph->createVEdge ( i, j-1 );
         }
-        _matrix.push_back ( vect );
     }
-    return _matrix[0][0];
+    return _grid->getVertex ( 0, 0 );
 }
 
 Vertex* MatrixVertex::createRegularMatrix ()
@@ -170,11 +161,11 @@ Vertex* MatrixVertex::createRegularMatrix ()
 //          << "    - latestTileWidth  : " << _latestTileWidth  << endl
 //          << "    - latestTileHeight : " << _latestTileHeight << endl;
 
-    // On cree les vecteurs de vertex en meme temps que les vertex et aussi les edges !
+    // On cree les vertex en meme temps que les edges !
+    _grid = new GridGraph ( _nbXTiles, _nbYTiles );
     size_t hreserved = KnikEngine::get( cell )->getHEdgeReservedLocal();
     size_t vreserved = KnikEngine::get( cell )->getVEdgeReservedLocal();
     for ( unsigned j = 0 ; j < _nbYTiles ; j++ ) {
-        vector<Vertex*> vect;
         for ( unsigned i = 0 ; i < _nbXTiles ; i++ ) {
             DbU::Unit halfWidth  = (i == _nbXTiles - 1)?_latestTileWidth/2:_tileWidth/2;
             DbU::Unit halfHeight = (j == _nbYTiles - 1)?_latestTileHeight/2:_tileHeight/2;
@@ -184,29 +175,18 @@ Vertex* MatrixVertex::createRegularMatrix ()
             assert ( vertex );
             //cerr << ". .. " << vertex << endl;
             // on l'ajoute dans la matrice
-            vect.push_back ( vertex );
-            // si i > 0 alors on peut creer une edge horizontale entre matrix[i-1][j] et matrix[i][j] c'est a dire vect[i-1] et vect[i]
-            if ( i > 0 )  { 
-                Vertex* from = vect[i-1];
-                assert(from);
-                Vertex* to = vect[i];
-                assert(to);
-                _routingGraph->createHEdge ( from, to, hreserved );
-            }
-            // si j > 0 alors on peut creer une edge verticale entre matrix[i][j-1] et matrix[i][j] c'est a dire _matrix[j-1][i] et vect[i]
-            if ( j > 0 ) { //  _matrix est un vecteur de vecteur represantant les lignes -> _matrix[ligne][colonne]
-                Vertex* from = _matrix[j-1][i];
-                assert(from);
-                Vertex* to = vect[i];
-                assert(to);
-                _routingGraph->createVEdge ( from, to, vreserved );
-            }
+            _grid->setVertex ( i, j, vertex );
+            // si i > 0 alors on peut creer une edge horizontale entre (i-1,j) et (i,j)
+            if ( i > 0 )
+                _routingGraph->createHEdge ( i-1, j, hreserved );
+            // si j > 0 alors on peut creer une edge verticale entre (i,j-1) et (i,j)
+            if ( j > 0 )
+                _routingGraph->createVEdge ( i, j-1, vreserved );
         }
-        _matrix.push_back ( vect );
     }
     //cerr << "---------------------------" << endl;
     //print();
-    return _matrix[0][0];
+    return _grid->getVertex ( 0, 0 );
 }
 
 //void MatrixVertex::createXIrregular ( NimbusEngine* nimbus )
@@ -276,7 +256,7 @@ Vertex* MatrixVertex::createRegularMatrix ()
 void MatrixVertex::setVertex ( pair<unsigned int,unsigned int> indexes, Vertex* vertex )
 // *************************************************************************************   
 {
-    _matrix[indexes.second][indexes.first] = vertex;
+    _grid->setVertex ( indexes.first, indexes.second, vertex );
 }
 
 void MatrixVertex::setVertex ( Point point, Vertex* vertex )
@@ -374,7 +354,7 @@ pair<unsigned int,unsigned int> MatrixVertex::getIJ ( const Point& point )
 Vertex* MatrixVertex::getVertex ( pair<unsigned int,unsigned int> indexes )
 // ************************************************************************
 {
-    return _matrix[indexes.second][indexes.first];
+    return _grid->getVertex ( indexes.first, indexes.second );
 }
 
 Vertex* MatrixVertex::getVertex ( Point point )
@@ -410,7 +390,7 @@ Vertex* MatrixVertex::getVertex ( DbU::Unit x, DbU::Unit y )
 Vertex* MatrixVertex::getVertexFromIndexes ( unsigned lineIdx, unsigned columnIdx )
 // ********************************************************************************
 {
-    return _matrix[lineIdx][columnIdx];
+    return _grid->getVertex ( columnIdx, lineIdx );
 }
 
 void MatrixVertex::print()
@@ -436,7 +416,7 @@ void MatrixVertex::print()
     //cerr << ";" << endl;
     for ( unsigned j = 0 ; j < _nbYTiles ; j++ )
         for ( unsigned i = 0 ; i < _nbXTiles ; i++ )
-            cerr << i << "," << j << " " << _matrix[j][i] << endl;
+            cerr << i << "," << j << " " << _grid->getVertex(i,j) << endl;
 }
 
 } // end namespace
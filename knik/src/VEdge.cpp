@@ -4,50 +4,19 @@
 
 namespace Knik {
 
-VEdge::VEdge ( Vertex* from, Vertex* to )
-// **************************************
-    : Inherit (from, to)
+VEdge::VEdge ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity )
+// ****************************************************************************************
+    : Inherit (grid, index, from, to, capacity)
 {
-  DbU::Unit thickness  = DbU::lambda( (_realOccupancy>_capacity)?5.0:2.5 );
-
-  Point fromPoint = getFrom()->getPosition();
-  Point toPoint = getTo()->getPosition();
-
-  _boundingBox = Box ( fromPoint.getX() - thickness, fromPoint.getY(), toPoint.getX() + thickness, toPoint.getY() );
-}
-
-VEdge::VEdge ( Vertex* from, Vertex* to, unsigned capacity )
-// *********************************************************
-    : Inherit (from, to, capacity)
-{
-  DbU::Unit thickness  = DbU::lambda( (_realOccupancy>_capacity)?5.0:2.5 );
-
-  Point fromPoint = getFrom()->getPosition();
-  Point toPoint = getTo()->getPosition();
-
-  _boundingBox = Box ( fromPoint.getX() - thickness, fromPoint.getY(), toPoint.getX() + thickness, toPoint.getY() );
-}
-
-VEdge* VEdge::create ( Vertex* from, Vertex* to )
-// **********************************************
-{
-    if ( !from || !to )
-        throw Error ("VEdge::create(): cannot create VEdge with NULL vertex.");
-
-    VEdge* vEdge = new VEdge ( from, to );
-
-    vEdge->_postCreate();
-
-    return vEdge;
 }
 
-VEdge* VEdge::create ( Vertex* from, Vertex* to, unsigned capacity )
-// *****************************************************************
+VEdge* VEdge::create ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity )
+// ************************************************************************************************
 {
     if ( !from || !to )
         throw Error ("VEdge::create(): cannot create VEdge with NULL vertex.");
 
-    VEdge* vEdge = new VEdge ( from, to, capacity );
+    VEdge* vEdge = new VEdge ( grid, index, from, to, capacity );
 
     vEdge->_postCreate();
 
@@ -68,7 +37,7 @@ VEdge::~VEdge()
 Box VEdge::computeBoundingBox() const
 // **********************************
 {
-    DbU::Unit thickness  = DbU::lambda( (_realOccupancy>_capacity)?2.5:2.5 );
+    DbU::Unit thickness  = DbU::lambda( 2.5 );
 
     Point fromPoint = getFrom()->getPosition();
     Point toPoint = getTo()->getPosition();
@@ -6,38 +6,6 @@
 #include "knik/Edge.h"
 #include "knik/Graph.h"
 
-namespace {
-using namespace Knik;
-struct EdgeToYComp : public binary_function<const Edge*, const Edge*, bool> { 
-public:
-    bool operator() ( Edge* edge1, Edge* edge2 ) const
-    {
-        return ( edge1->getTo()->getY() < edge2->getTo()->getY() ); 
-    }
-};
-struct EdgeToXComp : public binary_function<const Edge*, const Edge*, bool> { 
-public:
-    bool operator() ( Edge* edge1, Edge* edge2 ) const
-    {
-        return ( edge1->getTo()->getX() > edge2->getTo()->getX() ); 
-    }
-};
-struct EdgeFromYComp : public binary_function<const Edge*, const Edge*, bool> { 
-public:
-    bool operator() ( Edge* edge1, Edge* edge2 ) const
-    {
-        return ( edge1->getFrom()->getY() > edge2->getFrom()->getY() ); 
-    }
-};
-struct EdgeFromXComp : public binary_function<const Edge*, const Edge*, bool> { 
-public:
-    bool operator() ( Edge* edge1, Edge* edge2 ) const
-    {
-        return ( edge1->getFrom()->getX() <  edge2->getFrom()->getX() ); 
-    }
-};
-}
-
 namespace Knik {
 
 extern unsigned __congestion__;
@@ -106,6 +74,7 @@ Vertex::Vertex ( Graph* routingGraph, Point position, DbU::Unit halfWidth, DbU::
     , _netStamp (0)
     , _halfWidth  (halfWidth)
     , _halfHeight (halfHeight)
+    , _flags (0)
 {
     _firstEdges[0] = NULL;
     _firstEdges[1] = NULL;
@@ -162,72 +131,6 @@ void Vertex::attachToLocalRing ( Component* component )
     //setLocalRingHook ( hook );
 }
 
-void Vertex::sortEdges()
-// *********************
-{
-    vector<Edge*> hEdgesOut;
-    vector<Edge*> vEdgesOut;
-    vector<Edge*> hEdgesIn;
-    vector<Edge*> vEdgesIn;
-
-    Edge* currentEdge;
-    //ltracein(425);
-    if ( (currentEdge = getHEdgeOut()) ) {  // si pas de HEdgeOut : rien a faire ^^
-        while ( currentEdge ) {
-            //ltrace(425) << "Pushing_back edge " << getString(currentEdge) << endl;
-            hEdgesOut.push_back ( currentEdge );
-            currentEdge = currentEdge->getNextFrom();
-        }
-        //ltrace(425) << "sorting vector..." << endl;
-        sort ( hEdgesOut.begin(), hEdgesOut.end(), EdgeToYComp() );
-        //ltrace(425) << "setting " << getString(hEdgesOut[0]) << " as hEdgeOut for vertex " << getString(this) << endl;
-        setHEdgeOut ( hEdgesOut[0] );
-        for ( unsigned i = 1 ; i < hEdgesOut.size() ; i++ ) {
-            //ltrace(425) << "next : " << getString(hEdgesOut[i]) << endl;
-            hEdgesOut[i-1]->setNextFrom ( hEdgesOut[i] );
-        }
-        hEdgesOut[hEdgesOut.size()-1]->setNextFrom ( NULL ); // si jamais avant en milieu de chaine ...
-    }
-    //ltraceout(425);
-    if ( (currentEdge = getVEdgeOut()) ) {
-        while ( currentEdge ) {
-            vEdgesOut.push_back ( currentEdge );
-            currentEdge = currentEdge->getNextFrom();
-        }
-        sort ( vEdgesOut.begin(), vEdgesOut.end(), EdgeToXComp() );
-        setVEdgeOut ( vEdgesOut[0]);
-        for ( unsigned i = 1 ; i < vEdgesOut.size() ; i++ ) {
-            vEdgesOut[i-1]->setNextFrom ( vEdgesOut[i] );
-        }
-        vEdgesOut[vEdgesOut.size()-1]->setNextFrom ( NULL );
-    }
-    if ( (currentEdge = getHEdgeIn()) ) {
-        while ( currentEdge ) {
-            hEdgesIn.push_back ( currentEdge );
-            currentEdge = currentEdge->getNextTo();
-        }
-        sort ( hEdgesIn.begin(), hEdgesIn.end(), EdgeFromYComp() );
-        setHEdgeIn ( hEdgesIn[0] );
-        for ( unsigned i = 1 ; i < hEdgesIn.size() ; i++ ) {
-            hEdgesIn[i-1]->setNextTo ( hEdgesIn[i] );
-        }
-        hEdgesIn[hEdgesIn.size()-1]->setNextTo ( NULL );
-    }
-    if ( (currentEdge = getVEdgeIn()) ) {
-        while ( currentEdge ) {
-            vEdgesIn.push_back ( currentEdge );
-            currentEdge = currentEdge->getNextTo();
-        }
-        sort ( vEdgesIn.begin(), vEdgesIn.end(), EdgeFromXComp() );
-        setVEdgeIn ( vEdgesIn[0] );
-        for ( unsigned i = 1 ; i < vEdgesIn.size() ; i++ ) {
-            vEdgesIn[i-1]->setNextTo ( vEdgesIn[i] );
-        }
-        vEdgesIn[vEdgesIn.size()-1]->setNextTo ( NULL );
-    }
-    
-}
-
 Edges Vertex::getAdjacentEdges() const
 // ***********************************
 {
@@ -336,104 +239,52 @@ Edge* Vertex::getHEdgeLeadingTo ( Vertex* to )
 // *******************************************
 {
     Edge* edge = getHEdgeOut();
-    while ( edge ) {
-        if ( edge->getTo() == to )
-            break;
-        edge = edge->getNextFrom();
-    }
-    return edge;
+    return ( edge && (edge->getTo() == to) ) ? edge : NULL;
 }
 
 Edge* Vertex::getVEdgeLeadingTo ( Vertex* to )
 // *******************************************
 {
     Edge* edge = getVEdgeOut();
-    while ( edge ) {
-        if ( edge->getTo() == to ) 
-            break;
-        edge = edge->getNextFrom();
-    }
-    return edge;
+    return ( edge && (edge->getTo() == to) ) ? edge : NULL;
 }
 
 Edge* Vertex::getHEdgeComingFrom ( Vertex* from )
 // **********************************************
 {
     Edge* edge = getHEdgeIn();
-    while ( edge ) {
-        if ( edge->getFrom() == from ) 
-            break;
-        edge = edge->getNextTo();
-    }
-    return edge;
+    return ( edge && (edge->getFrom() == from) ) ? edge : NULL;
 }
 
 Edge* Vertex::getVEdgeComingFrom ( Vertex* from )
 // **********************************************
 {
     Edge* edge = getVEdgeIn();
-    while ( edge ) {
-        if ( edge->getFrom() == from ) 
-            break;
-        edge = edge->getNextTo();
-    }
-    return edge;
+    return ( edge && (edge->getFrom() == from) ) ? edge : NULL;
 }
 
-Edge* Vertex::getBestHEdgeOut ( DbU::Unit yDest )
+Edge* Vertex::getBestHEdgeOut ( DbU::Unit /*yDest*/ )
 // *****************************************
 {
-    Edge* bestEdge    = getHEdgeOut();
-    Edge* currentEdge = bestEdge;
-
-    while ( (currentEdge = currentEdge->getNextFrom()) ) {
-        if ( abs(currentEdge->getTo()->getY() - yDest) < abs(bestEdge->getTo()->getY() - yDest) )
-            bestEdge = currentEdge;
-    }
-
-    return bestEdge;
+    return getHEdgeOut();
 }
 
-Edge* Vertex::getBestVEdgeOut ( DbU::Unit xDest )
+Edge* Vertex::getBestVEdgeOut ( DbU::Unit /*xDest*/ )
 // *****************************************
 {
-    Edge* bestEdge    = getVEdgeOut();
-    Edge* currentEdge = bestEdge;
-
-    while ( (currentEdge = currentEdge->getNextFrom()) ) {
-        if ( abs(currentEdge->getTo()->getX() - xDest) < abs(bestEdge->getTo()->getX() - xDest) )
-            bestEdge = currentEdge;
-    }
-
-    return bestEdge;
+    return getVEdgeOut();
 }
 
-Edge* Vertex::getBestHEdgeIn ( DbU::Unit yDest )
+Edge* Vertex::getBestHEdgeIn ( DbU::Unit /*yDest*/ )
 // ****************************************
 {
-    Edge* bestEdge    = getHEdgeIn();
-    Edge* currentEdge = bestEdge;
-
-    while ( (currentEdge = currentEdge->getNextTo()) ) {
-        if ( abs(currentEdge->getFrom()->getY() - yDest) < abs(bestEdge->getFrom()->getY() - yDest) )
-            bestEdge = currentEdge;
-    }
-
-    return bestEdge;
+    return getHEdgeIn();
 }
 
-Edge* Vertex::getBestVEdgeIn ( DbU::Unit xDest )
+Edge* Vertex::getBestVEdgeIn ( DbU::Unit /*xDest*/ )
 // ****************************************
 {
-    Edge* bestEdge    = getVEdgeIn();
-    Edge* currentEdge = bestEdge;
-
-    while ( (currentEdge = currentEdge->getNextTo()) ) {
-        if ( abs(currentEdge->getFrom()->getX() - xDest) < abs(bestEdge->getFrom()->getX() - xDest) )
-            bestEdge = currentEdge;
-    }
-
-    return bestEdge;
+    return getVEdgeIn();
 }
 
 bool Vertex::hasInfo() const
@@ -651,11 +502,7 @@ void VERTEX_Edges::Locator::progress()
     if ( !_edge )
         return;
 
-    if ( _direction == 0 || _direction == 1 )
-        _edge = _edge->getNextFrom();
-    else
-        _edge = _edge->getNextTo();
-
+    _edge = NULL;
     while ( !_edge ) {
         if ( _direction == 3 )
             return;
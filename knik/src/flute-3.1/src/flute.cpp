@@ -1,5 +1,7 @@
+#ifdef FLUTE_RUNTIME_LUT
 // include added to be coriolis compliant
 #include <string>
+#include <mutex>
 using std::string;
 
 #include "hurricane/Error.h"
@@ -9,35 +11,15 @@ using Hurricane::Error;
 #include "crlcore/AllianceFramework.h"
 using CRL::Environment;
 using CRL::AllianceFramework;
+#endif
 
-// originals include
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
 #include <math.h>
 #include "knik/flute.h"
-
-#if D<=7
-#define MGROUP 5040/4  // Max. # of groups, 7! = 5040
-#define MPOWV 15  // Max. # of POWVs per group
-#elif D==8
-#define MGROUP 40320/4  // Max. # of groups, 8! = 40320
-#define MPOWV 33  // Max. # of POWVs per group
-#elif D==9
-#define MGROUP 362880/4  // Max. # of groups, 9! = 362880
-#define MPOWV 79  // Max. # of POWVs per group
-#endif
-int numgrp[10]={0,0,0,0,6,30,180,1260,10080,90720};
-
-struct csoln 
-{
-    unsigned char parent;
-    unsigned char seg[11];  // Add: 0..i, Sub: j..10; seg[i+1]=seg[j-1]=0
-    unsigned char rowcol[D-2];  // row = rowcol[]/16, col = rowcol[]%16, 
-    unsigned char neighbor[2*D-2];
-};
-struct csoln *LUT[D+1][MGROUP];  // storing 4 .. D
-int numsoln[D+1][MGROUP];
+#include "knik/flute_lut.h"
 
 struct point
 {
@@ -52,6 +34,7 @@ DTYPE flutes_wl_MD(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 DTYPE flutes_wl_RDP(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 FTree flute(int d, DTYPE x[], DTYPE y[], int acc);
 FTree flutes_LD(int d, DTYPE xs[], DTYPE ys[], int s[]);
+FTree flutes_LD_into(int d, DTYPE xs[], DTYPE ys[], int s[], Branch *branch);
 FTree flutes_MD(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 FTree flutes_RDP(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 FTree dmergetree(FTree t1, FTree t2);
@@ -63,7 +46,21 @@ void printtree(FTree t);
 void plottree(FTree t);
 
 
+#ifndef FLUTE_RUNTIME_LUT
+
+// The lookup tables are compiled in (see knik/flute_lut.h), there is
+// nothing left to load.
 void readLUT()
+{
+}
+
+#else
+
+struct csoln* flute_lut[D+1][MGROUP];  // storing 4 .. D
+int           flute_numsoln[D+1][MGROUP];
+
+// Loads the tables from the installed POWV9.dat & POST9.dat.
+static void loadLUT()
 {
     unsigned char charnum[256], line[32], *linep, c;
     FILE *fpwv, *fprt;
@@ -98,11 +95,13 @@ void readLUT()
     POSTFILE_string += "/share/coriolis2/flute-3.1/";
     POSTFILE_string += POSTFILE;
     fprt=fopen(POSTFILE_string.c_str(), "r");
-    if (fprt == NULL)
+    if (fprt == NULL) {
+      fclose ( fpwv );
       throw Error ( "flute::readLUT(): cannot find/open file:\n"
                     "        %s."
                   , POSTFILE_string.c_str()
                   );
+    }
 #endif
 
     for (d=4; d<=D; d++) {
@@ -115,14 +114,14 @@ void readLUT()
 
             if (ns==0) {  // same as some previous group
                 fscanf(fpwv, "%d\n", &kk);
-                numsoln[d][k] = numsoln[d][kk];
-                LUT[d][k] = LUT[d][kk];
+                flute_numsoln[d][k] = flute_numsoln[d][kk];
+                flute_lut[d][k] = flute_lut[d][kk];
             }
             else {
                 fgetc(fpwv);  // '\n'
-                numsoln[d][k] = ns;
+                flute_numsoln[d][k] = ns;
                 p = (struct csoln*) malloc(ns*sizeof(struct csoln));
-                LUT[d][k] = p;
+                flute_lut[d][k] = p;
                 for (i=1; i<=ns; i++) {
                     linep = (unsigned char *) fgets((char *) line, 32, fpwv);
                     p->parent = charnum[*(linep++)];
@@ -151,9 +150,21 @@ void readLUT()
     }
 
     fclose ( fpwv );
+#if ROUTING==1
     fclose ( fprt );
+#endif
+}
+
+// Only the first call reads the tables, concurrent callers wait for it
+// to complete. If the load throws, the next call tries again.
+void readLUT()
+{
+    static std::once_flag loaded;
+    std::call_once ( loaded, loadLUT );
 }
 
+#endif  // FLUTE_RUNTIME_LUT
+
 
 DTYPE flute_wl(int d, DTYPE x[], DTYPE y[], int acc)
 {
@@ -287,7 +298,7 @@ DTYPE flutes_wl_RDP(int d, DTYPE xs[], DTYPE ys[], int s[], int acc)
 DTYPE flutes_wl_LD(int d, DTYPE xs[], DTYPE ys[], int s[])
 {
     int k, pi, i, j;
-    struct csoln *rlist;
+    const struct csoln *rlist;
     DTYPE dd[2*D-2];  // 0..D-2 for v, D-1..2*D-3 for h
     DTYPE minl, sum, l[MPOWV+1];
     
@@ -320,13 +331,13 @@ DTYPE flutes_wl_LD(int d, DTYPE xs[], DTYPE ys[], int s[])
         }
         
         minl = l[0] = xs[d-1]-xs[0]+ys[d-1]-ys[0];
-        rlist = LUT[d][k];
+        rlist = lut_solutions(d, k);
         for (i=0; rlist->seg[i]>0; i++)
             minl += dd[rlist->seg[i]];
         
         l[1] = minl;
         j = 2;
-        while (j <= numsoln[d][k]) {
+        while (j <= lut_numsoln(d, k)) {
             rlist++;
             sum = l[rlist->parent];
             for (i=0; rlist->seg[i]>0; i++)
@@ -596,12 +607,96 @@ static int ordery(const void *a, const void *b)
     return 0;
 }
 
+// Sorts the pins in x then in y, filling xs[], ys[] & s[] as expected by
+// flutes(). pt[] and ptp[] are work arrays of d+1 elements. Returns the
+// degree, which may be lowered if duplicated pins are removed.
+static int sort_pins(int d, DTYPE x[], DTYPE y[], DTYPE xs[], DTYPE ys[], int s[],
+                     struct point *pt, struct point **ptp)
+{
+    DTYPE minval;
+    int i, j, minidx;
+    struct point *tmpp;
+
+    for (i=0; i<d; i++) {
+        pt[i].x = x[i];
+        pt[i].y = y[i];
+        ptp[i] = &pt[i];
+    }
+
+    // sort x
+    if (d<200) {
+        for (i=0; i<d-1; i++) {
+            minval = ptp[i]->x;
+            minidx = i;
+            for (j=i+1; j<d; j++) {
+                if (minval > ptp[j]->x) {
+                    minval = ptp[j]->x;
+                    minidx = j;
+                }
+            }
+            tmpp = ptp[i];
+            ptp[i] = ptp[minidx];
+            ptp[minidx] = tmpp;
+        }
+    } else {
+        qsort(ptp, d, sizeof(struct point *), orderx);
+    }
+
+#if REMOVE_DUPLICATE_PIN==1
+    {
+      int k;
+      ptp[d] = &pt[d];
+      ptp[d]->x = ptp[d]->y = -999999;
+      j = 0;
+      for (i=0; i<d; i++) {
+          for (k=i+1; ptp[k]->x == ptp[i]->x; k++)
+              if (ptp[k]->y == ptp[i]->y)  // pins k and i are the same
+                  break;
+          if (ptp[k]->x != ptp[i]->x)
+              ptp[j++] = ptp[i];
+      }
+      d = j;
+    }
+#endif
+
+    for (i=0; i<d; i++) {
+        xs[i] = ptp[i]->x;
+        ptp[i]->o = i;
+    }
+
+    // sort y to find s[]
+    if (d<200) {
+        for (i=0; i<d-1; i++) {
+            minval = ptp[i]->y;
+            minidx = i;
+            for (j=i+1; j<d; j++) {
+                if (minval > ptp[j]->y) {
+                    minval = ptp[j]->y;
+                    minidx = j;
+                }
+            }
+            ys[i] = ptp[minidx]->y;
+            s[i] = ptp[minidx]->o;
+            ptp[minidx] = ptp[i];
+        }
+        ys[d-1] = ptp[d-1]->y;
+        s[d-1] = ptp[d-1]->o;
+    } else {
+        qsort(ptp, d, sizeof(struct point *), ordery);
+        for (i=0; i<d; i++) {
+            ys[i] = ptp[i]->y;
+            s[i] = ptp[i]->o;
+        }
+    }
+
+    return d;
+}
+
 FTree flute(int d, DTYPE x[], DTYPE y[], int acc)
 {
-    DTYPE *xs, *ys, minval;
+    DTYPE *xs, *ys;
     int *s;
-    int i, j, minidx;
-    struct point *pt, **ptp, *tmpp;
+    struct point *pt, **ptp;
     FTree t;
     
     if (d==2) {
@@ -622,78 +717,7 @@ FTree flute(int d, DTYPE x[], DTYPE y[], int acc)
         pt = (struct point *)malloc(sizeof(struct point)*(d+1));
         ptp = (struct point **)malloc(sizeof(struct point*)*(d+1));
 
-        for (i=0; i<d; i++) {
-            pt[i].x = x[i];
-            pt[i].y = y[i];
-            ptp[i] = &pt[i];
-        }
-
-        // sort x
-        if (d<200) {
-            for (i=0; i<d-1; i++) {
-                minval = ptp[i]->x;
-                minidx = i;
-                for (j=i+1; j<d; j++) {
-                    if (minval > ptp[j]->x) {
-                        minval = ptp[j]->x;
-                        minidx = j;
-                    }
-                }
-                tmpp = ptp[i];
-                ptp[i] = ptp[minidx];
-                ptp[minidx] = tmpp;
-            }
-        } else {
-            qsort(ptp, d, sizeof(struct point *), orderx);
-        }
-
-#if REMOVE_DUPLICATE_PIN==1
-        {
-          int k;
-          ptp[d] = &pt[d];
-          ptp[d]->x = ptp[d]->y = -999999;
-          j = 0;
-          for (i=0; i<d; i++) {
-              for (k=i+1; ptp[k]->x == ptp[i]->x; k++)
-                  if (ptp[k]->y == ptp[i]->y)  // pins k and i are the same
-                      break;
-              if (ptp[k]->x != ptp[i]->x)
-                  ptp[j++] = ptp[i];
-          }
-          d = j;
-        }
-#endif
-        
-        for (i=0; i<d; i++) {
-            xs[i] = ptp[i]->x;
-            ptp[i]->o = i;
-        }
-
-        // sort y to find s[]
-        if (d<200) {
-            for (i=0; i<d-1; i++) {
-                minval = ptp[i]->y;
-                minidx = i;
-                for (j=i+1; j<d; j++) {
-                    if (minval > ptp[j]->y) {
-                        minval = ptp[j]->y;
-                        minidx = j;
-                    }
-                }
-                ys[i] = ptp[minidx]->y;
-                s[i] = ptp[minidx]->o;
-                ptp[minidx] = ptp[i];
-            }
-            ys[d-1] = ptp[d-1]->y;
-            s[d-1] = ptp[d-1]->o;
-        } else {
-            qsort(ptp, d, sizeof(struct point *), ordery);
-            for (i=0; i<d; i++) {
-                ys[i] = ptp[i]->y;
-                s[i] = ptp[i]->o;
-            }
-        }
-        
+        d = sort_pins(d, x, y, xs, ys, s, pt, ptp);
         t = flutes(d, xs, ys, s, acc);
 
         free(xs);
@@ -706,6 +730,81 @@ FTree flute(int d, DTYPE x[], DTYPE y[], int acc)
     return t;
 }
 
+struct FluteScratch
+{
+    int capacity;   // max. degree the buffers can hold
+    DTYPE *xs, *ys;
+    int *s;
+    struct point *pt, **ptp;
+    Branch *branch;
+};
+
+FluteScratch *flute_scratch_create()
+{
+    FluteScratch *scratch = (FluteScratch *) malloc(sizeof(FluteScratch));
+    memset(scratch, 0, sizeof(FluteScratch));
+    return scratch;
+}
+
+void flute_scratch_destroy(FluteScratch *scratch)
+{
+    if (!scratch) return;
+    free(scratch->xs);
+    free(scratch->ys);
+    free(scratch->s);
+    free(scratch->pt);
+    free(scratch->ptp);
+    free(scratch->branch);
+    free(scratch);
+}
+
+static void flute_scratch_reserve(FluteScratch *scratch, int d)
+{
+    if (d <= scratch->capacity) return;
+    scratch->capacity = max(d, 2*scratch->capacity);
+    d = scratch->capacity;
+    scratch->xs = (DTYPE *)realloc(scratch->xs, sizeof(DTYPE)*(d));
+    scratch->ys = (DTYPE *)realloc(scratch->ys, sizeof(DTYPE)*(d));
+    scratch->s = (int *)realloc(scratch->s, sizeof(int)*(d));
+    scratch->pt = (struct point *)realloc(scratch->pt, sizeof(struct point)*(d+1));
+    scratch->ptp = (struct point **)realloc(scratch->ptp, sizeof(struct point*)*(d+1));
+    scratch->branch = (Branch *)realloc(scratch->branch, sizeof(Branch)*(2*d-2));
+}
+
+FTree flute_r(int d, DTYPE x[], DTYPE y[], int acc, FluteScratch *scratch)
+{
+    FTree t;
+
+    flute_scratch_reserve(scratch, max(d, 2));
+    if (d==2) {
+        t.deg = 2;
+        t.length = ADIFF(x[0], x[1]) + ADIFF(y[0], y[1]);
+        t.branch = scratch->branch;
+        t.branch[0].x = x[0];
+        t.branch[0].y = y[0];
+        t.branch[0].n = 1;
+        t.branch[1].x = x[1];
+        t.branch[1].y = y[1];
+        t.branch[1].n = 1;
+        return t;
+    }
+
+    d = sort_pins(d, x, y, scratch->xs, scratch->ys, scratch->s, scratch->pt, scratch->ptp);
+#if REMOVE_DUPLICATE_PIN==0
+    if (d<=D)
+        return flutes_LD_into(d, scratch->xs, scratch->ys, scratch->s, scratch->branch);
+#endif
+
+    // The medium & high degree nets are built by merging sub-trees which
+    // are still allocated on the heap: only the result is moved into the
+    // scratch area.
+    t = flutes(d, scratch->xs, scratch->ys, scratch->s, acc);
+    memcpy(scratch->branch, t.branch, (2*t.deg-2)*sizeof(Branch));
+    free(t.branch);
+    t.branch = scratch->branch;
+    return t;
+}
+
 // xs[] and ys[] are coords in x and y in sorted order
 // s[] is a list of nodes in increasing y direction
 //   if nodes are indexed in the order of increasing x coord
@@ -742,16 +841,22 @@ FTree flutes_RDP(int d, DTYPE xs[], DTYPE ys[], int s[], int acc)
     
 // For low-degree, i.e., 2 <= d <= D
 FTree flutes_LD(int d, DTYPE xs[], DTYPE ys[], int s[])
+{
+    return flutes_LD_into(d, xs, ys, s, (Branch *) malloc((2*d-2)*sizeof(Branch)));
+}
+
+// Same as flutes_LD(), the 2*d-2 branches being written in branch[].
+FTree flutes_LD_into(int d, DTYPE xs[], DTYPE ys[], int s[], Branch *branch)
 {
     int k, pi, i, j;
-    struct csoln *rlist, *bestrlist;
+    const struct csoln *rlist, *bestrlist;
     DTYPE dd[2*D-2];  // 0..D-2 for v, D-1..2*D-3 for h
     DTYPE minl, sum, l[MPOWV+1];
     int hflip;
     FTree t;
 
     t.deg = d;
-    t.branch = (Branch *) malloc((2*d-2)*sizeof(Branch));
+    t.branch = branch;
     if (d == 2) {
         minl = xs[1]-xs[0]+ys[1]-ys[0];
         t.branch[0].x = xs[s[0]];
@@ -806,13 +911,13 @@ FTree flutes_LD(int d, DTYPE xs[], DTYPE ys[], int s[])
         }
         
         minl = l[0] = xs[d-1]-xs[0]+ys[d-1]-ys[0];
-        rlist = LUT[d][k];
+        rlist = lut_solutions(d, k);
         for (i=0; rlist->seg[i]>0; i++)
             minl += dd[rlist->seg[i]];
         bestrlist = rlist;
         l[1] = minl;
         j = 2;
-        while (j <= numsoln[d][k]) {
+        while (j <= lut_numsoln(d, k)) {
             rlist++;
             sum = l[rlist->parent];
             for (i=0; rlist->seg[i]>0; i++)
@@ -0,0 +1,136 @@
+// Build time generator of the FLUTE lookup tables.
+//
+// Usage: flute_lut_gen POWV9.dat POST9.dat flute_lut.cpp
+//
+// Parses the POWV & POST tables exactly as readLUT() used to do at run
+// time and writes them as constant arrays (see knik/flute_lut.h).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "knik/flute_lut.h"
+
+using std::vector;
+
+
+static void fail(const char* message, const char* path)
+{
+    fprintf(stderr, "flute_lut_gen: %s: %s\n", message, path);
+    exit(1);
+}
+
+static void writeSolutions(FILE* fout, const vector<struct csoln>& solutions)
+{
+    const unsigned char* bytes = (const unsigned char*) solutions.data();
+    size_t               size  = solutions.size()*sizeof(struct csoln);
+
+    // Octal escapes are always three digits long, so they cannot swallow
+    // the following character. A string literal compiles much faster than
+    // a brace initializer of the same size.
+    fprintf(fout, "const unsigned char flute_lut_solutions[] =\n");
+    for (size_t i=0; i<size; i+=64) {
+        fprintf(fout, "  \"");
+        for (size_t j=i; j<i+64 && j<size; j++)
+            fprintf(fout, "\\%03o", bytes[j]);
+        fprintf(fout, "\"\n");
+    }
+    fprintf(fout, "  ;\n\n");
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned char charnum[256], line[32], *linep, c;
+    FILE *fpwv, *fprt, *fout;
+    int d, i, j, k, kk, ns, nn;
+    vector<struct csoln> solutions;
+    vector<unsigned int> groups;
+    unsigned int         groupBase[D+1];
+
+    if (argc != 4) {
+        fprintf(stderr, "Usage: flute_lut_gen <POWV file> <POST file> <output>\n");
+        return 1;
+    }
+
+    for (i=0; i<=255; i++) {
+        if ('0'<=i && i<='9')
+            charnum[i] = i - '0';
+        else if (i>='A')
+            charnum[i] = i - 'A' + 10;
+        else // if (i=='$' || i=='\n' || ... )
+            charnum[i] = 0;
+    }
+
+    if ((fpwv = fopen(argv[1], "r")) == NULL) fail("cannot open", argv[1]);
+    if ((fprt = fopen(argv[2], "r")) == NULL) fail("cannot open", argv[2]);
+
+    for (d=0; d<4; d++) groupBase[d] = 0;
+    for (d=4; d<=D; d++) {
+        groupBase[d] = groups.size();
+        if (fscanf(fpwv, "d=%d\n", &d) != 1) fail("bad degree header", argv[1]);
+        if (fscanf(fprt, "d=%d\n", &d) != 1) fail("bad degree header", argv[2]);
+        for (k=0; k<numgrp[d]; k++) {
+            ns = (int) charnum[fgetc(fpwv)];
+
+            if (ns==0) {  // same as some previous group
+                if (fscanf(fpwv, "%d\n", &kk) != 1) fail("bad group reference", argv[1]);
+                groups.push_back(groups[groupBase[d]+kk]);
+            }
+            else {
+                fgetc(fpwv);  // '\n'
+                if (ns > MPOWV || solutions.size() >= (1<<24))
+                    fail("table overflow", argv[1]);
+                groups.push_back((solutions.size() << 8) | ns);
+                for (i=1; i<=ns; i++) {
+                    struct csoln p;
+                    memset(&p, 0, sizeof(p));
+                    linep = (unsigned char *) fgets((char *) line, 32, fpwv);
+                    if (linep == NULL) fail("unexpected end of file", argv[1]);
+                    p.parent = charnum[*(linep++)];
+                    j = 0;
+                    while ((p.seg[j++] = charnum[*(linep++)]) != 0) ;
+                    j = 10;
+                    while ((p.seg[j--] = charnum[*(linep++)]) != 0) ;
+                    nn = 2*d-2;
+                    if (fread(line, 1, d-2, fprt) != (size_t)(d-2)) fail("unexpected end of file", argv[2]);
+                    linep=line;
+                    for (j=d; j<nn; j++) {
+                        c = charnum[*(linep++)];
+                        p.rowcol[j-d] = c;
+                    }
+                    if (fread(line, 1, nn/2+1, fprt) != (size_t)(nn/2+1)) fail("unexpected end of file", argv[2]);
+                    linep=line;  // last char \n
+                    for (j=0; j<nn; ) {
+                        c = *(linep++);
+                        p.neighbor[j++] = c/16;
+                        p.neighbor[j++] = c%16;
+                    }
+                    solutions.push_back(p);
+                }
+            }
+        }
+    }
+
+    fclose(fpwv);
+    fclose(fprt);
+
+    if ((fout = fopen(argv[3], "w")) == NULL) fail("cannot create", argv[3]);
+
+    fprintf(fout, "// Generated by flute_lut_gen from %s and %s, do not edit.\n\n", argv[1], argv[2]);
+    fprintf(fout, "#include \"knik/flute_lut.h\"\n\n");
+
+    fprintf(fout, "const unsigned int flute_lut_group_base[D+1] = {");
+    for (d=0; d<=D; d++)
+        fprintf(fout, "%s%u", (d ? "," : ""), groupBase[d]);
+    fprintf(fout, "};\n\n");
+
+    fprintf(fout, "const unsigned int flute_lut_groups[] = {");
+    for (size_t g=0; g<groups.size(); g++)
+        fprintf(fout, "%s%u", ((g%8) ? "," : (g ? ",\n  " : "\n  ")), groups[g]);
+    fprintf(fout, "\n};\n\n");
+
+    writeSolutions(fout, solutions);
+
+    if (fclose(fout) != 0) fail("cannot write", argv[3]);
+    return 0;
+}
@@ -21,10 +21,12 @@
 #define MAXT (d/5)
 #endif
 
-int D3=INFNTY;
+// The state of the algorithm is kept per thread, so several nets can
+// be processed concurrently.
+thread_local int D3=INFNTY;
 
-int FIRST_ROUND=2; // note that num of total rounds = 1+FIRST_ROUND
-int EARLY_QUIT_CRITERIA=1;
+thread_local int FIRST_ROUND=2; // note that num of total rounds = 1+FIRST_ROUND
+thread_local int EARLY_QUIT_CRITERIA=1;
 
 #define DEFAULT_QSIZE (3+min(d,1000))
 
@@ -32,10 +34,10 @@ int EARLY_QUIT_CRITERIA=1;
 #if USE_HASHING
 #define new_ht 1
 //int new_ht=1;
-dl_t ht[D2M+1]; // hash table of subtrees indexed by degree
+thread_local dl_t ht[D2M+1]; // hash table of subtrees indexed by degree
 #endif
 
-unsigned int curr_mark=0;
+thread_local unsigned int curr_mark=0;
 
 FTree wmergetree(FTree t1, FTree t2, int *order1, int *order2, DTYPE cx, DTYPE cy, int acc);
 FTree xmergetree(FTree t1, FTree t2, int *order1, int *order2, DTYPE cx, DTYPE cy);
@@ -57,13 +59,13 @@ inline void enqueue(int **q, int e)
 }
 
 #define MAX_HEAP_SIZE (MAXD*2)
-DTYPE **hdist;
+thread_local DTYPE **hdist;
 typedef struct node_pair_s { // pair of nodes representing an edge
   int node1, node2;
 } node_pair;
-node_pair *heap; //heap[MAXD*MAXD]; 
-int heap_size=0;
-int max_heap_size = MAX_HEAP_SIZE;
+thread_local node_pair *heap; //heap[MAXD*MAXD]; 
+thread_local int heap_size=0;
+thread_local int max_heap_size = MAX_HEAP_SIZE;
 
 int in_heap_order(int e1, int e2)
 {
@@ -137,7 +139,7 @@ void init_param()
   heap = (node_pair*)malloc(sizeof(node_pair)*(max_heap_size+1));
 }
 
-FTree reftree;  // reference for qsort
+thread_local FTree reftree;  // reference for qsort
 int cmp_branch(const void *a, const void *b) {
   int n;
   DTYPE x1, x2, x3;
@@ -9,9 +9,10 @@
 #include "knik/err.h"
 
 
-Heap*   _heap = (Heap*)NULL;
-long    _max_heap_size = 0;
-long    _heap_size = 0;
+// Per thread, so the MST of several nets may be computed concurrently.
+thread_local Heap*   _heap = (Heap*)NULL;
+thread_local long    _max_heap_size = 0;
+thread_local long    _heap_size = 0;
 
 /****************************************************************************/
 /*
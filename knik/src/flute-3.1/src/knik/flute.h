@@ -22,6 +22,7 @@
 // DTYPE flute_wl(int d, DTYPE x[], DTYPE y[], int acc);
 // DTYPE flutes_wl(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 // FTree flute(int d, DTYPE x[], DTYPE y[], int acc);
+// FTree flute_r(int d, DTYPE x[], DTYPE y[], int acc, FluteScratch *scratch);
 // FTree flutes(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 // DTYPE wirelength(FTree t);
 // void printtree(FTree t);
@@ -31,6 +32,9 @@
 /*************************************/
 /* Internal Parameters and Functions */
 /*************************************/
+// The LUT for POWV (Wirelength Vector) & POST (Steiner FTree) are
+// compiled in from POWV9.dat & POST9.dat, or read from them at run time
+// (FLUTE_RUNTIME_LUT), see flute_lut.h.
 #define POWVFILE "POWV9.dat"        // LUT for POWV (Wirelength Vector)
 #define POSTFILE "POST9.dat"        // LUT for POST (Steiner FTree)
 #define D 9                         // LUT is used for d <= D, D <= 9
@@ -51,11 +55,19 @@ struct FTree
     Branch *branch;   // array of tree branches
 };
 
+// Work buffers of flute_r(), to be allocated once per thread. The
+// branches of the returned tree belong to the scratch area and are
+// only valid until the next call using it.
+struct FluteScratch;
+
 // User-Callable Functions
-extern void readLUT();
+extern void readLUT();  // No-op when the LUT are compiled in.
 extern DTYPE flute_wl(int d, DTYPE x[], DTYPE y[], int acc);
 //Macro: DTYPE flutes_wl(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 extern FTree flute(int d, DTYPE x[], DTYPE y[], int acc);
+extern FTree flute_r(int d, DTYPE x[], DTYPE y[], int acc, FluteScratch *scratch);
+extern FluteScratch *flute_scratch_create();
+extern void flute_scratch_destroy(FluteScratch *scratch);
 //Macro: FTree flutes(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 extern DTYPE wirelength(FTree t);
 extern void printtree(FTree t);
@@ -67,6 +79,7 @@ extern DTYPE flutes_wl_LD(int d, DTYPE xs[], DTYPE ys[], int s[]);
 extern DTYPE flutes_wl_MD(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 extern DTYPE flutes_wl_RDP(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 extern FTree flutes_LD(int d, DTYPE xs[], DTYPE ys[], int s[]);
+extern FTree flutes_LD_into(int d, DTYPE xs[], DTYPE ys[], int s[], Branch *branch);
 extern FTree flutes_MD(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 extern FTree flutes_HD(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
 extern FTree flutes_RDP(int d, DTYPE xs[], DTYPE ys[], int s[], int acc);
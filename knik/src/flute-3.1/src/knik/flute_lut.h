@@ -0,0 +1,70 @@
+#ifndef _KNIK_FLUTE_LUT_H
+#define _KNIK_FLUTE_LUT_H
+
+/**********************************************/
+/*  Compiled-in Lookup Tables (POWV & POST)   */
+/**********************************************/
+// When POWV9.dat & POST9.dat are both present in the source tree,
+// flute_lut_gen parses them at build time and writes flute_lut.cpp, which
+// holds the tables as read-only data. They are shared by all the threads
+// and only paged in when a net of degree 4..D is first routed.
+//
+// Otherwise the build defines FLUTE_RUNTIME_LUT and readLUT() loads them
+// from share/coriolis2/flute-3.1, once, before any routing.
+
+#include "knik/flute.h"
+
+#if D<=7
+#define MGROUP 5040/4  // Max. # of groups, 7! = 5040
+#define MPOWV 15  // Max. # of POWVs per group
+#elif D==8
+#define MGROUP 40320/4  // Max. # of groups, 8! = 40320
+#define MPOWV 33  // Max. # of POWVs per group
+#elif D==9
+#define MGROUP 362880/4  // Max. # of groups, 9! = 362880
+#define MPOWV 79  // Max. # of POWVs per group
+#endif
+
+struct csoln
+{
+    unsigned char parent;
+    unsigned char seg[11];  // Add: 0..i, Sub: j..10; seg[i+1]=seg[j-1]=0
+    unsigned char rowcol[D-2];  // row = rowcol[]/16, col = rowcol[]%16,
+    unsigned char neighbor[2*D-2];
+};
+
+// Number of groups for each degree (4 .. D), i.e. d!/4 once the
+// symmetric ones are removed.
+static const int numgrp[10]={0,0,0,0,6,30,180,1260,10080,90720};
+
+#ifdef FLUTE_RUNTIME_LUT
+
+extern struct csoln* flute_lut[D+1][MGROUP];  // storing 4 .. D
+extern int           flute_numsoln[D+1][MGROUP];
+
+inline const struct csoln* lut_solutions(int d, int k) { return flute_lut[d][k]; }
+inline int                 lut_numsoln  (int d, int k) { return flute_numsoln[d][k]; }
+
+#else
+
+// flute_lut_group_base[d] is the index of the first group of degree d
+// in flute_lut_groups[]. Each group is encoded as:
+//     (index of its first solution << 8) | number of solutions
+// Groups identical to a previous one share its solutions. The solutions
+// themselves are stored as a flat array of packed csoln records.
+extern const unsigned int   flute_lut_group_base[D+1];
+extern const unsigned int   flute_lut_groups[];
+extern const unsigned char  flute_lut_solutions[];
+
+inline const struct csoln* lut_solutions(int d, int k)
+{
+    return (const struct csoln*)flute_lut_solutions
+         + (flute_lut_groups[flute_lut_group_base[d]+k] >> 8);
+}
+
+inline int lut_numsoln(int d, int k)
+{ return (int)(flute_lut_groups[flute_lut_group_base[d]+k] & 0xff); }
+
+#endif  // FLUTE_RUNTIME_LUT
+
+#endif
@@ -12,7 +12,7 @@ struct  heap_info
 
 typedef  struct heap_info  Heap;
 
-extern Heap*   _heap;
+extern thread_local Heap*   _heap;
 
 #define  heap_key( p )     ( _heap[p].key )
 #define  heap_idx( p )     ( _heap[p].idx )
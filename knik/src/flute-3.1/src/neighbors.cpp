@@ -11,18 +11,19 @@ long  octant
   Point  to
 );
 
-static Point* _pt;
+static thread_local Point* _pt;
 
 /***************************************************************************/
 /*
-  For efficiency purposes auxiliary arrays are allocated as globals 
+  For efficiency purposes auxiliary arrays are allocated as globals,
+  one set per thread.
 */
 
-long    max_arrays_size = 0;
-nn_array*  nn   = (nn_array*)NULL;
-Point*  sheared = (Point*)NULL;
-long*  sorted   = (long*)NULL;
-long*  aux      = (long*)NULL;  
+thread_local long    max_arrays_size = 0;
+thread_local nn_array*  nn   = (nn_array*)NULL;
+thread_local Point*  sheared = (Point*)NULL;
+thread_local long*  sorted   = (long*)NULL;
+thread_local long*  aux      = (long*)NULL;  
 
 /***************************************************************************/
 /*
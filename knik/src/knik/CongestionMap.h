@@ -0,0 +1,75 @@
+#ifndef _KNIK_CONGESTIONMAP_H
+#define _KNIK_CONGESTIONMAP_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Knik {
+
+  using std::string;
+  using std::vector;
+
+  class GridGraph;
+
+    // Snapshot of the routing grid congestion, one dense map per direction.
+    //
+    // The value of the map at (column,line) is the one of the edge going
+    // out of that vertex (rightward for the horizontal map, upward for the
+    // vertical one), the last column (resp. line) being left empty. It can
+    // be saved without any display:
+    //   - as a binary file: the "KNIKCMAP" magic, the format version, the
+    //     grid sizes (all uint32_t), then for each direction the occupancy
+    //     and the capacity arrays (uint16_t, line by line, from the bottom).
+    //   - as a PNG image: both directions side by side, a gradient from
+    //     blue (empty) through green to red (saturated) and white for the
+    //     overflowed edges. No compression library is needed, the image
+    //     data is stored in uncompressed deflate blocks.
+
+    class CongestionMap {
+    // ******************
+        public:
+            enum Direction { Horizontal=0, Vertical=1 };
+
+        // Attributes
+        // **********
+        private:
+            unsigned          _xSize;
+            unsigned          _ySize;
+            vector<uint16_t>  _occupancies[2];
+            vector<uint16_t>  _capacities [2];
+            unsigned          _overflowedEdges[2];
+            float             _maxRatio[2];
+
+        // Constructors
+        // ************
+        public:
+            CongestionMap ();
+
+        // Accessors
+        // *********
+        public:
+            unsigned  getXSize           () const { return _xSize; };
+            unsigned  getYSize           () const { return _ySize; };
+            unsigned  getOccupancy       ( Direction d, unsigned column, unsigned line ) const { return _occupancies[d][(size_t)line*_xSize+column]; };
+            unsigned  getCapacity        ( Direction d, unsigned column, unsigned line ) const { return _capacities [d][(size_t)line*_xSize+column]; };
+            unsigned  getOverflowedEdges ( Direction d ) const { return _overflowedEdges[d]; };
+            float     getMaxRatio        ( Direction d ) const { return _maxRatio[d]; };
+
+        // Modifiers
+        // *********
+        public:
+            void      build              ( const GridGraph* );
+
+        // Others
+        // ******
+        public:
+            bool      save               ( const string& fileName ) const;
+            bool      saveBinary         ( const string& fileName ) const;
+            bool      savePng            ( const string& fileName ) const;
+            void      printStatistics    () const;
+    };
+
+} // namespace Knik
+
+#endif  // _KNIK_CONGESTIONMAP_H
@@ -7,6 +7,8 @@
 #include "hurricane/Segment.h"
 #include "hurricane/Error.h"
 
+#include "knik/GridGraph.h"
+
 //#define __USE_CONGESTION__
 //#define __USE_STATIC_PRECONGESTION__
 //#define __USE_DYNAMIC_PRECONGESTION__
@@ -30,26 +32,16 @@ namespace Knik {
             static float _h;
             static float _k;
 
-            Box       _boundingBox;
-            Vertex*   _from;
-            Edge*     _nextFrom;
-            Vertex*   _to;
-            Edge*     _nextTo;
-            int       _connexID;
-            float     _cost;
-            unsigned  _capacity;
-            unsigned  _realOccupancy;
-            float     _estimateOccupancy; // used as estimateOccupancy in routing and historic cost during ripup & reroute
-            float     _normalisedLength;
-            unsigned  _netStamp;
-            bool      _isCongested;
-            vector<Segment*> _segments;
+            GridGraph* _grid;     // the routing state is stored there, see GridGraph.
+            Vertex*    _from;
+            Vertex*    _to;
+            unsigned   _index;
+            bool       _hasBeenCongested; // the bounding box stays empty until then.
                  
         // Constructors & Destructors
         // **************************
         protected:
-            Edge ( Vertex* from, Vertex* to );
-            Edge ( Vertex* from, Vertex* to, unsigned capacity );
+            Edge ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity );
             ~Edge ();
 
         public: 
@@ -61,18 +53,15 @@ namespace Knik {
         // Modifiers
         // *********
         public:
-            void incOccupancy     ();
-            void decOccupancy     ();
-            void insertSegment    ( Segment* segment )   { assert(segment); incOccupancy(); _segments.push_back(segment); };
-            void setNextFrom      ( Edge* edge )         { _nextFrom = edge; };
-            void setNextTo        ( Edge* edge )         { _nextTo = edge; };
-            void setConnexID      ( int connexID )       { _connexID = connexID; };
-          //void setCapacity      ( unsigned capacity )  { _capacity = capacity; };
-            void setCapacity      ( unsigned capacity );
+            void incOccupancy     ()                     { if ( ++_grid->_occupancies[_index] > getCapacity() ) _hasBeenCongested = true; };
+            void decOccupancy     ()                     { if ( _grid->_occupancies[_index] > 0 ) _grid->_occupancies[_index]--; };
+            void insertSegment    ( Segment* segment )   { assert(segment); incOccupancy(); _grid->_segments[_index].push_back(segment); };
+            void setConnexID      ( int connexID )       { _grid->_connexIDs[_index] = connexID; };
+            void setCapacity      ( unsigned capacity )  { _grid->_capacities[_index] = capacity; };
             void increaseCapacity ( int capacity );
-            void setCost          ( float cost )         { _cost = cost; };
-            void incCost          ( float inc )          { _cost += inc; };
-            void setNetStamp      ( unsigned netStamp )  { _netStamp = netStamp; };
+            void setCost          ( float cost )         { _grid->_costs[_index] = cost; };
+            void incCost          ( float inc )          { _grid->_costs[_index] += inc; };
+            void setNetStamp      ( unsigned netStamp )  { _grid->_netStamps[_index] = netStamp; };
             void setHParameter    ( float h )            { _h = h; };
             void setKParameter    ( float k )            { _k = k; };
             void removeSegment    ( Segment* segment );
@@ -84,30 +73,29 @@ namespace Knik {
             static const Name& staticGetName () { return _extensionName; };
                    const Name& getName       () const { return _extensionName; };
             Vertex*   getFrom             () const { return _from; };
-            Edge*     getNextFrom         () const { return _nextFrom; };
             Vertex*   getTo               () const { return _to; };
-            Edge*     getNextTo           () const { return _nextTo; };
-            int       getConnexID         () const { return _connexID; };
-            unsigned  getCapacity         () const { return _capacity; };
-            float     getEstimateOccupancy() const { return _estimateOccupancy; };
-            unsigned  getNetStamp         () const { return _netStamp; };
+            size_t    getIndex            () const { return _index; };
+            int       getConnexID         () const { return _grid->_connexIDs[_index]; };
+            unsigned  getCapacity         () const { return _grid->_capacities[_index]; };
+            float     getEstimateOccupancy() const { return _grid->_estimates[_index]; };
+            unsigned  getNetStamp         () const { return _grid->_netStamps[_index]; };
             float     getHParameter       ()       { return _h; };
             float     getKParameter       ()       { return _k; };
-            unsigned  getOverflow         () const { return (_realOccupancy>_capacity)?_realOccupancy-_capacity:0; };
+            unsigned  getOverflow         () const { return (getRealOccupancy()>getCapacity())?getRealOccupancy()-getCapacity():0; };
             Vertex*   getOpposite ( const Vertex* v ) const { if (v == _from) return _to;
                                                               if (v == _to)   return _from;
                                                               assert ( (v==_from) || (v==_to) );
                                                               return NULL; /* to avoid warning, never reached */ };
-            GenericCollection<Segment*> getSegments() { return getCollection ( _segments ); } ;
-            unsigned  getRealOccupancy    () const;
+            GenericCollection<Segment*> getSegments() { return getCollection ( _grid->_segments[_index] ); } ;
+            unsigned  getRealOccupancy    () const { return _grid->_occupancies[_index]; };
             Segment*  getSegmentFor       ( Net*net );
             float     getCost             ( Edge* arrivalEdge );
-            float     getConstCost     () const { return _cost; };
+            float     getConstCost     () const { return _grid->_costs[_index]; };
             DbU::Unit      getXTo      () const;
             DbU::Unit      getYTo      () const;
             DbU::Unit      getXFrom    () const;
             DbU::Unit      getYFrom    () const;
-            Box            getBoundingBox() const { return _boundingBox; };
+            Box            getBoundingBox() const { return (_hasBeenCongested) ? computeBoundingBox() : Box(); };
             virtual Box        computeBoundingBox() const = 0;
             virtual Point      getReferencePoint () const = 0;
             virtual DbU::Unit  getWidth () const = 0;
@@ -120,7 +108,7 @@ namespace Knik {
         public:
             virtual bool isVertical  () const = 0;
             virtual bool isHorizontal() const = 0;
-            bool         isCongested () { return _isCongested; } 
+            bool         isCongested () const { return getRealOccupancy() > getCapacity(); }
             bool         hasInfo     () const;
 
         // ExtensionGo methods
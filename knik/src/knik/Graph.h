@@ -29,6 +29,7 @@
 #include "knik/RoutingGrid.h"
 
 struct FTree;
+struct FluteScratch;
 
 namespace Knik {
 
@@ -95,6 +96,7 @@ namespace Knik {
                 unsigned            _netStamp;
                 float               _hEdgeNormalisedLength;
                 float               _vEdgeNormalisedLength;
+                FluteScratch*       _fluteScratch;
 
     // Constructors & Destructors
     // **************************
@@ -127,6 +129,7 @@ namespace Knik {
             unsigned    getCongestEdgeNb        ( Segment* segment );
             size_t      getXSize                () const { return (_matrixVertex) ? _matrixVertex->getXSize() : 0; };
             size_t      getYSize                () const { return (_matrixVertex) ? _matrixVertex->getYSize() : 0; };
+            GridGraph*  getGridGraph            () const { return (_matrixVertex) ? _matrixVertex->getGridGraph() : NULL; };
             float       getHEdgeNormalisedLength() const { return _hEdgeNormalisedLength; };
             float       getVEdgeNormalisedLength() const { return _vEdgeNormalisedLength; };
 
@@ -142,18 +145,21 @@ namespace Knik {
             void   updateEdgesOccupancy   ( Segment* segment, bool add );
             void   rebuildConnexComponent ( Contact* contact, int connexID, Segment* arrivalSegment ); 
             void   setNetStampConnexID    ( Segment* segment, int connexID );
+            void   relabelConnexComp      ( Vertex* vertex, Edge* arrivalEdge, int connexID );
+            bool   patternRouteBranch     ( GridGraph* grid, Vertex* source, Vertex* target );
         public:
             Vertex* createVertex     ( Point position, DbU::Unit halfWidth, DbU::Unit halfHeight );
-            void   createHEdge       ( Vertex* from, Vertex* to, size_t reserved=0 );
-            void   createVEdge       ( Vertex* from, Vertex* to, size_t reserved=0 );
+            void   createHEdge       ( unsigned column, unsigned line, size_t reserved=0 );
+            void   createVEdge       ( unsigned column, unsigned line, size_t reserved=0 );
             void   resetVertexes     ()                    { _vertexes_to_route.clear(); };
             void   setNetStamp       ( unsigned netStamp ) { _netStamp = netStamp; };
             void   incNetStamp       ()                    { _netStamp++; };
             int    countVertexes     ( Net* net );
             int    initRouting       ( Net* net );
-            void   Dijkstra          ();
+            void   Dijkstra          ( bool updateEstimate = true );
+            bool   PatternRoute      ();
             void   Monotonic         ();
-            FTree* createFluteTree   ();
+            FTree  createFluteTree   ();
             void   CleanRoutingState ();
             void   UpdateEstimateCongestion ( bool create = false );
             void   UpdateMaxEstimateCongestion ();
@@ -0,0 +1,85 @@
+#ifndef _KNIK_GRIDGRAPH_H
+#define _KNIK_GRIDGRAPH_H
+
+#include <vector>
+#include <cstddef>
+
+namespace Hurricane {
+    class Segment;
+}
+
+namespace Knik {
+
+  using std::vector;
+  using Hurricane::Segment;
+
+  class Vertex;
+  class Edge;
+
+    // Dense storage of the regular routing grid.
+    //
+    // Vertexes are stored line by line, so the neighbours of a vertex are
+    // found by index arithmetic. The edges are numbered in the same way,
+    // horizontal edges first then vertical ones, and their routing state
+    // (capacity, occupancy, cost, ...) is kept in packed arrays indexed by
+    // the edge number. The Edge objects only hold that number and are kept
+    // for the Hurricane display and the Graph API. The segments crossing
+    // each edge are kept in a side table, allocated on demand.
+
+    class GridGraph {
+    // **************
+        friend class Edge;
+
+        // Attributes
+        // **********
+        private:
+            unsigned                  _xSize;
+            unsigned                  _ySize;
+            vector<Vertex*>           _vertexes;
+            vector<Edge*>             _edges;
+            vector<unsigned>          _capacities;
+            vector<unsigned>          _occupancies;
+            vector<float>             _estimates; // estimate occupancy while routing, historic cost during ripup & reroute.
+            vector<float>             _costs;
+            vector<int>               _connexIDs;
+            vector<unsigned>          _netStamps;
+            vector< vector<Segment*> > _segments;
+
+        // Constructors & Destructors
+        // **************************
+        public:
+            GridGraph ( unsigned xSize, unsigned ySize );
+
+        // Accessors
+        // *********
+        public:
+            unsigned  getXSize       () const { return _xSize; };
+            unsigned  getYSize       () const { return _ySize; };
+            size_t    getEdgesSize   () const { return _edges.size(); };
+            size_t    getHEdgesSize  () const { return (_xSize) ? (_xSize-1)*_ySize : 0; };
+            bool      isHEdgeIndex   ( size_t index ) const { return index < getHEdgesSize(); };
+            size_t    getVertexIndex ( unsigned column, unsigned line ) const { return (size_t)line*_xSize + column; };
+            size_t    getHEdgeIndex  ( unsigned column, unsigned line ) const { return (size_t)line*(_xSize-1) + column; };
+            size_t    getVEdgeIndex  ( unsigned column, unsigned line ) const { return getHEdgesSize() + (size_t)line*_xSize + column; };
+            Vertex*   getVertex      ( unsigned column, unsigned line ) const { return _vertexes[getVertexIndex(column,line)]; };
+            Edge*     getHEdge       ( unsigned column, unsigned line ) const { return (column+1 < _xSize) ? _edges[getHEdgeIndex(column,line)] : NULL; };
+            Edge*     getVEdge       ( unsigned column, unsigned line ) const { return (line+1 < _ySize) ? _edges[getVEdgeIndex(column,line)] : NULL; };
+            Edge*     getEdge        ( size_t index ) const { return _edges[index]; };
+            unsigned  getCapacity    ( size_t index ) const { return _capacities[index]; };
+            unsigned  getOccupancy   ( size_t index ) const { return _occupancies[index]; };
+            float     getEstimate    ( size_t index ) const { return _estimates[index]; };
+            unsigned  getOverflow    ( size_t index ) const { return (_occupancies[index] > _capacities[index]) ? _occupancies[index]-_capacities[index] : 0; };
+            const vector<Segment*>& getSegments ( size_t index ) const { return _segments[index]; };
+            size_t    getMemorySize  () const;
+
+        // Modifiers
+        // *********
+        public:
+            void      setVertex      ( unsigned column, unsigned line, Vertex* vertex ) { _vertexes[getVertexIndex(column,line)] = vertex; };
+            void      setEdge        ( size_t index, Edge* edge, unsigned capacity );
+            void      addEstimate    ( size_t index, float increment ) { _estimates[index] += increment; };
+    };
+
+} // namespace Knik
+
+#endif  // _KNIK_GRIDGRAPH_H
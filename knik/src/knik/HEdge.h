@@ -15,13 +15,11 @@ namespace Knik {
         // Constructors & Destructors
         // **************************
         protected:
-            HEdge ( Vertex* from, Vertex* to );
-            HEdge ( Vertex* from, Vertex* to, unsigned capacity );
+            HEdge ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity );
             ~HEdge ();
 
         public:
-            static HEdge* create ( Vertex* from, Vertex* to );
-            static HEdge* create ( Vertex* from, Vertex* to, unsigned capacity );
+            static HEdge* create ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity );
             //void destroy();
             void _postCreate ();
             //void _preDestroy();
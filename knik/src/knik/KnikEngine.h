@@ -210,6 +210,7 @@ typedef vector<NetRecord> NetVector;
                 void        getHorizontalCutLines     ( vector<DbU::Unit>& horizontalCutLines );
                 void        getVerticalCutLines       ( vector<DbU::Unit>& verticalCutLines );
                 void        saveSolution              ( const string& fileName="" );
+                void        saveCongestionMap         ( const string& fileName="" );
                 void        loadSolution              ( const string& fileName="" );
                 string      _getSolutionName          () const;
         virtual Record*     _getRecord                () const;
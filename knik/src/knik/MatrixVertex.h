@@ -8,6 +8,7 @@
 #include "hurricane/Error.h"
 
 #include "knik/RoutingGrid.h"
+#include "knik/GridGraph.h"
 
 namespace Knik {
 
@@ -40,7 +41,7 @@ namespace Knik {
             DbU::Unit _tileHeight;
             Box       _boundingBox;
             Graph*    _routingGraph;
-            vector< vector<Vertex*> >     _matrix;
+            GridGraph*                    _grid;
             vector< pair<DbU::Unit,unsigned> > _linesIndexes;
             vector< pair<DbU::Unit,unsigned> > _columnsIndexes;
 
@@ -72,8 +73,9 @@ namespace Knik {
         public:
             DbU::Unit  getTileWidth () const { return _tileWidth; }
             DbU::Unit  getTileHeight () const { return _tileHeight; }
-            size_t getXSize () const { return _matrix[0].size(); };
-            size_t getYSize () const { return _matrix.size(); };
+            GridGraph* getGridGraph () const { return _grid; };
+            size_t getXSize () const { return _grid->getXSize(); };
+            size_t getYSize () const { return _grid->getYSize(); };
             unsigned int getLineIndex   ( DbU::Unit y );
             unsigned int getColumnIndex ( DbU::Unit x );
             pair<unsigned int,unsigned int> getIJ ( DbU::Unit x, DbU::Unit y );
@@ -82,8 +84,8 @@ namespace Knik {
             Vertex* getVertex ( Point point );
             Vertex* getVertex ( DbU::Unit x, DbU::Unit y );
             Vertex* getVertexFromIndexes ( unsigned lineIdx, unsigned columnIdx );
-            bool isLineIndexValid   ( int lineIdx )   { if ( (lineIdx >= 0)  &&(lineIdx < (int)_matrix.size()) )      return true; else return false; };
-            bool isColumnIndexValid ( int columnIdx ) { if ( (columnIdx >= 0)&&(columnIdx < (int)_matrix[0].size()) ) return true; else return false; };
+            bool isLineIndexValid   ( int lineIdx )   { if ( (lineIdx >= 0)  &&(lineIdx < (int)_grid->getYSize()) )      return true; else return false; };
+            bool isColumnIndexValid ( int columnIdx ) { if ( (columnIdx >= 0)&&(columnIdx < (int)_grid->getXSize()) ) return true; else return false; };
 
         // Others
         // ******
@@ -15,13 +15,11 @@ namespace Knik {
         // Constructors & Destructors
         // **************************
         protected:
-            VEdge ( Vertex* from, Vertex* to );
-            VEdge ( Vertex* from, Vertex* to, unsigned capacity );
+            VEdge ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity );
             ~VEdge ();
 
         public:
-            static VEdge* create ( Vertex* from, Vertex* to );
-            static VEdge* create ( Vertex* from, Vertex* to, unsigned capacity );
+            static VEdge* create ( GridGraph* grid, size_t index, Vertex* from, Vertex* to, unsigned capacity );
             //void destroy();
             void _postCreate ();
             //void _preDestroy();
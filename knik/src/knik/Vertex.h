@@ -27,7 +27,7 @@ namespace Knik {
         private:
             static const Name    _extensionName;
                    Graph*        _routingGraph;
-                   Edge*         _firstEdges[4]; // dans l'ordre : _hEdgeOut, _vEdgeOut, _hEdgeIn et _vEdgeIn
+                   Edge*         _firstEdges[4]; // dans l'ordre : _hEdgeOut, _vEdgeOut, _hEdgeIn et _vEdgeIn (grille reguliere : une seule edge par direction)
                    Edge*         _predecessor;
                    Contact*      _contact;
                    Point         _position;
@@ -37,7 +37,6 @@ namespace Knik {
                    unsigned      _netStamp;
                    DbU::Unit     _halfWidth;     // this corresponds to the half width of dual bin of the vertex
                    DbU::Unit     _halfHeight;    // this corresponds to the half height of dual bin of the vertex
-                   Box           _boundingBox;
                    unsigned int  _flags;
                  
         // Constructors & Destructors
@@ -66,7 +65,6 @@ namespace Knik {
             void     setNetStamp       ( unsigned netStamp ) { _netStamp = netStamp; };
             void     setVTuple         ( VTuple* vtuple )    { _vtuple = vtuple; };
             void     attachToLocalRing ( Component* component );
-            void     sortEdges         ();
             void     setBlocked        () { _flags |=  Blocked; }
             void     resetBlocked      () { _flags &= ~Blocked; }
 
@@ -100,7 +100,7 @@ void Bin::addInstance(unsigned instanceid)
     _instanceOccurrenceIds.push_back(instanceid);
     DbU::Unit insWidth = _mauka->_instanceWidths[instanceid];
     _AddSize(insWidth);
-    _mauka->_simAnnealingPlacer->_instanceBins[instanceid] = this;
+    _mauka->_simAnnealingPlacer->_setInstanceIdBin(instanceid, this);
 }
 
 void Bin::_AddSize(DbU::Unit value)
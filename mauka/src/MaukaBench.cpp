@@ -0,0 +1,209 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |        M a u k a  -  S i m u l a t e d   A n n e a l i n g      |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./MaukaBench.cpp"                         |
+// +-----------------------------------------------------------------+
+
+
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <iomanip>
+using namespace std;
+
+#include <boost/program_options.hpp>
+namespace bopts = boost::program_options;
+
+#include "vlsisapd/configuration/Configuration.h"
+#include "hurricane/Warning.h"
+#include "hurricane/Error.h"
+#include "hurricane/DataBase.h"
+#include "hurricane/Cell.h"
+using namespace Hurricane;
+
+#include "crlcore/Utilities.h"
+#include "crlcore/Banner.h"
+#include "crlcore/AllianceFramework.h"
+using namespace CRL;
+
+#include "nimbus/NimbusEngine.h"
+#include "mauka/Move.h"
+#include "mauka/SimAnnealingPlacer.h"
+#include "mauka/MaukaEngine.h"
+using namespace Mauka;
+
+
+// -------------------------------------------------------------------
+// Mauka move replay.
+//
+// Replays a fixed, seeded sequence of annealing moves on a netlist and
+// reports the throughput of the move evaluation (Move::Next() and the
+// three cost deltas, then accept() or Reject()). A positive move is
+// accepted with a fixed probability instead of following a temperature
+// schedule, so two revisions replay exactly the same sequence.
+//
+// Every --check moves, the running net cost (the sum of the incremental
+// deltas) is compared against a full recomputation from the Bin centers
+// (SimAnnealingPlacer::DebugNetCost()). Checks are not timed.
+
+
+int main ( int argc, char *argv[] )
+{
+  int returnCode = 0;
+
+  try {
+    Banner banner( "Mauka Bench"
+                 , "1.0"
+                 , "Simulated Annealing Move Replay"
+                 , "2026"
+                 , "agent"
+                 , ""
+                 );
+
+    string        cellName;
+    unsigned long movesNb;
+    unsigned long checkPeriod;
+    unsigned int  seed;
+    double        acceptRatio;
+    bool          verbose1;
+    bool          verbose2;
+
+    bopts::options_description options ("Command line arguments & options");
+    options.add_options()
+      ( "help,h"         , "Print this help." )
+      ( "verbose,v"      , bopts::bool_switch(&verbose1)->default_value(false)
+                         , "First level of verbosity.")
+      ( "very-verbose,V" , bopts::bool_switch(&verbose2)->default_value(false)
+                         , "Second level of verbosity.")
+      ( "cell,c"         , bopts::value<string>(&cellName)
+                         , "The netlist to replay the moves on." )
+      ( "moves,n"        , bopts::value<unsigned long>(&movesNb)->default_value(3000000)
+                         , "Number of moves to replay." )
+      ( "check"          , bopts::value<unsigned long>(&checkPeriod)->default_value(100000)
+                         , "Check the incremental net cost every N moves (0: never)." )
+      ( "accept"         , bopts::value<double>(&acceptRatio)->default_value(0.3)
+                         , "Probability of accepting a move that increases the cost." )
+      ( "seed,s"         , bopts::value<unsigned int>(&seed)->default_value(1)
+                         , "Seed of the move generator." );
+
+    bopts::variables_map arguments;
+    bopts::store  ( bopts::parse_command_line(argc,argv,options), arguments );
+    bopts::notify ( arguments );
+
+    if (arguments.count("help") or not arguments.count("cell")) {
+      cout << banner << endl;
+      cout << options << endl;
+      exit( arguments.count("help") ? 0 : 1 );
+    }
+
+    Cfg::Configuration::pushDefaultPriority( Cfg::Parameter::CommandLine );
+    if (verbose1) Cfg::getParamBool("misc.verboseLevel1")->setBool( true );
+    if (verbose2) Cfg::getParamBool("misc.verboseLevel2")->setBool( true );
+    Cfg::Configuration::popDefaultPriority();
+
+    cmess1 << banner << endl;
+
+    dbo_ptr<DataBase>          db ( DataBase::create() );
+    dbo_ptr<AllianceFramework> af ( AllianceFramework::create() );
+
+    Cell* cell = af->getCell( cellName, Catalog::State::Views );
+    if (not cell)
+      throw Error( "Unable to load cell \"%s\".", cellName.c_str() );
+
+    if (not Nimbus::NimbusEngine::get(cell)) Nimbus::NimbusEngine::create( cell );
+
+    srand( seed );
+    MaukaEngine*        mauka   = MaukaEngine::create( cell );
+    SimAnnealingPlacer* placer  = mauka->getSimAnnealingPlacer();
+    double              netCost = placer->getNetCost();
+    Move                move    ( placer );
+
+    typedef chrono::steady_clock  Clock;
+    double        elapsed  = 0.0;
+    unsigned long done     = 0;
+    unsigned long accepted = 0;
+    double        maxError = 0.0;
+
+    cmess1 << "  o  Replaying " << movesNb << " moves (seed:" << seed << ")." << endl;
+
+    while ( done < movesNb ) {
+      unsigned long     batch = (checkPeriod) ? std::min( checkPeriod, movesNb-done ) : movesNb;
+      Clock::time_point start = Clock::now();
+
+      unsigned long i = 0;
+      for ( ; i<batch ; ++i ) {
+        if (not move.Next(1.0)) break;
+
+        double deltaRowCost = move.getDeltaRowCost();
+        double deltaBinCost = move.getDeltaBinCost();
+        double deltaNetCost = move.getDeltaNetCost();
+        double deltaCost    = placer->computeCost( deltaRowCost, deltaBinCost, deltaNetCost );
+
+        if ( (deltaCost <= 0.0) or ((rand() / (RAND_MAX+1.0)) < acceptRatio) ) {
+          move.accept();
+          netCost += deltaNetCost;
+          ++accepted;
+        } else
+          move.Reject();
+      }
+
+      elapsed += chrono::duration<double>( Clock::now() - start ).count();
+      done    += i;
+      if (i < batch) {
+        cerr << Warning( "No more move possible after %lu moves.", done ) << endl;
+        break;
+      }
+
+      if (checkPeriod) {
+        double reference = placer->DebugNetCost();
+        double error     = fabs( netCost - reference ) / std::max( 1.0, fabs(reference) );
+        maxError = std::max( maxError, error );
+        cmess2 << "     - " << setw(9) << done << " moves, net cost " << netCost
+               << " (full recompute " << reference << ")" << endl;
+        if (error > 1e-6) {
+          cerr << Error( "Incremental net cost drifted after %lu moves: %f vs. %f."
+                       , done, netCost, reference ) << endl;
+          returnCode = 2;
+          break;
+        }
+      }
+    }
+
+    cmess1 << Dots::asULong ( "     - Replayed moves"          , done     ) << endl;
+    cmess1 << Dots::asULong ( "     - Accepted moves"          , accepted ) << endl;
+    cmess1 << Dots::asDouble( "     - Evaluation time (s)"     , elapsed  ) << endl;
+    if (elapsed > 0.0)
+      cmess1 << Dots::asDouble( "     - Moves per second"      , done / elapsed ) << endl;
+    if (checkPeriod)
+      cmess1 << Dots::asDouble( "     - Max relative cost error" , maxError ) << endl;
+
+    mauka->destroy();
+  }
+  catch ( Error& e ) {
+    cerr << e.what() << endl;
+    returnCode = 1;
+  }
+  catch ( bopts::error& e ) {
+    cerr << "[ERROR] " << e.what() << endl;
+    returnCode = 1;
+  }
+  catch ( exception& e ) {
+    cerr << "[ERROR] " << e.what() << endl;
+    returnCode = 1;
+  }
+  catch ( ... ) {
+    cerr << "[ERROR] Unknown exception." << endl;
+    returnCode = 2;
+  }
+
+  return returnCode;
+}
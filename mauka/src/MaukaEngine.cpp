@@ -134,11 +134,16 @@ void MaukaEngine::Run()
 
     Timer timer;
     timer.start();
+    unsigned initialMoves = _simAnnealingPlacer->getMoves();
     while ( _simAnnealingPlacer->Iterate() );
 
     timer.stop();
     _simAnnealingPlacer->DisplayResults();
 
+    double moves = (double)(_simAnnealingPlacer->getMoves() - initialMoves);
+    if ( timer.getCombTime() > 0.0 )
+      cmess2 << Dots::asDouble("     - Moves per second",moves / timer.getCombTime()) << endl;
+
   //if ( doPlotBins() ) PlotBinsStats();
 
     cmess1 << "  o  Simulated annealing took " << Timer::getStringTime(timer.getCombTime()) 
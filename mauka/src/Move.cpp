@@ -34,6 +34,7 @@
 //
 // Authors-Tag 
 #include <cmath>
+#include <algorithm>
 #include <cstdlib>
 #include <climits>
 
@@ -93,6 +94,7 @@ Move::Move(SimAnnealingPlacer* simannealingplacer)
     , _dstIns(0)
     , _dstWidth(0)
     , _affectedNets()
+    , _newNetBBoxes()
 {}
 
 double Move::getDeltaRowCost() const
@@ -145,31 +147,36 @@ double Move::getDeltaNetCost()
 {
     // Find affected nets
     // ==================
+    // Both nets lists are sorted, the nets shared by the two instances
+    // end up with the NetSrcDst flag once merged.
     _affectedNets.clear();
-    for (MaukaEngine::UVector::const_iterator uvit = _mauka->_instanceNets[_srcIns].begin();
-            uvit != _mauka->_instanceNets[_srcIns].end();
-            uvit++)
-    {
-        _affectedNets[*uvit] = NetSrc;
-    }
+    _newNetBBoxes.clear();
+    const MaukaEngine::UVector& netStarts = _simAnnealingPlacer->_instanceNetStarts;
+    const MaukaEngine::UVector& netIds    = _simAnnealingPlacer->_instanceNetIds;
+    for (unsigned i = netStarts[_srcIns]; i < netStarts[_srcIns+1]; i++)
+        _affectedNets.push_back(make_pair(netIds[i], NetSrc));
 
     if (_exchange)
     {
-        for (MaukaEngine::UVector::const_iterator uvit = _mauka->_instanceNets[_dstIns].begin();
-                uvit != _mauka->_instanceNets[_dstIns].end();
-                uvit++)
+        size_t srcNetsCount = _affectedNets.size();
+        for (unsigned i = netStarts[_dstIns]; i < netStarts[_dstIns+1]; i++)
+            _affectedNets.push_back(make_pair(netIds[i], NetDst));
+        inplace_merge(_affectedNets.begin(), _affectedNets.begin() + srcNetsCount, _affectedNets.end());
+
+        size_t merged = 0;
+        for (size_t i = 0; i < _affectedNets.size(); i++)
         {
-            unsigned netId = *uvit;
-            if (_affectedNets.find(netId) == _affectedNets.end())
-                _affectedNets[netId] = NetDst;
+            if (merged && (_affectedNets[merged-1].first == _affectedNets[i].first))
+                _affectedNets[merged-1].second |= _affectedNets[i].second;
             else
-                if (_affectedNets[netId] != NetDst)
-                _affectedNets[netId] = NetSrcDst;
+                _affectedNets[merged++] = _affectedNets[i];
         }
+        _affectedNets.resize(merged);
     }
     
     // compute delta
     // =============
+    // Instances are already in their new bins (see TryMove()).
 
     double delta = 0.0;
     for (AffectedNets::iterator anit = _affectedNets.begin();
@@ -178,127 +185,20 @@ double Move::getDeltaNetCost()
     {
         unsigned netId = anit->first;
         unsigned flag = anit->second;
-        double& netCost = _simAnnealingPlacer->_getNetIdCost(netId);
-        //cerr << "netCost " << netCost << endl;
-        double& netTmpCost = _simAnnealingPlacer->_getNetIdTmpCost(netId);
-        //cerr << "netTmpCost " << netTmpCost << endl; 
-        Box& currBox = _simAnnealingPlacer->_getNetIdBBox(netId);
-        Box& tmpBox  = _simAnnealingPlacer->_getNetTmpBBox(netId);
-        //cerr << "before" << endl;
-        //cerr << "currBox " << currBox << endl;
-        //cerr << "tmpBox " << tmpBox << endl;
-	
-        if (flag == NetSrc)
-        {
-            tmpBox = currBox;
-            if ((tmpBox = Update(tmpBox , _srcBin->getCenter(), _dstBin->getCenter())).isEmpty())
-            {
-                for (MaukaEngine::UVector::const_iterator uvit = _mauka->_netInstances[netId].begin();
-                        uvit != _mauka->_netInstances[netId].end();
-                        uvit++)
-                {
-                    unsigned instanceId = *uvit;
-                    Bin* bin = _simAnnealingPlacer->_instanceBins[instanceId];
-                    tmpBox.merge(bin->getCenter().getX(), bin->getCenter().getY());
-                }
-            }
+        if (flag == NetSrcDst)
+            continue;
 
-            if (_mauka->_hasInitX[netId])
-                tmpBox.merge(_mauka->_netInitX[netId], tmpBox.getYMin());
-            if (_mauka->_hasInitY[netId])
-                tmpBox.merge(tmpBox.getXMin(), _mauka->_netInitY[netId]);
- 
-            DbU::Unit width = tmpBox.getWidth();
-            if (width == 0)
-            {
-                width = _srcBin->getWidth() / 2;
-            }
-            netTmpCost = DbU::getLambda(tmpBox.getHeight() + width);
-#if 0
-            cerr << "tmpBox " << tmpBox <<endl;
-            cerr << "  SrcPos     = " << _srcBin->getCenter() << endl;
-            cerr << "  DstPos     = " << _dstBin->getCenter() << endl;
-            cerr << "netTmpCost(netSrc) " << netTmpCost << endl << endl;
-#endif
-            delta += netTmpCost - netCost;
-            
-#if 0 // code pour debug .... 
-	    Box checkBox;
-            for (MaukaEngine::UVector::const_iterator uvit = _mauka->_netInstances[netId].begin();
-                    uvit != _mauka->_netInstances[netId].end();
-                    uvit++)
-	    {
-                unsigned instanceId = *uvit;
-                Bin* bin = _mauka->_instanceBins[instanceId];
-                checkBox.merge(bin->getCenter().getX(), bin->getCenter().getY());
-	    }
-
-	    if (checkBox != tmpBox) {
-            cout << "error: mauvaise bbox : NetSrc" << endl;
-            cout << "  checkBox = " << checkBox << endl;
-            cout << "  tmpBox   = " << tmpBox << endl;
-            cout << "  CurrBBox   = " << currBox  << endl;
-            cout << "  SrcPos     = " << _srcBin->getCenter() << endl;
-            cout << "  DstPos     = " << _dstBin->getCenter() << endl;
-            exit(1);
-	    }
-#endif
-        }
-        else
-            if (flag == NetDst)
-            {
-                tmpBox = currBox;
-                if ((tmpBox = Update(tmpBox , _dstBin->getCenter(), _srcBin->getCenter())).isEmpty())
-                {
-                    for (MaukaEngine::UVector::const_iterator uvit = _mauka->_netInstances[netId].begin();
-                            uvit != _mauka->_netInstances[netId].end();
-                            uvit++)
-                    {
-                        Bin* bin = _simAnnealingPlacer->_instanceBins[*uvit];
-                        tmpBox.merge(bin->getCenter().getX(), bin->getCenter().getY());
-                    }
-                }
-                if (_mauka->_hasInitX[netId])
-                    tmpBox.merge(_mauka->_netInitX[netId], tmpBox.getYMin());
-                if (_mauka->_hasInitY[netId])
-                    tmpBox.merge(tmpBox.getXMin(), _mauka->_netInitY[netId]);
-                DbU::Unit width = tmpBox.getWidth();
-                if (width == 0)
-                {
-                    width = _dstBin->getWidth() / 2;
-                }
-                netTmpCost = DbU::getLambda(tmpBox.getHeight() + width);
-#if 0
-                cerr << "netDst" << endl;
-                cerr << "width " << tmpBox.getWidth() << endl;
-                cerr << "height " << tmpBox.getHeight() << endl;
-                cerr << "netTmpCost(netDst) " << netTmpCost << endl << endl;
-#endif
-                delta += netTmpCost - netCost;
-#ifdef MOVE_DEBUG
-	    cout << "end" << endl;
-	    cout << "check" << endl;
-	    Box checkBox;
-	    for_each_plug(plug, net);
-	    {
-		Instance* ins = plug->getInstance(); 
-		SurfContainer* container = PGetContainer(*ins);
-		cout << container->getXCenter() << " " << container->getYCenter() << endl;
-		checkBox.merge(container->getXCenter(), container->getYCenter());
-		end_for;
-	    }
-
-	    if (checkBox != *PTmpBBox(*net)) {
-		cout << "error: mauvaise bbox : NetDst" << endl;
-		cout << "  check_bbox = " << checkBox << endl;
-		cout << "  TmpBBox   = " << PTmpBBox(*net) << endl;
-		cout << "  CurrentBBox   = " <<  PCurrentBBox(*net) << endl;
-		cout << "  SrcPos     = " << _dstBin->getPos() << endl;
-		cout << "  DstPos     = " << _srcBin->getPos() << endl;
-		exit(1);
-	    }
-#endif
-            }
+        Bin* fromBin = (flag == NetSrc) ? _srcBin : _dstBin;
+        Bin* toBin   = (flag == NetSrc) ? _dstBin : _srcBin;
+        const SimAnnealingPlacer::NetBBox& currBox = _simAnnealingPlacer->_getNetIdBBox(netId);
+
+        _newNetBBoxes.push_back(make_pair(netId, currBox));
+        SimAnnealingPlacer::NetBBox& tmpBox = _newNetBBoxes.back().second;
+        if (!tmpBox.movePin(fromBin->getCenter(), toBin->getCenter()))
+            _simAnnealingPlacer->_computeNetIdBBox(netId, tmpBox);
+
+        tmpBox._cost = tmpBox.computeCost(fromBin->getWidth() / 2);
+        delta += tmpBox._cost - currBox._cost;
     }
     return delta;
 }
@@ -509,16 +409,11 @@ void
 Move::accept()
 {
     // Sauvegarde des cout des nets
-    for (AffectedNets::iterator anit = _affectedNets.begin();
-            anit != _affectedNets.end();
-            anit++)
+    for (NetBBoxes::const_iterator nbit = _newNetBBoxes.begin();
+            nbit != _newNetBBoxes.end();
+            nbit++)
     {
-        unsigned netId = anit->first;
-        unsigned flag = anit->second;
-        if (flag == NetSrc || flag == NetDst)
-        {
-            _simAnnealingPlacer->_InvertNetIdFlag(netId);
-        }
+        _simAnnealingPlacer->_getNetIdBBox(nbit->first) = nbit->second;
     }
 }
 
@@ -35,6 +35,7 @@
 // Authors-Tag 
 
 #include <cmath>
+#include <algorithm>
 
 #include "hurricane/Warning.h"
 #include "hurricane/Cell.h"
@@ -81,9 +82,13 @@ SimAnnealingPlacer::SimAnnealingPlacer(MaukaEngine* mauka)
 // *******************************************************
     : _mauka(mauka)
     , _instanceBins()
+    , _instanceXs()
+    , _instanceYs()
+    , _netPinStarts()
+    , _netPins()
+    , _instanceNetStarts()
+    , _instanceNetIds()
     , _netBBoxes()
-    , _netCosts()
-    , _netFlags()
     , _netCost(0.0)
     , _binCost(0.0)
     , _rowCost(0.0)
@@ -103,20 +108,125 @@ SimAnnealingPlacer::SimAnnealingPlacer(MaukaEngine* mauka)
     , _surOccupationTargetMovementNumber(0)
     , _impossibleExchangeMovementNumber(0)
 {
-    for (unsigned i = 0; i < _mauka->_instanceOccurrencesVector.size(); i++)
+    unsigned instancesCount = _mauka->_instanceOccurrencesVector.size();
+    _instanceBins.assign(instancesCount, NULL);
+    _instanceXs.assign(instancesCount, 0);
+    _instanceYs.assign(instancesCount, 0);
+
+    // Flat, duplicate free, copies of the netlist: a move only walks
+    // through contiguous arrays.
+    _netPinStarts.push_back(0);
+    for (unsigned netid = 0; netid < _mauka->_netInstances.size(); netid++)
+    {
+        MaukaEngine::UVector pins(_mauka->_netInstances[netid]);
+        sort(pins.begin(), pins.end());
+        pins.erase(unique(pins.begin(), pins.end()), pins.end());
+        _netPins.insert(_netPins.end(), pins.begin(), pins.end());
+        _netPinStarts.push_back(_netPins.size());
+    }
+    _instanceNetStarts.push_back(0);
+    for (unsigned instanceid = 0; instanceid < instancesCount; instanceid++)
     {
-        _instanceBins.push_back(NULL);
+        MaukaEngine::UVector nets(_mauka->_instanceNets[instanceid]);
+        sort(nets.begin(), nets.end());
+        nets.erase(unique(nets.begin(), nets.end()), nets.end());
+        _instanceNetIds.insert(_instanceNetIds.end(), nets.begin(), nets.end());
+        _instanceNetStarts.push_back(_instanceNetIds.size());
     }
+    _netBBoxes.resize(_mauka->_netInstances.size());
+}
+
+SimAnnealingPlacer::NetBBox::NetBBox()
+    : _xMin(0)
+    , _xMax(0)
+    , _yMin(0)
+    , _yMax(0)
+    , _xMinCount(0)
+    , _xMaxCount(0)
+    , _yMinCount(0)
+    , _yMaxCount(0)
+    , _cost(0.0)
+{
+    clear();
+}
+
+void SimAnnealingPlacer::NetBBox::clear()
+{
+    _xMin = _yMin = DbU::Max;
+    _xMax = _yMax = DbU::Min;
+    _xMinCount = _xMaxCount = _yMinCount = _yMaxCount = 0;
+}
+
+void SimAnnealingPlacer::NetBBox::mergeX(DbU::Unit x)
+{
+    if (x < _xMin) { _xMin = x; _xMinCount = 1; } else if (x == _xMin) ++_xMinCount;
+    if (x > _xMax) { _xMax = x; _xMaxCount = 1; } else if (x == _xMax) ++_xMaxCount;
+}
+
+void SimAnnealingPlacer::NetBBox::mergeY(DbU::Unit y)
+{
+    if (y < _yMin) { _yMin = y; _yMinCount = 1; } else if (y == _yMin) ++_yMinCount;
+    if (y > _yMax) { _yMax = y; _yMaxCount = 1; } else if (y == _yMax) ++_yMaxCount;
+}
 
-    for (unsigned netid = 0; netid < _mauka->_nets.size(); netid++)
+namespace {
+
+// Moves one coordinate of a pin, returns false if the last pin of an
+// edge left it inward, in which case the box must be recomputed.
+bool moveCoordinate(DbU::Unit& min, unsigned& minCount, DbU::Unit& max, unsigned& maxCount, DbU::Unit src, DbU::Unit dst)
+{
+    if (src == dst)
+        return true;
+
+    bool lostMin = (src == min) && (--minCount == 0);
+    bool lostMax = (src == max) && (--maxCount == 0);
+
+    if (dst < min) { min = dst; minCount = 1; lostMin = false; } else if (dst == min) ++minCount;
+    if (dst > max) { max = dst; maxCount = 1; lostMax = false; } else if (dst == max) ++maxCount;
+
+    return !lostMin && !lostMax;
+}
+
+}
+
+bool SimAnnealingPlacer::NetBBox::movePin(const Point& src, const Point& dst)
+{
+    return moveCoordinate(_xMin, _xMinCount, _xMax, _xMaxCount, src.getX(), dst.getX())
+        && moveCoordinate(_yMin, _yMinCount, _yMax, _yMaxCount, src.getY(), dst.getY());
+}
+
+double SimAnnealingPlacer::NetBBox::computeCost(DbU::Unit emptyWidth) const
+{
+    DbU::Unit width = _xMax - _xMin;
+    if (width == 0)
     {
-        vector<Box> bboxes(2);
-        _netBBoxes.push_back(bboxes);
-        vector<double> costs(2);
-        _netCosts.push_back(costs);
-        _netFlags.push_back(0);
+        //all instances in the same bin...
+        //take for width half of the bin
+        width = emptyWidth;
     }
-    
+    return DbU::getLambda(_yMax - _yMin + width);
+}
+
+void SimAnnealingPlacer::_setInstanceIdBin(unsigned instanceid, Bin* bin)
+{
+    _instanceBins[instanceid] = bin;
+    _instanceXs[instanceid] = bin->getCenter().getX();
+    _instanceYs[instanceid] = bin->getCenter().getY();
+}
+
+void SimAnnealingPlacer::_computeNetIdBBox(unsigned netid, NetBBox& bbox) const
+{
+    bbox.clear();
+    for (unsigned i = _netPinStarts[netid]; i < _netPinStarts[netid+1]; i++)
+    {
+        unsigned instanceId = _netPins[i];
+        bbox.merge(_instanceXs[instanceId], _instanceYs[instanceId]);
+    }
+    // The fixed point acts as an extra pin that never moves.
+    if (_mauka->_hasInitX[netid])
+        bbox.mergeX(_mauka->_netInitX[netid]);
+    if (_mauka->_hasInitY[netid])
+        bbox.mergeY(_mauka->_netInitY[netid]);
 }
 
 void SimAnnealingPlacer::init()
@@ -298,108 +408,21 @@ double SimAnnealingPlacer::getNetCost()
 // ************************************
 {
     double totalNetCost = 0.0;
-    for (unsigned netid = 0; netid < _mauka->_netInstances.size(); netid++)
+    for (unsigned netid = 0; netid < _netBBoxes.size(); netid++)
     {
-        unsigned lastInstanceId = 0;
-        unsigned insCount = 0;
-        Box& netBBox = _netBBoxes[netid][_netFlags[netid]];
+        NetBBox& netBBox = _netBBoxes[netid];
+        netBBox._cost = 0.0;
+        _computeNetIdBBox(netid, netBBox);
 
-        double& netCost = _netCosts[netid][_netFlags[netid]];
-        netCost = 0.0;
-        for (MaukaEngine::UVector::const_iterator uvit = _mauka->_netInstances[netid].begin();
-                uvit != _mauka->_netInstances[netid].end();
-                uvit++)
-        {
-            unsigned instanceId = *uvit;
-            lastInstanceId = instanceId;
-            Bin* bin = _instanceBins[instanceId];
-            netBBox.merge(bin->getCenter().getX(), bin->getCenter().getY());
-            ++insCount;
-        }
-        if (_mauka->_hasInitX[netid])
-            netBBox.merge(_mauka->_netInitX[netid], netBBox.getYMin()); 
-        if (_mauka->_hasInitY[netid])
-            netBBox.merge(netBBox.getXMin(), _mauka->_netInitY[netid]); 
-        
-        if ( insCount == 0 )
+        if (_netPinStarts[netid] == _netPinStarts[netid+1])
         {
           cerr << Warning("Net <%s> is not connected.",getString(_mauka->_nets[netid]).c_str()) << endl;
         }
         else
         {
-            DbU::Unit width = 0;
-#if 0
-            if (_mauka->_params.takeSplittersIntoAccountOptimization)
-            {
-                Instance* instance = _instanceOccurrences[lastInstanceId]; 
-                Net* net = _nets[netid]; 
-                Plug* netPlug = NULL;
-                for_each_plug(plug, instance->getConnectedPlugs())
-                {
-                    Net* plugNet = plug->getNet();
-                    if (plugNet == net)
-                    {
-                        netPlug = plug;
-                        break;
-                    }
-                    end_for;
-                }
-                if (!netPlug)
-                    throw Error("MaukaEngine internal error: no plug");
-                Hook* bodyHook = netPlug->getBodyHook();
-                for_each_hook(hook, bodyHook->getHooks())
-                {
-                    Component* component = hook->getComponent();
-                    if (SplitterContact* splitterContact = dynamic_cast<SplitterContact*>(component))
-                    {
-                        if (VFence* vfence = dynamic_cast<VFence*>(splitterContact->getSplitter()->getFence()))
-                        {
-                            if (_hasInitX[netid])
-                                _hasInitX[netid] = false;
-                            else
-                            {
-                                _hasInitX[netid] = true;
-                                _netInitX[netid] = vfence->getX();
-                            }
-                        }
-                        else if (HFence* hfence = dynamic_cast<HFence*>(splitterContact->getSplitter()->getFence()))
-                        {
-                            if (_hasInitY[netid])
-                                _hasInitY[netid] = false;
-                            else
-                                {
-                                    _hasInitY[netid] = true;
-                                    _netInitY[netid] = hfence->getY();
-                                }
-                        }
-                        else throw Error("MaukaEngine internal error");
-                    }
-                    else if (Pin* pin = dynamic_cast<Pin*>(component))
-                    {
-                      if (not _mauka->odIgnorePins())
-                        {
-                            netBBox.merge(pin->getX(), pin->getY());
-                        }
-                    }
-                    end_for;
-                }
-                if (_hasInitX[netid])
-                    netBBox.merge(_netInitX[netid], netBBox.getYMin()); 
-                if (_hasInitY[netid])
-                    netBBox.merge(netBBox.getXMin(), _netInitY[netid]); 
-            }
-#endif
-            width = netBBox.getWidth();
-            if (width == 0)
-            {
-                //all instances in the same bin...
-                //take for width half of the bin
-                Bin* bin = _instanceBins[lastInstanceId];
-                width = bin->getWidth() / 2;
-            }
-            double cost = DbU::getLambda(netBBox.getHeight() + width);
-            netCost = cost;
-            totalNetCost += cost;
+            unsigned lastInstanceId = _netPins[_netPinStarts[netid+1]-1];
+            netBBox._cost = netBBox.computeCost(_instanceBins[lastInstanceId]->getWidth() / 2);
+            totalNetCost += netBBox._cost;
         }
     }
     return totalNetCost;
@@ -100,6 +100,8 @@ namespace Mauka {
       inline  void             setRefreshCb                  ( Configuration::RefreshCb_t cb );
       inline  DbU::Unit        getInstanceIdWidth            ( unsigned id ) const;
               unsigned         getRandomInstanceId           () const;
+      inline  SimAnnealingPlacer*
+                               getSimAnnealingPlacer         () const;
       virtual std::string      _getTypeName                  () const { return "Mauka::MaukaEngine"; }
       virtual Record*          _getRecord                    () const;
     // Mutators.               
@@ -161,6 +163,8 @@ namespace Mauka {
   inline  double           MaukaEngine::getAnnealingRowMult           () const { return _configuration->getAnnealingRowMult(); }
   inline  void             MaukaEngine::setRefreshCb                  ( Configuration::RefreshCb_t cb ) { _configuration->setRefreshCb(cb); }
   inline  DbU::Unit        MaukaEngine::getInstanceIdWidth            ( unsigned id ) const { return _instanceWidths[id]; }
+  inline  SimAnnealingPlacer*
+                           MaukaEngine::getSimAnnealingPlacer         () const { return _simAnnealingPlacer; }
   inline  void             MaukaEngine::addFeed                       ( Cell* cell ) { _feedCells.addFeed(cell); }
   
 
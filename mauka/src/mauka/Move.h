@@ -35,10 +35,11 @@
 // Authors-Tag 
 #ifndef __MOVE_H
 #define __MOVE_H
-#include <map>
+#include <vector>
 
 #include "hurricane/Instance.h"
 #include "hurricane/Net.h"
+#include "mauka/SimAnnealingPlacer.h"
 
 // ****************************************************************************************************
 // Move declaration
@@ -57,7 +58,8 @@ class Move {
 
 // Types
 // *****
-    public: typedef std::map<unsigned, unsigned> AffectedNets;
+    public: typedef std::vector< std::pair<unsigned, unsigned> > AffectedNets;
+    public: typedef std::vector< std::pair<unsigned, SimAnnealingPlacer::NetBBox> > NetBBoxes;
             
 // Attributes
 // **********
@@ -80,6 +82,7 @@ class Move {
     private: unsigned                   _dstIns;
     private: DbU::Unit                  _dstWidth;
     private: AffectedNets               _affectedNets;
+    private: NetBBoxes                  _newNetBBoxes;
 
 // Constructors
 // ************
@@ -42,6 +42,8 @@
 
 namespace Mauka {
 
+using Hurricane::Point;
+
 class MaukaEngine;
 class Bin;
 
@@ -55,14 +57,43 @@ class SimAnnealingPlacer {
 // Types
 // *****
    public: typedef std::vector<Bin*> InstanceBins;
+
+   // Bounding box of a net, with the number of pins lying on each of its
+   // edges. Moving a pin that is not alone on an edge updates the box in
+   // constant time, only the last pin leaving an edge needs a full rescan.
+   public: class NetBBox {
+        public: DbU::Unit _xMin;
+        public: DbU::Unit _xMax;
+        public: DbU::Unit _yMin;
+        public: DbU::Unit _yMax;
+        public: unsigned  _xMinCount;
+        public: unsigned  _xMaxCount;
+        public: unsigned  _yMinCount;
+        public: unsigned  _yMaxCount;
+        public: double    _cost;
+
+        public: NetBBox();
+        public: void clear();
+        public: void merge(DbU::Unit x, DbU::Unit y) { mergeX(x); mergeY(y); }
+        public: void mergeX(DbU::Unit x);
+        public: void mergeY(DbU::Unit y);
+        public: bool movePin(const Point& src, const Point& dst);
+        public: bool isEmpty() const { return _xMin > _xMax; }
+        public: double computeCost(DbU::Unit emptyWidth) const;
+   };
+   public: typedef std::vector<NetBBox> NetBBoxes;
     
 // Attributes
 // **********
     private: MaukaEngine*               _mauka;
     private: InstanceBins               _instanceBins;
-    private: MaukaEngine::BBoxes        _netBBoxes;
-    private: MaukaEngine::Costs         _netCosts;
-    private: MaukaEngine::UVector       _netFlags;
+    private: MaukaEngine::UnitVector    _instanceXs;       // Bins centers, copied for locality.
+    private: MaukaEngine::UnitVector    _instanceYs;
+    private: MaukaEngine::UVector       _netPinStarts;     // Flat copy of MaukaEngine::_netInstances.
+    private: MaukaEngine::UVector       _netPins;
+    private: MaukaEngine::UVector       _instanceNetStarts;// Flat copy of MaukaEngine::_instanceNets.
+    private: MaukaEngine::UVector       _instanceNetIds;
+    private: NetBBoxes                  _netBBoxes;
     private: double                     _netCost;
     private: double                     _binCost;
     private: double                     _rowCost;
@@ -91,10 +122,8 @@ class SimAnnealingPlacer {
 // *********
     public: double getNetCost();
     public: double getCost() const;
-    public: double& _getNetIdCost(unsigned netid) { return _netCosts[netid][_netFlags[netid]]; }
-    public: double& _getNetIdTmpCost(unsigned netid) { return _netCosts[netid][!_netFlags[netid]]; }
-    public: Box& _getNetIdBBox(unsigned netid) { return _netBBoxes[netid][_netFlags[netid]]; }
-    public: Box& _getNetTmpBBox(unsigned netid) { return _netBBoxes[netid][!_netFlags[netid]]; }
+    public: NetBBox& _getNetIdBBox(unsigned netid) { return _netBBoxes[netid]; }
+    public: void _computeNetIdBBox(unsigned netid, NetBBox& bbox) const;
     public: MaukaEngine* getMauka() { return _mauka; }
     public: unsigned getMoves() const { return _moves; }
     public: unsigned getRandInstance();
@@ -105,8 +134,7 @@ class SimAnnealingPlacer {
     private: bool accept(double deltacost) const;
     public: double DebugNetCost();
     public: void DisplayResults() const;
-    public: void _setInstanceIdBin(unsigned instanceid, Bin* bin) { _instanceBins[instanceid] = bin; }
-    public: void _InvertNetIdFlag(unsigned netid) { _netFlags[netid] = !_netFlags[netid]; }
+    public: void _setInstanceIdBin(unsigned instanceid, Bin* bin);
     public: double computeCost(double rowcost, double bincost, double netcost) const;
     public: void incrImpossibleExchangeMovementNumber() { ++_impossibleExchangeMovementNumber; }
     public: void incrSourceEqualTargetMovementNumber() { ++_sourceEqualTargetMovementNumber; }
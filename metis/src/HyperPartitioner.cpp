@@ -0,0 +1,766 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      M e t i s  -  h M e t i s   W r a p p e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Module  :       "./HyperPartitioner.cpp"                   |
+// +-----------------------------------------------------------------+
+
+
+#include  <algorithm>
+#include  <deque>
+#include  <limits>
+#include  <queue>
+#include  <random>
+#include  <utility>
+#include  <vector>
+#include  "hurricane/Commons.h"
+#include  "metis/Configuration.h"
+#include  "metis/HyperPartitioner.h"
+
+
+namespace {
+
+  using std::vector;
+  using std::pair;
+  using std::make_pair;
+  using std::min;
+  using std::max;
+  using std::priority_queue;
+  using Metis::Configuration;
+
+
+  const int  CoarsenTo       = 100;  // Stop coarsening below this number of vertices.
+  const int  MaxMatchedEdge  = 64;   // Larger hyperedges do not drive the matching.
+  const int  MaxFMPasses     = 8;
+
+
+// -------------------------------------------------------------------
+// Class  :  "HGraph".
+//
+// A (sub-)hypergraph in CSR form. _fixed is the side a vertex is
+// bound to during the current bisection (-1 when free).
+
+  class HGraph {
+    public:
+      inline int  getVertexCount () const { return _vwgts.size(); }
+      inline int  getEdgeCount   () const { return _ewgts.size(); }
+      inline long getTotalWeight () const { long w = 0; for ( int vw : _vwgts ) w += vw; return w; }
+             void buildIncidence ();
+    public:
+      vector<int>  _vwgts;
+      vector<int>  _fixed;
+      vector<int>  _eptr;
+      vector<int>  _eind;
+      vector<int>  _ewgts;
+      vector<int>  _vptr;
+      vector<int>  _vind;
+  };
+
+
+  void  HGraph::buildIncidence ()
+  {
+    _vptr.assign( getVertexCount()+1, 0 );
+    for ( int pin : _eind ) ++_vptr[pin+1];
+    for ( int v=0 ; v<getVertexCount() ; ++v ) _vptr[v+1] += _vptr[v];
+
+    vector<int> fill ( _vptr.begin(), _vptr.end()-1 );
+    _vind.resize( _eind.size() );
+    for ( int e=0 ; e<getEdgeCount() ; ++e ) {
+      for ( int i=_eptr[e] ; i<_eptr[e+1] ; ++i )
+        _vind[ fill[_eind[i]]++ ] = e;
+    }
+  }
+
+
+  int  computeCut ( const HGraph& g, const vector<int>& side )
+  {
+    int cut = 0;
+    for ( int e=0 ; e<g.getEdgeCount() ; ++e ) {
+      for ( int i=g._eptr[e]+1 ; i<g._eptr[e+1] ; ++i ) {
+        if (side[g._eind[i]] != side[g._eind[g._eptr[e]]]) { cut += g._ewgts[e]; break; }
+      }
+    }
+    return cut;
+  }
+
+
+// -------------------------------------------------------------------
+// First choice coarsening.
+//
+// Every vertex proposes the neighbour it shares the heaviest
+// connection with (weight/(size-1) over the common hyperedges, divided
+// by the merged weight). Proposals are independent and computed in
+// parallel, they are then resolved in vertex order: a vertex joins the
+// cluster of its proposal if the cluster is not too heavy and is not
+// bound to the other side.
+
+  HGraph  coarsen ( const HGraph& g, long maxWeight, vector<int>& cmap )
+  {
+    int         nvtxs     = g.getVertexCount();
+    vector<int> proposals ( nvtxs, -1 );
+
+#pragma omp parallel
+    {
+      vector<float> scores  ( nvtxs, 0.0 );
+      vector<int>   touched;
+
+#pragma omp for schedule(dynamic,256)
+      for ( int v=0 ; v<nvtxs ; ++v ) {
+        for ( int i=g._vptr[v] ; i<g._vptr[v+1] ; ++i ) {
+          int e    = g._vind[i];
+          int size = g._eptr[e+1] - g._eptr[e];
+          if (size > MaxMatchedEdge) continue;
+
+          float w = (float)g._ewgts[e] / (float)(size-1);
+          for ( int j=g._eptr[e] ; j<g._eptr[e+1] ; ++j ) {
+            int u = g._eind[j];
+            if (u == v) continue;
+            if ((g._fixed[u] >= 0) and (g._fixed[v] >= 0) and (g._fixed[u] != g._fixed[v])) continue;
+            if (g._vwgts[u] + g._vwgts[v] > maxWeight) continue;
+            if (scores[u] == 0.0) touched.push_back( u );
+            scores[u] += w;
+          }
+        }
+
+        float bestScore = 0.0;
+        for ( int u : touched ) {
+          float score = scores[u] / (float)(1 + g._vwgts[u] + g._vwgts[v]);
+          if ( (score > bestScore) or ((score == bestScore) and (u < proposals[v])) ) {
+            bestScore    = score;
+            proposals[v] = u;
+          }
+          scores[u] = 0.0;
+        }
+        touched.clear();
+      }
+    }
+
+    cmap.assign( nvtxs, -1 );
+    HGraph coarse;
+    for ( int v=0 ; v<nvtxs ; ++v ) {
+      if (cmap[v] >= 0) continue;
+
+      int u = proposals[v];
+      if (u >= 0) {
+        if (cmap[u] < 0) {
+          cmap[u] = coarse._vwgts.size();
+          coarse._vwgts.push_back( g._vwgts[u] );
+          coarse._fixed.push_back( g._fixed[u] );
+        }
+        int c = cmap[u];
+        if (    (coarse._vwgts[c] + g._vwgts[v] <= maxWeight)
+           and ((coarse._fixed[c] < 0) or (g._fixed[v] < 0) or (coarse._fixed[c] == g._fixed[v])) ) {
+          cmap[v]           = c;
+          coarse._vwgts[c] += g._vwgts[v];
+          coarse._fixed[c]  = max( coarse._fixed[c], g._fixed[v] );
+          continue;
+        }
+      }
+      cmap[v] = coarse._vwgts.size();
+      coarse._vwgts.push_back( g._vwgts[v] );
+      coarse._fixed.push_back( g._fixed[v] );
+    }
+
+  // Hyperedges whose pins all fall in one cluster disappear.
+    coarse._eptr.push_back( 0 );
+    vector<int> pins;
+    for ( int e=0 ; e<g.getEdgeCount() ; ++e ) {
+      pins.clear();
+      for ( int i=g._eptr[e] ; i<g._eptr[e+1] ; ++i ) pins.push_back( cmap[g._eind[i]] );
+      std::sort( pins.begin(), pins.end() );
+      pins.erase( std::unique(pins.begin(),pins.end()), pins.end() );
+      if (pins.size() < 2) continue;
+
+      coarse._eind.insert( coarse._eind.end(), pins.begin(), pins.end() );
+      coarse._eptr.push_back( coarse._eind.size() );
+      coarse._ewgts.push_back( g._ewgts[e] );
+    }
+    coarse.buildIncidence();
+
+    return coarse;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "FMRefiner".
+//
+// Two-way Fiduccia-Mattheyses. The gain buckets are replaced by one
+// max-heap per side with lazy deletion: an entry is discarded when it
+// no longer matches the current gain of its vertex. The best prefix of
+// each pass is kept, first minimizing the overweight, then the cut.
+
+  class FMRefiner {
+    public:
+                    FMRefiner  ( const HGraph&, const long maxWeights[2], int noImproveLimit );
+             int    refine     ( vector<int>& side );
+    private:
+             bool   _pass      ( vector<int>& side );
+      inline long   _overweight() const;
+             void   _addGain   ( int v, int delta );
+    private:
+      typedef priority_queue< pair<int,int> >  GainHeap;
+      const HGraph&  _g;
+      long           _maxWeights[2];
+      int            _noImproveLimit;
+      long           _weights[2];
+      int            _cut;
+      vector<int>    _counts;     // Pins of each hyperedge on side 0 & 1.
+      vector<int>    _gains;
+      vector<char>   _locked;
+      vector<int>*   _side;
+      GainHeap       _heaps[2];
+  };
+
+
+  FMRefiner::FMRefiner ( const HGraph& g, const long maxWeights[2], int noImproveLimit )
+    : _g             (g)
+    , _noImproveLimit(noImproveLimit)
+    , _cut           (0)
+    , _counts        ()
+    , _gains         ()
+    , _locked        ()
+    , _side          (NULL)
+  {
+    _maxWeights[0] = maxWeights[0];
+    _maxWeights[1] = maxWeights[1];
+    _weights   [0] = 0;
+    _weights   [1] = 0;
+  }
+
+
+  inline long  FMRefiner::_overweight () const
+  { return max(0L,_weights[0]-_maxWeights[0]) + max(0L,_weights[1]-_maxWeights[1]); }
+
+
+  void  FMRefiner::_addGain ( int v, int delta )
+  {
+    if (_locked[v]) return;
+    _gains[v] += delta;
+    _heaps[ (*_side)[v] ].push( make_pair(_gains[v],v) );
+  }
+
+
+  int  FMRefiner::refine ( vector<int>& side )
+  {
+    _side = &side;
+    for ( int pass=0 ; pass<MaxFMPasses ; ++pass ) {
+      if (not _pass(side)) break;
+    }
+    return computeCut( _g, side );
+  }
+
+
+  bool  FMRefiner::_pass ( vector<int>& side )
+  {
+    int nvtxs = _g.getVertexCount();
+    int nedges = _g.getEdgeCount();
+
+    _weights[0] = _weights[1] = 0;
+    for ( int v=0 ; v<nvtxs ; ++v ) _weights[ side[v] ] += _g._vwgts[v];
+
+    _cut = 0;
+    _counts.assign( 2*nedges, 0 );
+    for ( int e=0 ; e<nedges ; ++e ) {
+      for ( int i=_g._eptr[e] ; i<_g._eptr[e+1] ; ++i ) ++_counts[ 2*e + side[_g._eind[i]] ];
+      if (_counts[2*e] and _counts[2*e+1]) _cut += _g._ewgts[e];
+    }
+
+    _heaps[0] = GainHeap();
+    _heaps[1] = GainHeap();
+    _gains .assign( nvtxs, 0 );
+    _locked.assign( nvtxs, 0 );
+    for ( int v=0 ; v<nvtxs ; ++v ) {
+      if (_g._fixed[v] >= 0) { _locked[v] = 1; continue; }
+
+      int from = side[v];
+      for ( int i=_g._vptr[v] ; i<_g._vptr[v+1] ; ++i ) {
+        int e = _g._vind[i];
+        if (_counts[2*e+from  ] == 1) _gains[v] += _g._ewgts[e];
+        if (_counts[2*e+1-from] == 0) _gains[v] -= _g._ewgts[e];
+      }
+      _heaps[from].push( make_pair(_gains[v],v) );
+    }
+
+    vector<int> moves;
+    int         startCut   = _cut;
+    long        startOver  = _overweight();
+    int         bestCut    = _cut;
+    long        bestOver   = startOver;
+    size_t      bestPrefix = 0;
+
+    while ( true ) {
+      int candidates[2] = { -1, -1 };
+      for ( int from=0 ; from<2 ; ++from ) {
+        GainHeap& heap = _heaps[from];
+        while ( not heap.empty() ) {
+          int v = heap.top().second;
+          if (_locked[v] or (side[v] != from) or (heap.top().first != _gains[v])) { heap.pop(); continue; }
+          break;
+        }
+        if (heap.empty()) continue;
+
+        int v = heap.top().second;
+        if (    (_weights[1-from] + _g._vwgts[v] <= _maxWeights[1-from])
+             or (_weights[from] > _maxWeights[from]) )
+          candidates[from] = v;
+      }
+      if ((candidates[0] < 0) and (candidates[1] < 0)) break;
+
+      int from = 0;
+      if (candidates[0] < 0) from = 1;
+      else if (candidates[1] >= 0) {
+        int g0 = _gains[candidates[0]];
+        int g1 = _gains[candidates[1]];
+        if ( (g1 > g0) or ((g1 == g0) and (_weights[1] > _weights[0])) ) from = 1;
+      }
+      int v  = candidates[from];
+      int to = 1 - from;
+      _heaps[from].pop();
+
+      _cut -= _gains[v];
+      _locked[v] = 1;
+      side[v]    = to;
+      _weights[from] -= _g._vwgts[v];
+      _weights[to  ] += _g._vwgts[v];
+      moves.push_back( v );
+
+      for ( int i=_g._vptr[v] ; i<_g._vptr[v+1] ; ++i ) {
+        int e  = _g._vind[i];
+        int w  = _g._ewgts[e];
+        int b  = _g._eptr[e];
+        int en = _g._eptr[e+1];
+
+        if (_counts[2*e+to] == 0) {
+          for ( int j=b ; j<en ; ++j ) _addGain( _g._eind[j], w );
+        } else if (_counts[2*e+to] == 1) {
+          for ( int j=b ; j<en ; ++j )
+            if ((_g._eind[j] != v) and (side[_g._eind[j]] == to)) { _addGain( _g._eind[j], -w ); break; }
+        }
+        --_counts[2*e+from];
+        ++_counts[2*e+to  ];
+        if (_counts[2*e+from] == 0) {
+          for ( int j=b ; j<en ; ++j ) _addGain( _g._eind[j], -w );
+        } else if (_counts[2*e+from] == 1) {
+          for ( int j=b ; j<en ; ++j )
+            if (side[_g._eind[j]] == from) { _addGain( _g._eind[j], w ); break; }
+        }
+      }
+
+      long over = _overweight();
+      if ( (over < bestOver) or ((over == bestOver) and (_cut < bestCut)) ) {
+        bestOver   = over;
+        bestCut    = _cut;
+        bestPrefix = moves.size();
+      } else if (moves.size() - bestPrefix > (size_t)_noImproveLimit)
+        break;
+    }
+
+    for ( size_t i=moves.size() ; i>bestPrefix ; --i ) side[ moves[i-1] ] = 1 - side[ moves[i-1] ];
+
+    return (bestOver < startOver) or (bestCut < startCut);
+  }
+
+
+// -------------------------------------------------------------------
+// Initial bisection by region growing.
+//
+// Side 1 is grown breadth first, starting from the neighbours of the
+// vertices already bound to it (or from a random vertex), until it
+// reaches its target weight.
+
+  void  growBisection ( const HGraph& g, long target1, std::mt19937& rng, vector<int>& side )
+  {
+    int          nvtxs   = g.getVertexCount();
+    long         weight1 = 0;
+    vector<char> queued  ( nvtxs, 0 );
+    vector<int>  queue;
+    vector<int>  order;
+
+    side.assign( nvtxs, 0 );
+    for ( int v=0 ; v<nvtxs ; ++v ) {
+      if (g._fixed[v] >= 0) {
+        side[v] = g._fixed[v];
+        if (side[v] == 1) { weight1 += g._vwgts[v]; queue.push_back( v ); queued[v] = 1; }
+      } else
+        order.push_back( v );
+    }
+    std::shuffle( order.begin(), order.end(), rng );
+
+    size_t head = 0;
+    size_t next = 0;
+    while ( weight1 < target1 ) {
+      if (head == queue.size()) {
+        while ( (next < order.size()) and queued[order[next]] ) ++next;
+        if (next == order.size()) break;
+        queue.push_back( order[next] );
+        queued[order[next]] = 1;
+      }
+
+      int v = queue[head++];
+      if ((g._fixed[v] < 0) and (side[v] == 0)) {
+        if (weight1 + g._vwgts[v] > target1 + g._vwgts[v]/2) continue;
+        side[v]  = 1;
+        weight1 += g._vwgts[v];
+      }
+      for ( int i=g._vptr[v] ; i<g._vptr[v+1] ; ++i ) {
+        int e = g._vind[i];
+        for ( int j=g._eptr[e] ; j<g._eptr[e+1] ; ++j ) {
+          int u = g._eind[j];
+          if (not queued[u] and (g._fixed[u] < 0)) { queued[u] = 1; queue.push_back( u ); }
+        }
+      }
+    }
+  }
+
+
+// -------------------------------------------------------------------
+// Multilevel bisection, frac0 being the share of side 0.
+
+  struct BisectionParameters {
+    int       _nruns;
+    int       _noImproveLimit;
+    unsigned  _seed;
+  };
+
+
+  void  bisect ( const HGraph& fine, double frac0, int ubFactor, const BisectionParameters& params, vector<int>& side )
+  {
+    long totalWeight = fine.getTotalWeight();
+    long maxVWeight  = 0;
+    for ( int vw : fine._vwgts ) maxVWeight = max( maxVWeight, (long)vw );
+
+    long maxWeights[2];
+    maxWeights[0] = max( (long)(frac0    *totalWeight*(1.0+ubFactor/50.0)), (long)(frac0    *totalWeight)+1 );
+    maxWeights[1] = max( (long)((1-frac0)*totalWeight*(1.0+ubFactor/50.0)), (long)((1-frac0)*totalWeight)+1 );
+
+  // A deque, so that current stays valid while levels are added.
+    std::deque<HGraph>    levels;
+    vector< vector<int> > cmaps;
+    const HGraph*         current = &fine;
+    long                  maxClusterWeight = max( maxVWeight, (3*totalWeight)/(2*CoarsenTo) );
+
+    while ( current->getVertexCount() > CoarsenTo ) {
+      vector<int> cmap;
+      HGraph coarse = coarsen( *current, maxClusterWeight, cmap );
+      if (coarse.getVertexCount() * 10 > current->getVertexCount() * 9) break;
+
+      levels.push_back( coarse );
+      cmaps .push_back( cmap );
+      current = &levels.back();
+    }
+
+  // Initial bisection: independent tries, the best one is kept.
+    int         nruns      = max( 1, params._nruns );
+    vector<int> cuts       ( nruns, 0 );
+    vector<long> overs     ( nruns, 0 );
+    vector< vector<int> > tries ( nruns );
+
+#pragma omp parallel for schedule(dynamic,1)
+    for ( int run=0 ; run<nruns ; ++run ) {
+      std::mt19937 rng ( params._seed + 7919*run );
+      growBisection( *current, (long)((1-frac0)*current->getTotalWeight()), rng, tries[run] );
+
+      FMRefiner refiner ( *current, maxWeights, params._noImproveLimit );
+      cuts[run] = refiner.refine( tries[run] );
+
+      long w1 = 0;
+      for ( int v=0 ; v<current->getVertexCount() ; ++v ) if (tries[run][v]) w1 += current->_vwgts[v];
+      overs[run] = max(0L,w1-maxWeights[1]) + max(0L,current->getTotalWeight()-w1-maxWeights[0]);
+    }
+
+    int best = 0;
+    for ( int run=1 ; run<nruns ; ++run ) {
+      if ( (overs[run] < overs[best]) or ((overs[run] == overs[best]) and (cuts[run] < cuts[best])) )
+        best = run;
+    }
+    side.swap( tries[best] );
+
+  // Uncoarsening: project and refine each level.
+    for ( size_t level=levels.size() ; level>0 ; --level ) {
+      const HGraph&      finer = (level > 1) ? levels[level-2] : fine;
+      const vector<int>& cmap  = cmaps[level-1];
+      vector<int>        projected ( finer.getVertexCount() );
+
+      for ( int v=0 ; v<finer.getVertexCount() ; ++v ) projected[v] = side[ cmap[v] ];
+      side.swap( projected );
+
+      FMRefiner refiner ( finer, maxWeights, params._noImproveLimit );
+      refiner.refine( side );
+    }
+  }
+
+
+// -------------------------------------------------------------------
+// Recursive bisection, parts [lo,hi) are to be spread on g.
+
+  class RecursiveBisection {
+    public:
+                   RecursiveBisection ( int ubFactor, bool keepCutEdges, const BisectionParameters&, int* part );
+             void  run                ( HGraph& g, const vector<int>& ids, int lo, int hi, unsigned seed, bool inParallel );
+    private:
+             void  _extract           ( const HGraph& g, const vector<int>& ids, const vector<int>& side, int which
+                                      , HGraph& sub, vector<int>& subIds ) const;
+    private:
+      int                  _ubFactor;
+      bool                 _keepCutEdges;
+      BisectionParameters  _params;
+      int*                 _part;
+  };
+
+
+  RecursiveBisection::RecursiveBisection ( int ubFactor, bool keepCutEdges, const BisectionParameters& params, int* part )
+    : _ubFactor    (ubFactor)
+    , _keepCutEdges(keepCutEdges)
+    , _params      (params)
+    , _part        (part)
+  { }
+
+
+  void  RecursiveBisection::_extract ( const HGraph&      g
+                                     , const vector<int>& ids
+                                     , const vector<int>& side
+                                     , int                which
+                                     , HGraph&            sub
+                                     , vector<int>&       subIds ) const
+  {
+    vector<int> local ( g.getVertexCount(), -1 );
+    for ( int v=0 ; v<g.getVertexCount() ; ++v ) {
+      if (side[v] != which) continue;
+      local[v] = subIds.size();
+      subIds   .push_back( ids[v] );
+      sub._vwgts.push_back( g._vwgts[v] );
+    }
+    sub._fixed.assign( subIds.size(), -1 );
+
+    sub._eptr.push_back( 0 );
+    for ( int e=0 ; e<g.getEdgeCount() ; ++e ) {
+      size_t begin = sub._eind.size();
+      bool   cut   = false;
+      for ( int i=g._eptr[e] ; i<g._eptr[e+1] ; ++i ) {
+        int v = g._eind[i];
+        if (local[v] >= 0) sub._eind.push_back( local[v] );
+        else               cut = true;
+      }
+      if ( (sub._eind.size() - begin < 2) or (cut and not _keepCutEdges) ) {
+        sub._eind.resize( begin );
+        continue;
+      }
+      sub._eptr .push_back( sub._eind.size() );
+      sub._ewgts.push_back( g._ewgts[e] );
+    }
+    sub.buildIncidence();
+  }
+
+
+  void  RecursiveBisection::run ( HGraph& g, const vector<int>& ids, int lo, int hi, unsigned seed, bool inParallel )
+  {
+    if (hi - lo == 1) {
+      for ( int id : ids ) _part[id] = lo;
+      return;
+    }
+
+    int mid = lo + (hi-lo)/2;
+
+  // Pre-assigned vertices are bound to the side holding their part.
+    bool free = false;
+    for ( int v=0 ; v<g.getVertexCount() ; ++v ) {
+      int preAssigned = _part[ ids[v] ];
+      g._fixed[v] = (preAssigned < 0) ? -1 : ((preAssigned < mid) ? 0 : 1);
+      if (preAssigned < 0) free = true;
+    }
+
+    vector<int> side;
+    if (free) {
+      BisectionParameters params = _params;
+      params._seed = seed;
+      bisect( g, (double)(mid-lo)/(double)(hi-lo), _ubFactor, params, side );
+    } else
+      side = g._fixed;
+
+    HGraph      sub0, sub1;
+    vector<int> ids0, ids1;
+    _extract( g, ids, side, 0, sub0, ids0 );
+    _extract( g, ids, side, 1, sub1, ids1 );
+
+  // The first bisection uses all the threads for its own loops, the
+  // following ones are spread over them as tasks.
+    if (not inParallel) {
+#pragma omp parallel
+#pragma omp single
+      {
+#pragma omp task default(shared)
+        run( sub0, ids0, lo , mid, 2*seed+1, true );
+        run( sub1, ids1, mid, hi , 2*seed+2, true );
+#pragma omp taskwait
+      }
+      return;
+    }
+
+#pragma omp task default(shared) if(ids0.size() > 1000)
+    run( sub0, ids0, lo , mid, 2*seed+1, true );
+    run( sub1, ids1, mid, hi , 2*seed+2, true );
+#pragma omp taskwait
+  }
+
+
+  BisectionParameters  getParameters ( int* options )
+  {
+    BisectionParameters params;
+    params._nruns          = 10;
+    params._noImproveLimit = 100;
+    params._seed           = 0x5eed;
+
+    if (options and options[Configuration::CustomOptions]) {
+      if (options[Configuration::HMetisNRuns] > 0) params._nruns = options[Configuration::HMetisNRuns];
+      if (options[Configuration::HMetisRType] == Configuration::RTypeEarlyExitFM) params._noImproveLimit = 25;
+    }
+    if (options and (options[Configuration::HMetisRandom] >= 0))
+      params._seed = options[Configuration::HMetisRandom];
+    return params;
+  }
+
+
+  HGraph  makeGraph ( int nvtxs, int nhedges, int* vwgts, int* eptr, int* eind, int* hewgts )
+  {
+    HGraph g;
+    g._vwgts.assign( vwgts, vwgts+nvtxs );
+    g._fixed.assign( nvtxs, -1 );
+    g._eptr .assign( eptr , eptr+nhedges+1 );
+    g._eind .assign( eind , eind+eptr[nhedges] );
+    if (hewgts) g._ewgts.assign( hewgts, hewgts+nhedges );
+    else        g._ewgts.assign( nhedges, 1 );
+    g.buildIncidence();
+    return g;
+  }
+
+
+  void  partition ( HGraph& g, int nparts, int ubFactor, int* options, int* part )
+  {
+    bool keepCutEdges = options and options[Configuration::CustomOptions]
+                        and (options[Configuration::HMetisReconst] == Configuration::ReconstKeepCutHE);
+
+    vector<int> ids ( g.getVertexCount() );
+    for ( int v=0 ; v<g.getVertexCount() ; ++v ) ids[v] = v;
+
+    RecursiveBisection bisection ( ubFactor, keepCutEdges, getParameters(options), part );
+
+    bisection.run( g, ids, 0, nparts, 1, false );
+  }
+
+
+  int  computeKwayCut ( const HGraph& g, const int* part )
+  {
+    int cut = 0;
+    for ( int e=0 ; e<g.getEdgeCount() ; ++e ) {
+      for ( int i=g._eptr[e]+1 ; i<g._eptr[e+1] ; ++i ) {
+        if (part[g._eind[i]] != part[g._eind[g._eptr[e]]]) { cut += g._ewgts[e]; break; }
+      }
+    }
+    return cut;
+  }
+
+
+// -------------------------------------------------------------------
+// Greedy k-way refinement: vertices on the boundary are moved to the
+// part that lowers the cut the most, without exceeding maxWeight.
+
+  void  refineKway ( const HGraph& g, int nparts, long maxWeight, const vector<int>& preAssigned, int* part )
+  {
+    int         nvtxs  = g.getVertexCount();
+    vector<int> counts ( (size_t)g.getEdgeCount()*nparts, 0 );
+    vector<long> weights( nparts, 0 );
+    vector<int> gains  ( nparts, 0 );
+
+    for ( int v=0 ; v<nvtxs ; ++v ) weights[ part[v] ] += g._vwgts[v];
+    for ( int e=0 ; e<g.getEdgeCount() ; ++e )
+      for ( int i=g._eptr[e] ; i<g._eptr[e+1] ; ++i ) ++counts[ (size_t)e*nparts + part[g._eind[i]] ];
+
+    for ( int pass=0 ; pass<4 ; ++pass ) {
+      bool moved = false;
+      for ( int v=0 ; v<nvtxs ; ++v ) {
+        if (preAssigned[v] >= 0) continue;
+
+        int from = part[v];
+        std::fill( gains.begin(), gains.end(), 0 );
+        bool boundary = false;
+        for ( int i=g._vptr[v] ; i<g._vptr[v+1] ; ++i ) {
+          int e    = g._vind[i];
+          int size = g._eptr[e+1] - g._eptr[e];
+          int w    = g._ewgts[e];
+          const int* count = &counts[ (size_t)e*nparts ];
+
+          if (count[from] < size) boundary = true;
+          for ( int to=0 ; to<nparts ; ++to ) {
+            if (to == from) continue;
+            if (count[from] == size) gains[to] -= w;  // Was uncut.
+            if ((count[from] == 1) and (count[to] == size-1)) gains[to] += w;
+          }
+        }
+        if (not boundary) continue;
+
+        int best = from;
+        for ( int to=0 ; to<nparts ; ++to ) {
+          if ((to == from) or (weights[to] + g._vwgts[v] > maxWeight)) continue;
+          if ( (gains[to] > 0) and ((best == from) or (gains[to] > gains[best])) ) best = to;
+        }
+        if (best == from) continue;
+
+        part[v] = best;
+        weights[from] -= g._vwgts[v];
+        weights[best] += g._vwgts[v];
+        for ( int i=g._vptr[v] ; i<g._vptr[v+1] ; ++i ) {
+          int e = g._vind[i];
+          --counts[ (size_t)e*nparts + from ];
+          ++counts[ (size_t)e*nparts + best ];
+        }
+        moved = true;
+      }
+      if (not moved) break;
+    }
+  }
+
+
+}  // Anonymous namespace.
+
+
+namespace Metis {
+
+
+  void  partRecursive ( int  nvtxs , int  nhedges, int* vwgts , int* eptr
+                      , int* eind  , int* hewgts , int  nparts, int  ubFactor
+                      , int* options, int* part  , int* edgeCut )
+  {
+    HGraph g = makeGraph( nvtxs, nhedges, vwgts, eptr, eind, hewgts );
+    partition( g, nparts, ubFactor, options, part );
+    *edgeCut = computeKwayCut( g, part );
+  }
+
+
+  void  partKway ( int  nvtxs , int  nhedges, int* vwgts , int* eptr
+                 , int* eind  , int* hewgts , int  nparts, int  ubFactor
+                 , int* options, int* part  , int* edgeCut )
+  {
+    HGraph      g           = makeGraph( nvtxs, nhedges, vwgts, eptr, eind, hewgts );
+    vector<int> preAssigned ( part, part+nvtxs );
+
+  // The imbalance allowed for the whole partition is shared among the
+  // bisection levels, what remains is used by the k-way refinement.
+    int depth = 0;
+    while ( (1 << depth) < nparts ) ++depth;
+    partition( g, nparts, max(1,ubFactor/max(1,depth)), options, part );
+
+    long maxWeight = (long)( (double)g.getTotalWeight() / nparts * (1.0 + ubFactor/100.0) ) + 1;
+    refineKway( g, nparts, maxWeight, preAssigned, part );
+    *edgeCut = computeKwayCut( g, part );
+  }
+
+
+}  // Metis namespace.
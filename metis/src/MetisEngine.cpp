@@ -48,9 +48,7 @@ using namespace CRL;
 #include "nimbus/NimbusEngine.h"
 using namespace Nimbus;
 
-#ifdef HAVE_HMETIS_LIB
 #include "metis/MetisGraph.h"
-#endif
 #include "metis/MetisEngine.h"
 
 
@@ -64,14 +62,10 @@ namespace Metis {
     : Inherit       (cell)
     , _configuration(new Configuration())
     , _step         (0)
-#ifdef HAVE_HMETIS_LIB
     , _actualGraphs ()
     , _newGraphs    ()
-#endif
     , _globalEdgeCut(0)
   {
-#ifdef HAVE_HMETIS_LIB
-
     NimbusEngine* nimbus = NimbusEngine::get ( getCell() );
     if ( nimbus == NULL )
       throw Error ("Nimbus must be created before Metis, on cell <%s>"
@@ -86,7 +80,6 @@ namespace Metis {
     //   if ( inet->isGlobal() ) continue;
     //   if ( inet->isSupply() ) continue;
     // }
-#endif // HAVE_HMETIS_LIB
   }
 
     
@@ -105,7 +98,6 @@ namespace Metis {
 
   void MetisEngine::_preDestroy ()
   {
-#ifdef HAVE_HMETIS_LIB
     for (MetisGraphs::iterator mgit = _actualGraphs->begin(); mgit != _actualGraphs->end(); ++mgit)
       delete *mgit;
     for (MetisGraphs::iterator mgit = _newGraphs->begin(); mgit != _newGraphs->end(); ++mgit)
@@ -113,18 +105,14 @@ namespace Metis {
 
     delete _actualGraphs;
     delete _newGraphs;
-#endif // HAVE_HMETIS_LIB
     Inherit::_preDestroy();
   }
 
 
   bool MetisEngine::isHMetisCapable ()
   {
-#ifdef HAVE_HMETIS_LIB
-    return false;
-#else
-    return false;
-#endif // HAVE_HMETIS_LIB
+  // Without the hMetis library, the native partitioner is used instead.
+    return true;
   }
 
 
@@ -142,6 +130,9 @@ namespace Metis {
   {
 #ifdef HAVE_HMETIS_LIB
     cmess2 << "     o  hMetis quadri-partition step." << endl;
+#else
+    cmess2 << "     o  Multilevel quadri-partition step." << endl;
+#endif  // HAVE_HMETIS_LIB
 
     Timer timer;
     timer.start();
@@ -196,21 +187,14 @@ namespace Metis {
     cmess2 << "        - Refine placement done in " << getString(timer.getUserTime()) << "s." << endl;
 
     if ( getRefreshCb() != NULL ) getRefreshCb() ();
-#else
-    throw Warning ( "hmetis library is needed to use Metis ToolEngine" );
-#endif  // HAVE_HMETIS_LIB
   }
 
 
   void MetisEngine::save ( unsigned step )
   {
-#ifdef HAVE_HMETIS_LIB
   //for ( MetisGraphs::iterator mgit=_actualGraphs->begin(); mgit != _actualGraphs->end(); ++mgit)
   //  (*mgit)->save ( step );
     grabPlacementModificationFlag ();
-#else
-    throw Warning ( "hmetis library is needed to use Metis ToolEngine" );
-#endif /* HAVE_HMETIS_LIB */
   }
 
 
@@ -233,7 +217,6 @@ namespace Metis {
   bool MetisEngine::_reInit()
   {
 #if 0
-#ifdef HAVE_HMETIS_LIB
     for (MetisGraphs::iterator mgit=_actualGraphs->begin(); mgit != _actualGraphs->end(); ++mgit)
       delete *mgit;
     for (MetisGraphs::iterator mgit=_newGraphs->begin(); mgit != _newGraphs->end(); ++mgit)
@@ -264,9 +247,6 @@ namespace Metis {
       throw Warning("Not enough instances to part, minimum is %d",getNumberOfInstancesStopCriterion());
 
     return true;
-#else
-    throw Warning ( "hmetis library is needed to use Metis ToolEngine" );
-#endif  // HAVE_HMETIS_LIB
 #else
     return false;
 #endif
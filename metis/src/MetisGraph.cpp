@@ -31,8 +31,6 @@
 //
 // Authors-Tag 
 
-#ifdef HAVE_HMETIS_LIB
-
 #include <climits>
 
 #include "hurricane/Net.h"
@@ -53,7 +51,11 @@ using namespace CRL;
 #include "nimbus/NimbusEngine.h"
 using namespace Nimbus;
 
+#ifdef HAVE_HMETIS_LIB
 #include "metis/hmetis.h"
+#else
+#include "metis/HyperPartitioner.h"
+#endif
 #include "metis/MetisGraph.h"
 
 namespace {
@@ -560,20 +562,34 @@ int MetisGraph::part ( linefill& output )
       int ubFactor = _metis->getUbFactor();
         if (!ubFactor)
             ubFactor = 2; // the minimal value is 1, but let's try a bit of amplitude.
+#ifdef HAVE_HMETIS_LIB
         HMETIS_PartRecursive(nvtxs, nhedges, vwgts
                             , eptr, eind, hewgts, nparts
                             , ubFactor
                             , _metis->getHMetisOptions()
                             , part, &_edgeCut);
+#else
+        partRecursive(nvtxs, nhedges, vwgts
+                     , eptr, eind, hewgts, nparts
+                     , ubFactor
+                     , _metis->getHMetisOptions()
+                     , part, &_edgeCut);
+#endif
     }
     else 
     {
       int ubFactor = _metis->getUbFactor();
         if (!ubFactor)
             ubFactor = 5; //minimal value
+#ifdef HAVE_HMETIS_LIB
         HMETIS_PartKway(nvtxs, nhedges, vwgts
                        , eptr, eind, hewgts, nparts
                        , ubFactor, _metis->getHMetisOptions(), part, &_edgeCut);
+#else
+        partKway(nvtxs, nhedges, vwgts
+                , eptr, eind, hewgts, nparts
+                , ubFactor, _metis->getHMetisOptions(), part, &_edgeCut);
+#endif
     }
 
     UpdateSession::open();
@@ -625,5 +641,3 @@ int MetisGraph::part ( linefill& output )
 }
 
 }
-
-#endif /* HAVE_HMETIS_LIB */
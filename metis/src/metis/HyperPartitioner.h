@@ -0,0 +1,54 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) 2026, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      M e t i s  -  h M e t i s   W r a p p e r                  |
+// |                                                                 |
+// |  Author      :                                   agent          |
+// |  E-mail      :                              agent@local         |
+// | =============================================================== |
+// |  C++ Header  :       "./metis/HyperPartitioner.h"               |
+// +-----------------------------------------------------------------+
+
+
+#ifndef  METIS_HYPER_PARTITIONER_H
+#define  METIS_HYPER_PARTITIONER_H
+
+
+namespace Metis {
+
+
+// -------------------------------------------------------------------
+// Native multilevel hypergraph partitioner.
+//
+// Drop-in replacement of HMETIS_PartRecursive() & HMETIS_PartKway(),
+// used when the hMetis library is not available. The arguments have
+// the same meaning as in hMetis (see "metis/hmetis.h"):
+//   - Vertices with part[i] != -1 are pre-assigned to that part.
+//   - The options array is indexed by Configuration::MetisOption.
+//     Only NRuns, RType (early exit FM), Reconst & Random are
+//     honored, the coarsening is always first choice.
+//   - A negative random seed selects a fixed one, so runs are
+//     reproducible.
+//
+// Each bisection is multilevel: first choice coarsening (the matching
+// proposals are computed in parallel), greedy region growing on the
+// coarsest hypergraph (the NRuns tries are run in parallel), then
+// Fiduccia-Mattheyses refinement while uncoarsening. The two halves
+// of a recursive bisection are partitioned as parallel tasks.
+
+
+  void  partRecursive ( int  nvtxs , int  nhedges, int* vwgts , int* eptr
+                      , int* eind  , int* hewgts , int  nparts, int  ubFactor
+                      , int* options, int* part  , int* edgeCut );
+  void  partKway      ( int  nvtxs , int  nhedges, int* vwgts , int* eptr
+                      , int* eind  , int* hewgts , int  nparts, int  ubFactor
+                      , int* options, int* part  , int* edgeCut );
+
+
+}  // Metis namespace.
+
+#endif  // METIS_HYPER_PARTITIONER_H
@@ -35,8 +35,6 @@
 #ifndef __METISGRAPH_H
 #define	__METISGRAPH_H
 
-#ifdef HAVE_HMETIS_LIB
-
 #include "metis/MetisEngine.h"
 
 namespace Metis {
@@ -77,6 +75,4 @@ namespace Metis {
 }  // End of Metis namespace.
 
 
-#endif /* HAVE_HMETIS_LIB */
-
 #endif /* __METISGRAPH_H */
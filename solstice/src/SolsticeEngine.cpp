@@ -23,6 +23,7 @@
 #include <hurricane/DataBase.h>
 #include <hurricane/Cell.h>
 #include <hurricane/Technology.h>
+#include <hurricane/HyperNetIndex.h>
 
 #include <crlcore/Utilities.h>
 #include <crlcore/ToolEngine.h>
@@ -227,6 +228,7 @@ namespace Solstice {
     map<Occurrence, set<Equi*> > map_hypernet2hyperequi;
     set<Occurrence>              hypernets;
     EquinoxEngine *              equinox = Equinox::EquinoxEngine::get(_cell);
+    HyperNetIndex *              index   = HyperNetIndex::create(_cell);
     
     forEach(Equi*,equi, equinox->getRoutingEquis())
       {
@@ -295,6 +297,7 @@ namespace Solstice {
       }
     
     map_hypernet2hyperequi.clear();
+    _cell->remove(index);
     setIsComparedTrue(_cell);
   }
   
@@ -304,6 +307,20 @@ namespace Solstice {
   Occurrence SolsticeEngine::getTopNetOccurrence(Occurrence occurrence)
   {
     Path path = occurrence.getPath();
+
+    // During runComparison(), every occurrence of a hypernet is resolved
+    // by a single walk recorded in the HyperNetIndex of the top cell.
+    HyperNetIndex* index = HyperNetIndex::get(occurrence.getOwnerCell());
+    if(index) {
+      Net * net = dynamic_cast<Net*>(occurrence.getEntity());
+      if(!net) {
+	Component * component = dynamic_cast<Component*>(occurrence.getEntity());
+	if(!component)  
+	  throw Error("Unknow occurrence in EQUINOX::GetUpperNetOccurrence()");
+	net = component->getNet();
+      }
+      return index->getRootNetOccurrence(Occurrence(net, path));
+    }
     
     if( path.isEmpty() ) {
       Net * net = dynamic_cast<Net*>(occurrence.getEntity());